@@ -0,0 +1,6 @@
+// Generated by dia2code
+#ifndef __CLIENT__H
+#define __CLIENT__H
+
+#include "client/Client.h"
+#endif
@@ -0,0 +1,38 @@
+// Generated by dia2code
+#ifndef CLIENT__CLIENT__H
+#define CLIENT__CLIENT__H
+
+
+namespace state {
+  // Forward declaration
+  class State;
+};
+namespace render {
+  // Forward declaration
+  class RenderState;
+}
+
+#include "render/RenderState.h"
+#include "state/State.h"
+
+namespace client {
+
+  /** Client
+   * Class - 
+   */
+  class Client {
+    // Attributes
+  public:
+    state::State* currentGameState;
+    // Operations
+  public:
+    Client ();
+    void helloWorld ();
+    void printState ();
+    void callRender ();
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -16,6 +16,7 @@
 #include "tui/Terminal.h"
 #include "tui/TUIManager.h"
 #include "mapState/MapState.h"
+#include "mapState/MapImage.h"
 #include "mapState/Road.h"
 #include "mapState/Station.h"
 #include "playersState/PlayersState.h"
@@ -104,6 +105,22 @@ int main(int argc, char *argv[])
         cout << "exiting." << endl;
         return EXIT_FAILURE;
     }
+    if (strcmp(argv[1], "compile-map") == 0)
+    {
+        if (argc < 4)
+        {
+            std::cerr << "Usage: " << argv[0] << " compile-map <map.json> <image.bin> [layout.json]" << std::endl;
+            return EXIT_FAILURE;
+        }
+        std::string layoutPath = argc >= 5 ? argv[4] : "";
+        if (!mapState::MapImage::compileFile(argv[2], layoutPath, argv[3]))
+        {
+            std::cerr << "Could not compile " << argv[2] << std::endl;
+            return EXIT_FAILURE;
+        }
+        std::cout << "Map image written to " << argv[3] << std::endl;
+        return EXIT_SUCCESS;
+    }
     client::Client client = client::Client();
     if (strcmp(argv[1], "hello") == 0 || strcmp(argv[1], "state") == 0 || strcmp(argv[1], "render") == 0 || strcmp(argv[1], "tui") == 0)
     {
@@ -0,0 +1,17 @@
+// Generated by dia2code
+#ifndef __CARDSSTATE__H
+#define __CARDSSTATE__H
+
+#include "cardsState/Card.h"
+#include "cardsState/DestinationCard.h"
+#include "cardsState/ColorCard.h"
+#include "cardsState/WagonCard.h"
+#include "cardsState/Deck.h"
+#include "cardsState/PlayerCards.h"
+#include "cardsState/OutOfGame.h"
+#include "cardsState/FaceDownCards.h"
+#include "cardsState/FaceUpCards.h"
+#include "cardsState/Trash.h"
+#include "cardsState/SharedDeck.h"
+#include "cardsState/CardsState.h"
+#endif
@@ -0,0 +1,28 @@
+// Generated by dia2code
+#ifndef CARDSSTATE__CARD__H
+#define CARDSSTATE__CARD__H
+
+
+namespace cardsState {
+
+  /** Card
+   * Class - 
+   * base class representing a generic game card
+   * This class serves as the parent for all card types in the game:
+   * - Wagon cards
+   * - Destination cards
+   */
+  class Card {
+    // Operations
+  public:
+    /// ~Card
+    /** Public Method - 
+     * Virtual destructor
+     */
+    virtual ~Card ();
+    // Setters and Getters
+  };
+
+};
+
+#endif
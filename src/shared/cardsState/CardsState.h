@@ -0,0 +1,60 @@
+// Generated by dia2code
+#ifndef CARDSSTATE__CARDSSTATE__H
+#define CARDSSTATE__CARDSSTATE__H
+
+#include <vector>
+#include <memory>
+#include <string>
+
+namespace cardsState {
+  // Forward declaration
+  class CardsState;
+};
+namespace mapState {
+  // Forward declaration
+  class Station;
+};
+namespace cardsState {
+  // Forward declaration
+  class PlayerCards;
+  // Forward declaration
+  template <  class CardType>
+  class OutOfGame;
+  // Forward declaration
+  template <  class CardType>
+  class SharedDeck;
+}
+
+#include "mapState/Station.h"
+#include "PlayerCards.h"
+#include "ColorCard.h"
+#include "OutOfGame.h"
+#include "SharedDeck.h"
+
+namespace cardsState {
+
+  /** CardsState
+   * Class - 
+   */
+  class CardsState {
+    // Associations
+    // Attributes
+  public:
+    std::vector<std::shared_ptr<PlayerCards>> playersCards;
+    std::shared_ptr<SharedDeck<DestinationCard>> gameDestinationCards;
+    std::shared_ptr<SharedDeck<WagonCard>> gameWagonCards;
+    std::shared_ptr<OutOfGame<DestinationCard>> outOfGameCards;
+    // Operations
+  public:
+    CardsState ();
+    static CardsState Europe (std::vector<std::shared_ptr<mapState::Station>> stations, int nbPLayers);
+    static CardsState ParseFromJSON (std::string json, std::shared_ptr<mapState::MapState> mapState);
+    void display (int indent = 0);
+    bool discardWagonCards (std::shared_ptr<PlayerCards> hand, cardsState::ColorCard color, int count, bool allowLocomotives);
+    int countWagonCards (std::shared_ptr<PlayerCards> hand, cardsState::ColorCard color, bool includeLocomotives);
+    // Setters and Getters
+  };
+
+};
+
+#endif
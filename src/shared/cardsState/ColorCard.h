@@ -0,0 +1,31 @@
+// Generated by dia2code
+#ifndef CARDSSTATE__COLORCARD__H
+#define CARDSSTATE__COLORCARD__H
+
+
+namespace cardsState {
+
+  /** ColorCard
+   * Enum - 
+   * ColorCard
+   * Enumeration representing all possible colors of Wagon cards.
+   * Special values:
+   *  - LOCOMOTIVE : Represents a wildcard card that can substitute for any color.
+   *  - NONE       : A fallback value for undefined or uninitialized colors.
+   */
+  enum ColorCard {
+    UNKNOWN     = 404,
+    RED     = 1,
+    BLUE     = 2,
+    GREEN     = 3,
+    BLACK     = 4,
+    YELLOW     = 5,
+    ORANGE     = 6,
+    PINK     = 7,
+    WHITE     = 8,
+    LOCOMOTIVE     = 42
+  };
+
+};
+
+#endif
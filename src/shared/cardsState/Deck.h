@@ -0,0 +1,65 @@
+// Generated by dia2code
+#ifndef CARDSSTATE__DECK__H
+#define CARDSSTATE__DECK__H
+
+#include <vector>
+#include <memory>
+#include <tuple>
+
+namespace mapState {
+  // Forward declaration
+  class Station;
+};
+namespace boost {
+  // Forward declaration
+  class type_index;
+};
+namespace cardsState {
+  // Forward declaration
+  class Card;
+}
+
+#include "ColorCard.h"
+#include "mapState/Station.h"
+#include <boost/type_index.hpp>
+#include "Card.h"
+
+namespace cardsState {
+
+  /** Deck
+   * Class - 
+   * Generic deck class that stores and manages a collection of cards.
+   *  The Deck class represents a stack of cards of a given type (CardType).
+   * @property cards public vector<shared_ptr<CardType>>
+   */
+  template <  class CardType=Card>
+  class Deck {
+    // Associations
+    // Attributes
+  public:
+     std::vector<std::shared_ptr<CardType>>  cards;
+    // Operations
+  public:
+    Deck ();
+    Deck (std::vector<std::shared_ptr<CardType>> cards);
+    Deck (std::vector<std::tuple<std::shared_ptr<mapState::Station>,std::shared_ptr<mapState::Station>, int,bool>> destinationCardsInfos);
+    Deck (std::vector<ColorCard> wagonCardsInfos);
+    Deck (std::vector<CardType> cards);
+    std::vector<std::shared_ptr<CardType>> getCards ();
+    void addCard (std::shared_ptr<CardType> card);
+    std::shared_ptr<CardType> removeCard (int position);
+    void display (int indent = 0);
+    virtual ~Deck ();
+    int countCards ();
+    static void moveCardTo (std::shared_ptr<Deck<CardType>> originDeck, std::shared_ptr<Deck<CardType>> destinationDeck, int cardPosition);
+    void shuffle ();
+    static std::vector<std::shared_ptr<CardType>> shuffle (std::vector<std::shared_ptr<CardType>> cards);
+    void  putCardBack (CardType destinationcard);
+    std::shared_ptr<CardType> takeLastCard ();
+    void _display (int indent = 0);
+    // Setters and Getters
+  };
+
+};
+
+#endif
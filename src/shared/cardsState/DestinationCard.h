@@ -0,0 +1,82 @@
+// Generated by dia2code
+#ifndef CARDSSTATE__DESTINATIONCARD__H
+#define CARDSSTATE__DESTINATIONCARD__H
+
+#include <memory>
+#include <vector>
+#include <tuple>
+#include <string>
+
+namespace mapState {
+  // Forward declaration
+  class Station;
+};
+namespace cardsState {
+  // Forward declaration
+  class Card;
+}
+
+#include "mapState/Station.h"
+#include "Card.h"
+
+namespace cardsState {
+
+  /** DestinationCard
+   * Class - 
+   * A DestinationCard is a concrete card type derived from Card. Each destination card
+   *  specifies two stations that the player must connect using claimed routes during the game.
+   * @property stationA public Station
+   * @property stationB public Station
+   * @property points public int 
+   */
+  class DestinationCard : public cardsState::Card {
+    // Attributes
+  public:
+    std::shared_ptr<mapState::Station> stationA;
+    std::shared_ptr<mapState::Station> stationB;
+    int points;
+    bool isLong;
+    // Operations
+  public:
+    /// DestinationCard
+    /** Public Method - 
+     * Method - DestinationCard Constructs a new DestinationCard.
+     * @param stationA Name of the first station
+     * @param stationB Station Name of the second station.
+     * @param points int  The number of points for this destination.
+     */
+    DestinationCard (std::shared_ptr<mapState::Station> stationA, std::shared_ptr<mapState::Station> stationB, int points, bool isRoadLong);
+    static std::vector<std::shared_ptr<DestinationCard>> BatchConstructor (std::vector<std::tuple<std::shared_ptr<mapState::Station>,std::shared_ptr<mapState::Station>, int,bool>> infos);
+    static std::vector<std::shared_ptr<DestinationCard>> BatchConstructorByName (std::vector<std::tuple<std::string,std::string, int,bool>> infos, std::vector<std::shared_ptr<mapState::Station>> stations);
+    static std::vector<std::shared_ptr<DestinationCard>> Europe (std::vector<std::shared_ptr<mapState::Station>> stations);
+    DestinationCard ();
+    /// getstationA
+    /** Public Method - 
+     * Method - getCityA string Gets the name of the first city 
+     * @return the cityA string
+     */
+    std::shared_ptr<mapState::Station> getstationA ();
+    /// getstationB
+    /** Public Method - 
+     * Method - getCityB string Gets the name of the second city 
+     * @return the cityB string
+     */
+    std::shared_ptr<mapState::Station> getstationB ();
+    /// getPoints
+    /** Public Method - 
+     * Method getPoints Gets the point value of the destination card
+     * @return the int points
+     */
+    int getPoints ();
+    /// display
+    /** Public Method - 
+     * Method display Displays detailed information about the destination card
+     */
+    void display (int indent = 0);
+    void _display (int indent = 0);
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,41 @@
+// Generated by dia2code
+#ifndef CARDSSTATE__FACEDOWNCARDS__H
+#define CARDSSTATE__FACEDOWNCARDS__H
+
+#include <vector>
+#include <memory>
+
+namespace mapState {
+  // Forward declaration
+  class Station;
+};
+namespace cardsState {
+  // Forward declaration
+  template <  class CardType>
+  class Deck;
+}
+
+#include "mapState/Station.h"
+#include "Deck.h"
+
+namespace cardsState {
+
+  /** FaceDownCards
+   * Class - 
+   */
+  template <  class CardType>
+  class FaceDownCards : public cardsState::Deck<CardType> {
+    // Operations
+  public:
+    FaceDownCards ();
+    FaceDownCards (std::vector<CardType> cards);
+    FaceDownCards (std::vector<std::shared_ptr<CardType>> cards);
+    static FaceDownCards<DestinationCard> Europe (std::vector<std::shared_ptr<mapState::Station>> stations);
+    static FaceDownCards<WagonCard> Init ();
+    void display (int indent = 0);
+    // Setters and Getters
+  };
+
+};
+
+#endif
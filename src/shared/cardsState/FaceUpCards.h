@@ -0,0 +1,34 @@
+// Generated by dia2code
+#ifndef CARDSSTATE__FACEUPCARDS__H
+#define CARDSSTATE__FACEUPCARDS__H
+
+#include <vector>
+#include <memory>
+
+namespace cardsState {
+  // Forward declaration
+  template <  class CardType>
+  class Deck;
+}
+
+#include "Deck.h"
+
+namespace cardsState {
+
+  /** FaceUpCards
+   * Class - 
+   */
+  template <  class CardType>
+  class FaceUpCards : public cardsState::Deck<CardType> {
+    // Operations
+  public:
+    FaceUpCards ();
+    FaceUpCards (std::vector<CardType> cards);
+    FaceUpCards (std::vector<std::shared_ptr<CardType>> cards);
+    void display (int indent = 0);
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,34 @@
+// Generated by dia2code
+#ifndef CARDSSTATE__OUTOFGAME__H
+#define CARDSSTATE__OUTOFGAME__H
+
+#include <vector>
+#include <memory>
+
+namespace cardsState {
+  // Forward declaration
+  template <  class CardType>
+  class Deck;
+}
+
+#include "Deck.h"
+
+namespace cardsState {
+
+  /** OutOfGame
+   * Class - 
+   */
+  template <  class CardType>
+  class OutOfGame : public cardsState::Deck<CardType> {
+    // Operations
+  public:
+    OutOfGame ();
+    OutOfGame (std::vector<CardType> cards);
+    OutOfGame (std::vector<std::shared_ptr<CardType>> cards);
+    void display (int indent = 0);
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,55 @@
+// Generated by dia2code
+#ifndef CARDSSTATE__PLAYERCARDS__H
+#define CARDSSTATE__PLAYERCARDS__H
+
+#include <memory>
+#include <vector>
+
+namespace cardsState {
+  // Forward declaration
+  class DestinationCard;
+  // Forward declaration
+  class WagonCard;
+  // Forward declaration
+  class PlayerCards;
+  // Forward declaration
+  class CardsState;
+  // Forward declaration
+  template <  class CardType>
+  class Deck;
+}
+
+#include "DestinationCard.h"
+#include "WagonCard.h"
+#include "CardsState.h"
+#include "Deck.h"
+
+namespace cardsState {
+
+  /** PlayerCards
+   * Class - 
+   */
+  class PlayerCards {
+    // Associations
+    // Attributes
+  public:
+    static int startingWagonCardsCount;
+    static int startingLongDestinationCardsCount;
+    static int startingShortDestinationCardsCount;
+    std::shared_ptr<Deck<DestinationCard>> destinationCards;
+    std::shared_ptr<Deck<WagonCard>> wagonCards;
+    // Operations
+  public:
+    PlayerCards ();
+    PlayerCards (std::vector<std::shared_ptr<DestinationCard>> destinationCards, std::vector<std::shared_ptr<WagonCard>> wagonCards);
+    static PlayerCards StartHand (std::shared_ptr<SharedDeck<DestinationCard>> sharedDestinationDecks, std::shared_ptr<SharedDeck<WagonCard>> sharedWagonDecks);
+    static std::vector<std::shared_ptr<PlayerCards>> BatchStartHand (std::shared_ptr<SharedDeck<DestinationCard>> sharedDestinationDecks, std::shared_ptr<SharedDeck<WagonCard>> sharedWagonDecks, int nbPLayers);
+    void display (int indent = 0);
+    template<class CardType> void takeCard (std::shared_ptr<CardsState> cardsState, std::shared_ptr<CardType> card = nullptr, int number = 0);
+    template<class CardType> void _takeCard (std::shared_ptr<SharedDeck<CardType>> sharedDeck, std::shared_ptr<CardType> card = nullptr, int number = 0);
+    // Setters and Getters
+  };
+
+};
+
+#endif
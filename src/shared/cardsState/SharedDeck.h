@@ -0,0 +1,67 @@
+// Generated by dia2code
+#ifndef CARDSSTATE__SHAREDDECK__H
+#define CARDSSTATE__SHAREDDECK__H
+
+#include <memory>
+#include <vector>
+
+namespace mapState {
+  // Forward declaration
+  class Station;
+};
+namespace cardsState {
+  // Forward declaration
+  class PlayerCards;
+  // Forward declaration
+  class DestinationCard;
+  // Forward declaration
+  template <  class CardType>
+  class FaceDownCards;
+  // Forward declaration
+  template <  class CardType>
+  class FaceUpCards;
+  // Forward declaration
+  template <  class CardType>
+  class Trash;
+}
+
+#include "mapState/Station.h"
+#include "PlayerCards.h"
+#include "DestinationCard.h"
+#include "FaceDownCards.h"
+#include "FaceUpCards.h"
+#include "Trash.h"
+
+namespace cardsState {
+
+  /** SharedDeck
+   * Class - 
+   */
+  template <  class CardType>
+  class SharedDeck {
+    // Associations
+    // Attributes
+  public:
+    std::shared_ptr<Trash<CardType>> trash;
+    std::shared_ptr<FaceUpCards<CardType>> faceUpCards;
+    std::shared_ptr<FaceDownCards<CardType>> faceDownCards;
+    // Operations
+  public:
+    SharedDeck ();
+    SharedDeck (std::vector<std::shared_ptr<CardType>> faceDownCards);
+    SharedDeck (std::vector<std::shared_ptr<CardType>> trash, std::vector<std::shared_ptr<CardType>> faceUpCards, std::vector<std::shared_ptr<CardType>> faceDownCards);
+    static SharedDeck<DestinationCard> Europe (std::vector<std::shared_ptr<mapState::Station>> stations);
+    static SharedDeck<WagonCard> Init ();
+    void  display (int indent = 0);
+    void  turnCardUp ();
+    void refillMainDeck ();
+    void  trashCard (std::shared_ptr<CardType> card);
+    void drawCard (std::shared_ptr<PlayerCards> playerCards, std::shared_ptr<CardType> card = nullptr, int number = 0);
+    void Setup ();
+    void Setup (std::shared_ptr<OutOfGame<DestinationCard>> outOfGameCards);
+    // Setters and Getters
+  };
+
+};
+
+#endif
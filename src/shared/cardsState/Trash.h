@@ -0,0 +1,34 @@
+// Generated by dia2code
+#ifndef CARDSSTATE__TRASH__H
+#define CARDSSTATE__TRASH__H
+
+#include <vector>
+#include <memory>
+
+namespace cardsState {
+  // Forward declaration
+  template <  class CardType>
+  class Deck;
+}
+
+#include "Deck.h"
+
+namespace cardsState {
+
+  /** Trash
+   * Class - 
+   */
+  template <  class CardType>
+  class Trash : public cardsState::Deck<CardType> {
+    // Operations
+  public:
+    Trash ();
+    Trash (std::vector<CardType> cards);
+    Trash (std::vector<std::shared_ptr<CardType>> cards);
+    void display (int indent = 0);
+    // Setters and Getters
+  };
+
+};
+
+#endif
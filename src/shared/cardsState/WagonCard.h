@@ -0,0 +1,66 @@
+// Generated by dia2code
+#ifndef CARDSSTATE__WAGONCARD__H
+#define CARDSSTATE__WAGONCARD__H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <utility>
+
+namespace cardsState {
+  // Forward declaration
+  class Card;
+}
+
+#include "ColorCard.h"
+#include "Card.h"
+
+namespace cardsState {
+
+  /** WagonCard
+   * Class - 
+   * WagonCard is a concrete class derived from Card. Each Wagon card has a color,
+   *  defined by the ColorCard enumeration. These cards are collected by players
+   *  and spent to claim routes on the board.
+   * @property color public ColorCard This attribute uses the ColorCard enum to represent
+   *       the card's color 
+   */
+  class WagonCard : public cardsState::Card {
+    // Associations
+    // Attributes
+  public:
+    static int locomotiveInitCardsCount;
+    static int otherInitCardsCount;
+    static int faceUpCardsCount;
+    static ColorCard possibleColors[10];
+    static std::unordered_map<ColorCard, std::string> ColorsNames;
+    ColorCard color;
+    // Operations
+  public:
+    WagonCard ();
+    /// WagonCard
+    /** Public Method - 
+     * WagonCard
+     * Method - WagonCard
+     * Constructs a new WagonCard with a given color.
+     * @param color ColorCard 
+     */
+    WagonCard (ColorCard color);
+    static std::vector<std::shared_ptr<WagonCard>> BatchConstructor (std::vector<cardsState::ColorCard>  infos);
+    static std::vector<std::shared_ptr<WagonCard>> OrderedBatch (std::pair<ColorCard, int> (&infos)[9]);
+    static std::vector<std::shared_ptr<WagonCard>> StartCards ();
+    /// display
+    /** Public Method - 
+     * Method - display() Displays information about the wagon card
+     */
+    void display (int indent = 0);
+    ColorCard getColor ();
+    void setColor (ColorCard color);
+    void _display (int indent = 0);
+    // Setters and Getters
+  };
+
+};
+
+#endif
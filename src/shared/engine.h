@@ -0,0 +1,41 @@
+// Generated by dia2code
+#ifndef __ENGINE__H
+#define __ENGINE__H
+
+#include "engine/EngineEventType.h"
+#include "engine/Phase.h"
+#include "engine/PendingTickets.h"
+#include "engine/PendingTunnel.h"
+#include "engine/PlayerController.h"
+#include "engine/TurnContext.h"
+#include "engine/EngineEvent.h"
+#include "engine/EngineResult.h"
+#include "engine/EngineCommandType.h"
+#include "engine/GameState.h"
+#include "engine/StateMachine.h"
+#include "engine/Engine.h"
+#include "engine/EngineCommand.h"
+#include "engine/CommandParser.h"
+#include "engine/IntroState.h"
+#include "engine/PrintInstructionsState.h"
+#include "engine/SetupState.h"
+#include "engine/PlayerAnnounceState.h"
+#include "engine/PlayerTurnState.h"
+#include "engine/DrawWagonCardState.h"
+#include "engine/DrawDestinationCardState.h"
+#include "engine/ClaimRoadState.h"
+#include "engine/TunnelResolveState.h"
+#include "engine/ClaimStationState.h"
+#include "engine/EndTurnState.h"
+#include "engine/RoadResolveState.h"
+#include "engine/EndGameState.h"
+#include "engine/ExitState.h"
+#include "engine/WaitTurnState.h"
+#include "engine/DestinationChoiceState.h"
+#include "engine/FaceUpState.h"
+#include "engine/FaceDownState.h"
+#include "engine/BorrowRoadState.h"
+#include "engine/ConfirmationState.h"
+#include "engine/HumanController.h"
+#include "engine/AIController.h"
+#endif
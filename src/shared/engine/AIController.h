@@ -0,0 +1,47 @@
+// Generated by dia2code
+#ifndef ENGINE__AICONTROLLER__H
+#define ENGINE__AICONTROLLER__H
+
+#include <memory>
+
+namespace parser {
+  // Forward declaration
+  class CommandMessage;
+};
+namespace state {
+  // Forward declaration
+  class State;
+};
+namespace engine {
+  // Forward declaration
+  class Engine;
+  // Forward declaration
+  class EngineResult;
+  // Forward declaration
+  class PlayerController;
+}
+
+#include "parser/CommandMessage.h"
+#include "state/State.h"
+#include "Engine.h"
+#include "PlayerController.h"
+
+namespace engine {
+
+  /** AIController
+   * Class - 
+   */
+  class AIController : public engine::PlayerController {
+    // Attributes
+  public:
+    int seed;
+    // Operations
+  public:
+    parser::CommandMessage nextCommand (std::shared_ptr<state::State> state, std::shared_ptr<Engine> engine);
+    void notify (const EngineResult& result);
+    // Setters and Getters
+  };
+
+};
+
+#endif
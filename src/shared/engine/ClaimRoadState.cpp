@@ -248,7 +248,7 @@ namespace engine
       return buildError(engine, "Claim road: missing player hand");
     }
 
-    if (std::dynamic_pointer_cast<mapState::Tunnel>(road))
+    if (road->getKind() == mapState::RoadKind::TUNNEL)
     {
       engine->context.pendingTunnel.route = road;
       engine->context.pendingTunnel.baseLength = road->getLength();
@@ -0,0 +1,55 @@
+// Generated by dia2code
+#ifndef ENGINE__COMMANDPARSER__H
+#define ENGINE__COMMANDPARSER__H
+
+#include <string>
+#include <memory>
+
+namespace parser {
+  // Forward declaration
+  class JSONParser;
+  // Forward declaration
+  class CommandMessage;
+  // Forward declaration
+  class ResultMessage;
+};
+namespace engine {
+  // Forward declaration
+  class EngineResult;
+  // Forward declaration
+  class EngineCommand;
+  // Forward declaration
+  class Engine;
+}
+
+#include "parser/JSONParser.h"
+#include "parser/CommandMessage.h"
+#include "EngineCommand.h"
+#include "EngineResult.h"
+#include "Engine.h"
+#include "parser/ResultMessage.h"
+
+namespace engine {
+
+  /** CommandParser
+   * Class - 
+   */
+  class CommandParser {
+    // Attributes
+  private:
+    parser::JSONParser jsonParser;
+    // Operations
+  public:
+    CommandParser ();
+    parser::CommandMessage decode (const std::string& json, std::string& error);
+    std::string encode (const parser::ResultMessage& result);
+    std::string encodeResult (const EngineResult& result);
+    EngineCommand parse (const std::string& json);
+    EngineResult apply (std::shared_ptr<Engine> engine, const EngineCommand& command);
+    EngineResult parseAndApply (std::shared_ptr<Engine> engine, const std::string& json);
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,39 @@
+// Generated by dia2code
+#ifndef ENGINE__CONFIRMATIONSTATE__H
+#define ENGINE__CONFIRMATIONSTATE__H
+
+#include <memory>
+#include <vector>
+
+namespace engine {
+  // Forward declaration
+  class Engine;
+  // Forward declaration
+  class EngineResult;
+  // Forward declaration
+  class EngineCommand;
+  // Forward declaration
+  class GameState;
+}
+
+#include "Engine.h"
+#include "EngineResult.h"
+#include "GameState.h"
+
+namespace engine {
+
+  /** ConfirmationState
+   * Class - 
+   */
+  class ConfirmationState : public engine::GameState {
+    // Operations
+  public:
+    void onEnter (std::shared_ptr<Engine> engine);
+    EngineResult handleCommand (std::shared_ptr<Engine> engine, const EngineCommand& command);
+    std::vector<EngineCommandType> getAllowedCommands ();
+    // Setters and Getters
+  };
+
+};
+
+#endif
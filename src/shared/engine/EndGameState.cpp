@@ -4,10 +4,15 @@
 #include "EngineEvent.h"
 #include "playersState/Player.h"
 
+#include <algorithm>
+
 namespace engine
 {
   namespace
   {
+    // European Express bonus for the longest continuous route, shared on ties
+    const int kLongestRouteBonus = 10;
+
     EngineResult buildError(std::shared_ptr<Engine> engine, const std::string& message)
     {
       EngineResult result;
@@ -55,25 +60,73 @@ namespace engine
       return;
     }
 
+    std::vector<int> longestRoutes = state->map.getLongestRoutes(players);
+    int longestRoute = 0;
+    for (int length : longestRoutes)
+    {
+      longestRoute = std::max(longestRoute, length);
+    }
+
+    // stations are turned into borrowed roads before tickets are checked; the borrows only count for the
+    // score and are not written back to the players, so scoring the same game twice gives the same result
+    std::vector<std::vector<std::shared_ptr<mapState::Road>>> stationBorrows = state->map.getBestStationBorrows(players);
+
     int bestScore = -1000000;
     std::string bestName = "";
 
-    for (const std::shared_ptr<playersState::Player>& player : players)
+    for (std::size_t i = 0; i < players.size(); ++i)
     {
+      const std::shared_ptr<playersState::Player>& player = players[i];
       if (!player)
       {
         continue;
       }
+      int wagonPoints = player->calculateWagonPoints();
+      std::vector<std::shared_ptr<mapState::Road>> usableRoads = state->map.getRoadsUsableByPlayer(player);
+      for (const std::shared_ptr<mapState::Road>& road : stationBorrows[i])
+      {
+        usableRoads.push_back(road);
+
+        EngineEvent borrowEvent;
+        borrowEvent.type = EngineEventType::INFO;
+        borrowEvent.message = player->getName() + " borrows road " + std::to_string(road->getId()) + " with a station.";
+        borrowEvent.payload = "";
+        engine->pendingEvents.push_back(borrowEvent);
+      }
+
+      // tickets still in hand score too once their stations are joined
+      std::vector<std::shared_ptr<cardsState::DestinationCard>> completed = player->completedDestinations;
+      std::shared_ptr<cardsState::PlayerCards> hand = player->getHand();
+      if (hand && hand->destinationCards)
+      {
+        for (const std::shared_ptr<cardsState::DestinationCard>& dest : hand->destinationCards->cards)
+        {
+          if (dest && std::find(completed.begin(), completed.end(), dest) == completed.end()
+              && mapState::MapState::isDestinationReached(usableRoads, dest->getstationA(), dest->getstationB()))
+          {
+            completed.push_back(dest);
+          }
+        }
+      }
       int destPoints = 0;
-      for (const std::shared_ptr<cardsState::DestinationCard>& dest : player->completedDestinations)
+      for (const std::shared_ptr<cardsState::DestinationCard>& dest : completed)
       {
         if (dest)
         {
           destPoints += dest->getPoints();
         }
       }
-      int wagonPoints = player->calculateWagonPoints();
       int total = player->getScore() + destPoints + wagonPoints;
+      if (longestRoute > 0 && longestRoutes[i] == longestRoute)
+      {
+        total += kLongestRouteBonus;
+
+        EngineEvent bonusEvent;
+        bonusEvent.type = EngineEventType::INFO;
+        bonusEvent.message = player->getName() + " gets the longest route bonus (" + std::to_string(longestRoute) + ").";
+        bonusEvent.payload = "";
+        engine->pendingEvents.push_back(bonusEvent);
+      }
 
       EngineEvent scoreEvent;
       scoreEvent.type = EngineEventType::INFO;
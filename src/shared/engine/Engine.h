@@ -0,0 +1,64 @@
+// Generated by dia2code
+#ifndef ENGINE__ENGINE__H
+#define ENGINE__ENGINE__H
+
+#include <memory>
+#include <vector>
+#include <string>
+
+namespace state {
+  // Forward declaration
+  class State;
+};
+namespace engine {
+  // Forward declaration
+  class TurnContext;
+  // Forward declaration
+  class StateMachine;
+  // Forward declaration
+  class EngineEvent;
+  // Forward declaration
+  class EngineResult;
+};
+namespace playersState {
+  // Forward declaration
+  class Player;
+}
+
+#include "state/State.h"
+#include "Phase.h"
+#include "TurnContext.h"
+#include "StateMachine.h"
+#include "EngineEvent.h"
+#include "EngineResult.h"
+#include "playersState/Player.h"
+
+namespace engine {
+
+  /** Engine
+   * Class - 
+   */
+  class Engine {
+    // Attributes
+  public:
+    std::shared_ptr<state::State> state;
+    Phase phase;
+    TurnContext context;
+    std::shared_ptr<StateMachine> stateMachine;
+    std::vector<EngineEvent> pendingEvents;
+    // Operations
+  public:
+    Engine ();
+    Engine (std::shared_ptr<state::State> state);
+    EngineResult applyCommand (const std::string& json);
+    void setState (std::shared_ptr<state::State> state);
+    std::shared_ptr<state::State> getState ();
+    Phase getPhase ();
+    TurnContext getContext ();
+    bool consumeWagonCards (std::shared_ptr<playersState::Player> player, cardsState::ColorCard color, int count, bool allowLocomotives);
+    // Setters and Getters
+  };
+
+};
+
+#endif
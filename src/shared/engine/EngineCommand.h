@@ -0,0 +1,25 @@
+// Generated by dia2code
+#ifndef ENGINE__ENGINECOMMAND__H
+#define ENGINE__ENGINECOMMAND__H
+
+#include <string>
+
+namespace engine {
+  // Forward declaration
+  class StateMachine;
+}
+
+#include "EngineCommandType.h"
+#include "StateMachine.h"
+
+namespace engine {
+
+  struct EngineCommand {
+    EngineCommandType type;
+    std::string name;
+    std::string payload;
+  };
+
+};
+
+#endif
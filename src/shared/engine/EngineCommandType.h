@@ -0,0 +1,28 @@
+// Generated by dia2code
+#ifndef ENGINE__ENGINECOMMANDTYPE__H
+#define ENGINE__ENGINECOMMANDTYPE__H
+
+
+namespace engine {
+
+  /** EngineCommandType
+   * Enum - 
+   */
+  enum EngineCommandType {
+    CMD_UNKNOWN     = 0,
+    CMD_HELP     = 1,
+    CMD_EXIT     = 2,
+    CMD_TAKE_ROAD     = 3,
+    CMD_DRAW_DESTINATION     = 4,
+    CMD_DRAW_WAGON_FACEUP     = 5,
+    CMD_DRAW_WAGON_FACEDOWN     = 6,
+    CMD_SELECT_DESTINATION     = 7,
+    CMD_CLAIM_STATION     = 8,
+    CMD_BORROW_ROAD     = 9,
+    CMD_CONFIRM_ENDTURN     = 10,
+    CMD_TUNNEL_COLOR     = 11
+  };
+
+};
+
+#endif
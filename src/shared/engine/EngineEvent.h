@@ -0,0 +1,19 @@
+// Generated by dia2code
+#ifndef ENGINE__ENGINEEVENT__H
+#define ENGINE__ENGINEEVENT__H
+
+#include <string>
+
+#include "EngineEventType.h"
+
+namespace engine {
+
+  struct EngineEvent {
+    EngineEventType type;
+    std::string message;
+    std::string payload;
+  };
+
+};
+
+#endif
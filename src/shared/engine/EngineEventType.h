@@ -0,0 +1,20 @@
+// Generated by dia2code
+#ifndef ENGINE__ENGINEEVENTTYPE__H
+#define ENGINE__ENGINEEVENTTYPE__H
+
+
+namespace engine {
+
+  /** EngineEventType
+   * Enum - 
+   */
+  enum EngineEventType {
+    INFO     = 0,
+    STATE_CHANGE     = 1,
+    PROMPT     = 2,
+    ERROR     = 3
+  };
+
+};
+
+#endif
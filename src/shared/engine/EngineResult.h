@@ -0,0 +1,33 @@
+// Generated by dia2code
+#ifndef ENGINE__ENGINERESULT__H
+#define ENGINE__ENGINERESULT__H
+
+#include <string>
+#include <vector>
+
+namespace engine {
+  // Forward declaration
+  class EngineEvent;
+  // Forward declaration
+  class StateMachine;
+}
+
+#include "Phase.h"
+#include "EngineEvent.h"
+#include "StateMachine.h"
+
+namespace engine {
+
+  struct EngineResult {
+    bool ok;
+    std::string error;
+    Phase nextPhase;
+    std::vector<EngineEvent> events;
+    int activePlayerID;
+    bool needsInput;
+    std::vector<int> allowedCommands;
+  };
+
+};
+
+#endif
@@ -0,0 +1,37 @@
+// Generated by dia2code
+#ifndef ENGINE__FACEDOWNSTATE__H
+#define ENGINE__FACEDOWNSTATE__H
+
+#include <memory>
+
+namespace engine {
+  // Forward declaration
+  class Engine;
+  // Forward declaration
+  class EngineResult;
+  // Forward declaration
+  class EngineCommand;
+  // Forward declaration
+  class GameState;
+}
+
+#include "Engine.h"
+#include "EngineResult.h"
+#include "GameState.h"
+
+namespace engine {
+
+  /** FaceDownState
+   * Class - 
+   */
+  class FaceDownState : public engine::GameState {
+    // Operations
+  public:
+    void onEnter (std::shared_ptr<Engine> engine);
+    EngineResult handleCommand (std::shared_ptr<Engine> engine, const EngineCommand& command);
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,38 @@
+// Generated by dia2code
+#ifndef ENGINE__GAMESTATE__H
+#define ENGINE__GAMESTATE__H
+
+#include <memory>
+#include <vector>
+
+namespace engine {
+  // Forward declaration
+  class Engine;
+  // Forward declaration
+  class EngineResult;
+  // Forward declaration
+  class EngineCommand;
+}
+
+#include "Engine.h"
+#include "EngineResult.h"
+#include "EngineCommandType.h"
+
+namespace engine {
+
+  /** GameState
+   * Class - 
+   */
+  class GameState {
+    // Operations
+  public:
+    virtual void onEnter (std::shared_ptr<Engine> engine);
+    virtual void onExit (std::shared_ptr<Engine> engine);
+    virtual EngineResult handleCommand (std::shared_ptr<Engine> engine, const EngineCommand& command);
+    virtual std::vector<EngineCommandType> getAllowedCommands ();
+    // Setters and Getters
+  };
+
+};
+
+#endif
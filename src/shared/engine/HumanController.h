@@ -0,0 +1,44 @@
+// Generated by dia2code
+#ifndef ENGINE__HUMANCONTROLLER__H
+#define ENGINE__HUMANCONTROLLER__H
+
+#include <memory>
+
+namespace parser {
+  // Forward declaration
+  class CommandMessage;
+};
+namespace state {
+  // Forward declaration
+  class State;
+};
+namespace engine {
+  // Forward declaration
+  class Engine;
+  // Forward declaration
+  class EngineResult;
+  // Forward declaration
+  class PlayerController;
+}
+
+#include "parser/CommandMessage.h"
+#include "state/State.h"
+#include "Engine.h"
+#include "PlayerController.h"
+
+namespace engine {
+
+  /** HumanController
+   * Class - 
+   */
+  class HumanController : public engine::PlayerController {
+    // Operations
+  public:
+    parser::CommandMessage nextCommand (std::shared_ptr<state::State> state, std::shared_ptr<Engine> engine);
+    void notify (const EngineResult& result);
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by dia2code
+#ifndef ENGINE__PENDINGTICKETS__H
+#define ENGINE__PENDINGTICKETS__H
+
+#include <vector>
+#include <memory>
+
+namespace cardsState {
+  // Forward declaration
+  class DestinationCard;
+}
+
+#include "cardsState/DestinationCard.h"
+
+namespace engine {
+
+  struct PendingTickets {
+    std::vector<std::shared_ptr<cardsState::DestinationCard>> offered;
+  };
+
+};
+
+#endif
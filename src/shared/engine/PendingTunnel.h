@@ -0,0 +1,33 @@
+// Generated by dia2code
+#ifndef ENGINE__PENDINGTUNNEL__H
+#define ENGINE__PENDINGTUNNEL__H
+
+#include <memory>
+#include <vector>
+
+namespace mapState {
+  // Forward declaration
+  class Road;
+};
+namespace cardsState {
+  // Forward declaration
+  class WagonCard;
+}
+
+#include "mapState/Road.h"
+#include "mapState/RoadColor.h"
+#include "cardsState/WagonCard.h"
+
+namespace engine {
+
+  struct PendingTunnel {
+    std::shared_ptr<mapState::Road> route;
+    mapState::RoadColor color;
+    int baseLength;
+    int extraRequired;
+    std::vector<std::shared_ptr<cardsState::WagonCard>> revealed;
+  };
+
+};
+
+#endif
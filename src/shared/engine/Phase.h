@@ -0,0 +1,38 @@
+// Generated by dia2code
+#ifndef ENGINE__PHASE__H
+#define ENGINE__PHASE__H
+
+
+#include "EngineEventType.h"
+
+namespace engine {
+
+  /** Phase
+   * Enum - 
+   */
+  enum Phase {
+    INTRO     = 0,
+    PRINT_INSTRUCTIONS     = 1,
+    SETUP     = 2,
+    PLAYER_ANNOUNCE     = 3,
+    WAIT_TURN     = 4,
+    PLAYER_TURN     = 5,
+    DRAW_DESTINATION     = 6,
+    DESTINATION_CHOICE     = 7,
+    DRAW_WAGON     = 8,
+    DRAW_WAGON_FACEUP     = 9,
+    DRAW_WAGON_FACEDOWN     = 10,
+    CLAIM_ROAD     = 11,
+    ROAD_RESOLVE     = 12,
+    TUNNEL_RESOLVE     = 13,
+    CLAIM_STATION     = 14,
+    BORROW_ROAD     = 15,
+    CONFIRMATION     = 16,
+    END_TURN     = 17,
+    END_GAME     = 18,
+    EXIT     = 19
+  };
+
+};
+
+#endif
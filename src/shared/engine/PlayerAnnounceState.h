@@ -0,0 +1,31 @@
+// Generated by dia2code
+#ifndef ENGINE__PLAYERANNOUNCESTATE__H
+#define ENGINE__PLAYERANNOUNCESTATE__H
+
+#include <memory>
+
+namespace engine {
+  // Forward declaration
+  class Engine;
+  // Forward declaration
+  class GameState;
+}
+
+#include "Engine.h"
+#include "GameState.h"
+
+namespace engine {
+
+  /** PlayerAnnounceState
+   * Class - 
+   */
+  class PlayerAnnounceState : public engine::GameState {
+    // Operations
+  public:
+    void onEnter (std::shared_ptr<Engine> engine);
+    // Setters and Getters
+  };
+
+};
+
+#endif
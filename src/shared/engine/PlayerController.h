@@ -0,0 +1,44 @@
+// Generated by dia2code
+#ifndef ENGINE__PLAYERCONTROLLER__H
+#define ENGINE__PLAYERCONTROLLER__H
+
+#include <memory>
+
+namespace parser {
+  // Forward declaration
+  class CommandMessage;
+};
+namespace state {
+  // Forward declaration
+  class State;
+};
+namespace engine {
+  // Forward declaration
+  class Engine;
+  // Forward declaration
+  class EngineResult;
+}
+
+#include "parser/CommandMessage.h"
+#include "state/State.h"
+#include "Engine.h"
+
+namespace engine {
+
+  /** PlayerController
+   * Class - 
+   */
+  class PlayerController {
+    // Attributes
+  public:
+    int playerID;
+    // Operations
+  public:
+    virtual parser::CommandMessage nextCommand (std::shared_ptr<state::State> state, std::shared_ptr<Engine> engine);
+    virtual void notify (const EngineResult& result);
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,39 @@
+// Generated by dia2code
+#ifndef ENGINE__PLAYERTURNSTATE__H
+#define ENGINE__PLAYERTURNSTATE__H
+
+#include <memory>
+#include <vector>
+
+namespace engine {
+  // Forward declaration
+  class Engine;
+  // Forward declaration
+  class EngineResult;
+  // Forward declaration
+  class EngineCommand;
+  // Forward declaration
+  class GameState;
+}
+
+#include "Engine.h"
+#include "EngineResult.h"
+#include "GameState.h"
+
+namespace engine {
+
+  /** PlayerTurnState
+   * Class - 
+   */
+  class PlayerTurnState : public engine::GameState {
+    // Operations
+  public:
+    void onEnter (std::shared_ptr<Engine> engine);
+    std::vector<EngineCommandType> getAllowedCommands ();
+    EngineResult handleCommand (std::shared_ptr<Engine> engine, const EngineCommand& command);
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,31 @@
+// Generated by dia2code
+#ifndef ENGINE__PRINTINSTRUCTIONSSTATE__H
+#define ENGINE__PRINTINSTRUCTIONSSTATE__H
+
+#include <memory>
+
+namespace engine {
+  // Forward declaration
+  class Engine;
+  // Forward declaration
+  class GameState;
+}
+
+#include "Engine.h"
+#include "GameState.h"
+
+namespace engine {
+
+  /** PrintInstructionsState
+   * Class - 
+   */
+  class PrintInstructionsState : public engine::GameState {
+    // Operations
+  public:
+    virtual void onEnter (std::shared_ptr<Engine> engine);
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -225,7 +225,7 @@ namespace engine
     {
       return buildError(engine, "Road resolve: road not found");
     }
-    if (std::dynamic_pointer_cast<mapState::Tunnel>(road))
+    if (road->getKind() == mapState::RoadKind::TUNNEL)
     {
       return buildError(engine, "Road resolve: tunnel requires tunnel resolve");
     }
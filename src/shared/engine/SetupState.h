@@ -0,0 +1,31 @@
+// Generated by dia2code
+#ifndef ENGINE__SETUPSTATE__H
+#define ENGINE__SETUPSTATE__H
+
+#include <memory>
+
+namespace engine {
+  // Forward declaration
+  class Engine;
+  // Forward declaration
+  class GameState;
+}
+
+#include "Engine.h"
+#include "GameState.h"
+
+namespace engine {
+
+  /** SetupState
+   * Class - 
+   */
+  class SetupState : public engine::GameState {
+    // Operations
+  public:
+    void onEnter (std::shared_ptr<Engine> engine);
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,43 @@
+// Generated by dia2code
+#ifndef ENGINE__STATEMACHINE__H
+#define ENGINE__STATEMACHINE__H
+
+#include <memory>
+
+namespace engine {
+  // Forward declaration
+  class GameState;
+  // Forward declaration
+  class EngineResult;
+  // Forward declaration
+  class Engine;
+  // Forward declaration
+  class EngineCommand;
+}
+
+#include "GameState.h"
+#include "EngineResult.h"
+#include "Engine.h"
+
+namespace engine {
+
+  /** StateMachine
+   * Class - 
+   */
+  class StateMachine {
+    // Attributes
+  public:
+    std::shared_ptr<GameState> currentState;
+    // Operations
+  public:
+    StateMachine ();
+    void setState (std::shared_ptr<GameState> state);
+    std::shared_ptr<GameState> getState ();
+    EngineResult handleCommand (std::shared_ptr<Engine> engine, const EngineCommand& command);
+    void transitionTo (std::shared_ptr<Engine> engine,  std::shared_ptr<GameState> gamestate);
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -198,7 +198,7 @@ namespace engine
     {
       return buildError(engine, "Tunnel resolve: no pending tunnel");
     }
-    if (!std::dynamic_pointer_cast<mapState::Tunnel>(road))
+    if (road->getKind() != mapState::RoadKind::TUNNEL)
     {
       return buildError(engine, "Tunnel resolve: pending road is not a tunnel");
     }
@@ -0,0 +1,38 @@
+// Generated by dia2code
+#ifndef ENGINE__TURNCONTEXT__H
+#define ENGINE__TURNCONTEXT__H
+
+#include <vector>
+#include <memory>
+
+namespace engine {
+  // Forward declaration
+  class PendingTickets;
+  // Forward declaration
+  class PendingTunnel;
+  // Forward declaration
+  class PlayerController;
+}
+
+#include "PendingTickets.h"
+#include "PendingTunnel.h"
+#include "PlayerController.h"
+
+namespace engine {
+
+  struct TurnContext {
+    int currentPlayer;
+    std::vector<std::shared_ptr<PlayerController>> controllers;
+    int drawsRemaining;
+    int turnNumber;
+    bool finalRound;
+    int finalRoundStarter;
+    int minKeepTickets;
+    PendingTickets pendingTickets;
+    PendingTunnel pendingTunnel;
+    int drawSource;
+  };
+
+};
+
+#endif
@@ -0,0 +1,27 @@
+// Generated by dia2code
+#ifndef __MAPSTATE__H
+#define __MAPSTATE__H
+
+#include "mapState/RoadColor.h"
+#include "mapState/RoadKind.h"
+#include "mapState/Road.h"
+#include "mapState/Station.h"
+#include "mapState/MapTopology.h"
+#include "mapState/TicketWatch.h"
+#include "mapState/ChokepointAnalysis.h"
+#include "mapState/TicketTable.h"
+#include "mapState/NetworkDistances.h"
+#include "mapState/MapFork.h"
+#include "mapState/IdSpan.h"
+#include "mapState/Path.h"
+#include "mapState/MapState.h"
+#include "mapState/StationBorrowing.h"
+#include "mapState/MapImage.h"
+#include "mapState/LongestRoute.h"
+#include "mapState/WorkerPool.h"
+#include "mapState/SearchScratch.h"
+#include "mapState/SpurSearch.h"
+#include "mapState/MapGenerator.h"
+#include "mapState/Tunnel.h"
+#include "mapState/Ferry.h"
+#endif
@@ -0,0 +1,136 @@
+#include "ChokepointAnalysis.h"
+#include "MapTopology.h"
+#include <algorithm>
+#include <numeric>
+
+namespace mapState
+{
+    // iterative Tarjan over the roads enabled in network. Double routes are separate edges and only the
+    // road a station was entered by is skipped, so a double route is never reported as a bridge
+    void ChokepointAnalysis::build(const MapTopology &topology, const std::vector<bool> &network)
+    {
+        const std::size_t n = topology.stationNames.size();
+        this->network = network;
+        this->entry.assign(n, -1);
+        this->exit.assign(n, -1);
+        this->low.assign(n, 0);
+        this->component.assign(n, -1);
+        this->bridgeRoads.clear();
+        this->bridgeChildren.clear();
+        std::vector<int> cutStations;
+        std::vector<int> cutChildren;
+
+        struct Frame
+        {
+            int station;
+            int viaRoad;
+            int edge;
+        };
+        std::vector<Frame> stack;
+        int timer = 0;
+        for (std::size_t root = 0; root < n; ++root)
+        {
+            if (this->entry[root] >= 0)
+            {
+                continue;
+            }
+            this->entry[root] = this->low[root] = timer++;
+            this->component[root] = static_cast<int>(root);
+            stack.push_back(Frame{static_cast<int>(root), -1, topology.adjacencyOffsets[root]});
+            while (!stack.empty())
+            {
+                Frame &frame = stack.back();
+                if (frame.edge < topology.adjacencyOffsets[frame.station + 1])
+                {
+                    int e = frame.edge++;
+                    int road = topology.adjacencyRoads[e];
+                    if (!network[static_cast<std::size_t>(road)] || road == frame.viaRoad)
+                    {
+                        continue;
+                    }
+                    int next = topology.adjacencyTargets[e];
+                    if (this->entry[next] < 0)
+                    {
+                        this->entry[next] = this->low[next] = timer++;
+                        this->component[next] = static_cast<int>(root);
+                        stack.push_back(Frame{next, road, topology.adjacencyOffsets[next]});
+                    }
+                    else
+                    {
+                        this->low[frame.station] = std::min(this->low[frame.station], this->entry[next]);
+                    }
+                    continue;
+                }
+                int finished = frame.station;
+                int viaRoad = frame.viaRoad;
+                this->exit[finished] = timer;
+                stack.pop_back();
+                if (stack.empty())
+                {
+                    continue;
+                }
+                int parent = stack.back().station;
+                this->low[parent] = std::min(this->low[parent], this->low[finished]);
+                if (this->low[finished] > this->entry[parent])
+                {
+                    this->bridgeRoads.push_back(viaRoad);
+                    this->bridgeChildren.push_back(finished);
+                }
+                if (this->low[finished] >= this->entry[parent])
+                {
+                    cutStations.push_back(parent);
+                    cutChildren.push_back(finished);
+                }
+            }
+        }
+
+        // blocks of the same cut station next to each other, so a station is read as one run
+        std::vector<std::size_t> order(cutStations.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) { return cutStations[a] < cutStations[b]; });
+        this->cutStations.clear();
+        this->cutChildren.clear();
+        for (std::size_t i : order)
+        {
+            this->cutStations.push_back(cutStations[i]);
+            this->cutChildren.push_back(cutChildren[i]);
+        }
+    }
+
+    // whether station sits in the DFS subtree of root
+    bool ChokepointAnalysis::isBelow(int root, int station) const
+    {
+        return this->entry[static_cast<std::size_t>(root)] <= this->entry[static_cast<std::size_t>(station)]
+               && this->entry[static_cast<std::size_t>(station)] < this->exit[static_cast<std::size_t>(root)];
+    }
+
+    // whether losing the bridge disconnects the two stations
+    bool ChokepointAnalysis::separatesAtBridge(std::size_t bridge, int stationA, int stationB) const
+    {
+        if (this->component[static_cast<std::size_t>(stationA)] != this->component[static_cast<std::size_t>(stationB)])
+        {
+            return false;
+        }
+        int child = this->bridgeChildren[bridge];
+        return this->isBelow(child, stationA) != this->isBelow(child, stationB);
+    }
+
+    // whether losing the cut station of blocks [first, last) disconnects the two stations: they lie in
+    // different blocks, the rest of the network counting as one more block
+    bool ChokepointAnalysis::separatesAtCut(std::size_t first, std::size_t last, int stationA, int stationB) const
+    {
+        int cut = this->cutStations[first];
+        if (stationA == cut || stationB == cut || this->component[static_cast<std::size_t>(stationA)] != this->component[static_cast<std::size_t>(stationB)])
+        {
+            return false;
+        }
+        int blockA = -1;
+        int blockB = -1;
+        for (std::size_t i = first; i < last; ++i)
+        {
+            blockA = this->isBelow(this->cutChildren[i], stationA) ? static_cast<int>(i) : blockA;
+            blockB = this->isBelow(this->cutChildren[i], stationB) ? static_cast<int>(i) : blockB;
+        }
+        return blockA != blockB;
+    }
+}
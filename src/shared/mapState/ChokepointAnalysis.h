@@ -0,0 +1,51 @@
+// Generated by dia2code
+#ifndef MAPSTATE__CHOKEPOINTANALYSIS__H
+#define MAPSTATE__CHOKEPOINTANALYSIS__H
+
+#include <vector>
+#include <cstdlib>
+
+namespace mapState {
+  // Forward declaration
+  class MapTopology;
+}
+
+namespace mapState {
+
+  /** ChokepointAnalysis
+   * Class - 
+   * Tarjan bridges and cut stations of one player's usable network (own, borrowed and still claimable roads), read against their tickets
+   */
+  class ChokepointAnalysis {
+    // Attributes
+  public:
+    /// roads the analysis was built on
+    std::vector<bool> network;
+    /// DFS entry time of each station
+    std::vector<int> entry;
+    /// first entry time after the subtree of each station, so x is below s when entry[s] <= entry[x] < exit[s]
+    std::vector<int> exit;
+    std::vector<int> low;
+    /// root station of the DFS tree each station belongs to
+    std::vector<int> component;
+    std::vector<int> bridgeRoads;
+    /// station on the far side of each bridge, cut off with its subtree
+    std::vector<int> bridgeChildren;
+    /// cut station of every separated block, sorted by station
+    std::vector<int> cutStations;
+    /// DFS child heading each block that its cut station separates
+    std::vector<int> cutChildren;
+    int epoch;
+    std::size_t borrowedCount;
+    // Operations
+  public:
+    void build (const MapTopology& topology, const std::vector<bool>& network);
+    bool isBelow (int root, int station) const;
+    bool separatesAtBridge (std::size_t bridge, int stationA, int stationB) const;
+    bool separatesAtCut (std::size_t first, std::size_t last, int stationA, int stationB) const;
+    // Setters and Getters
+  };
+
+};
+
+#endif
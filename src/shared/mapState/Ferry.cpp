@@ -21,7 +21,7 @@ namespace mapState
         this->locomotives = -1;
     }
 
-    Ferry::Ferry(int id, std::shared_ptr<playersState::Player> owner, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, int locomotives, int length, std::shared_ptr<boost::adjacency_list<>::edge_descriptor> edge) : Road(id, owner, stationA, stationB, RoadColor::NONE, length, edge)
+    Ferry::Ferry(int id, std::shared_ptr<playersState::Player> owner, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, int locomotives, int length, boost::adjacency_list<>::edge_descriptor edge) : Road(id, owner, stationA, stationB, RoadColor::NONE, length, edge)
     {
         DEBUG_PRINT("Parent constructor finished :");
 
@@ -34,8 +34,7 @@ namespace mapState
     {
         DEBUG_PRINT("Ferry creation started ...");
         std::shared_ptr<playersState::Player> owner = nullptr;
-        std::shared_ptr<boost::adjacency_list<>::edge_descriptor> edge = std::make_shared<boost::adjacency_list<>::edge_descriptor>(
-            boost::add_edge(*(stationA->getVertex().get()), *(stationB->getVertex().get()), *gameGraph).first);
+        boost::adjacency_list<>::edge_descriptor edge = boost::add_edge(stationA->getVertex(), stationB->getVertex(), *gameGraph).first;
         return Ferry(id, owner, stationA, stationB, locomotives, length, edge);
         DEBUG_PRINT("Ferry " << this->id << " created !");
     }
@@ -58,6 +57,10 @@ namespace mapState
         std::string indentation(indent, '\t');
         std::cout << indentation << "Locomotives: " << this->locomotives << std::endl;
     }
+    RoadKind Ferry::getKind()
+    {
+        return RoadKind::FERRY;
+    }
     int Ferry::getLocomotives()
     {
         return this->locomotives;
@@ -81,9 +84,7 @@ namespace mapState
             std::shared_ptr<playersState::Player> owner = std::get<1>(detail);
             int locomotives = std::get<2>(detail);
             int length = std::get<3>(detail);
-            std::shared_ptr<boost::adjacency_list<>::edge_descriptor> edgeDescriptor =
-                std::make_shared<boost::adjacency_list<>::edge_descriptor>(
-                    boost::add_edge(*(stationA->getVertex().get()), *(stationB->getVertex().get()), *gameGraph).first);
+            boost::adjacency_list<>::edge_descriptor edgeDescriptor = boost::add_edge(stationA->getVertex(), stationB->getVertex(), *gameGraph).first;
             tunnels.push_back(std::make_shared<Ferry>(id, owner, stationA, stationB, locomotives, length, edgeDescriptor));
         }
         DEBUG_PRINT("Ferry BatchConstructor finished !");
@@ -0,0 +1,58 @@
+// Generated by dia2code
+#ifndef MAPSTATE__FERRY__H
+#define MAPSTATE__FERRY__H
+
+#include <memory>
+#include <vector>
+#include <utility>
+#include <tuple>
+#include <string>
+
+namespace playersState {
+  // Forward declaration
+  class Player;
+};
+namespace mapState {
+  // Forward declaration
+  class Station;
+  // Forward declaration
+  class Ferry;
+  // Forward declaration
+  class Road;
+}
+
+#include "playersState/Player.h"
+#include "Station.h"
+#include "RoadKind.h"
+#include "Road.h"
+
+namespace mapState {
+
+  /** Ferry
+   * Class - 
+   */
+  class Ferry : public mapState::Road {
+    // Attributes
+  public:
+    int locomotives;
+    // Operations
+  public:
+    Ferry ();
+    Ferry (int id, std::shared_ptr<playersState::Player> owner, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, int locomotives, int length, boost::adjacency_list<>::edge_descriptor edge);
+    static Ferry Init (int id, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, int locomotives, int length, std::shared_ptr<boost::adjacency_list<>> gameGraph);
+    ~Ferry ();
+    void display (int indent = 0);
+    void _display (int indent = 0);
+    RoadKind getKind ();
+    int getLocomotives ();
+    static std::vector<std::shared_ptr<Ferry>> BatchConstructor (std::vector<std::pair<std::pair<std::shared_ptr<Station>,std::shared_ptr<Station>>,std::tuple<int, std::shared_ptr<playersState::Player>,int,int>>> tunnelsInfos, std::shared_ptr<boost::adjacency_list<>> gameGraph);
+    static std::pair<std::pair<std::shared_ptr<Station>,std::shared_ptr<Station>>,std::tuple<int, std::shared_ptr<playersState::Player>, int, int>> genData (std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, int id, std::shared_ptr<playersState::Player> owner, int locomotives, int length);
+    static std::pair<std::pair<std::shared_ptr<Station>,std::shared_ptr<Station>>,std::tuple<int, std::shared_ptr<playersState::Player>, int, int>> initData (std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, int id, int locomotives, int length);
+    static std::pair<std::pair<std::shared_ptr<Station>,std::shared_ptr<Station>>,std::tuple<int, std::shared_ptr<playersState::Player>, int, int>> genDataByName (std::vector<std::shared_ptr<Station>> stations, const std::string & stationAName, const std::string & stationBName, int id, std::shared_ptr<playersState::Player> owner, int locomotives, int length);
+    static std::pair<std::pair<std::shared_ptr<Station>,std::shared_ptr<Station>>,std::tuple<int, std::shared_ptr<playersState::Player>, int, int>> initDataByName (std::vector<std::shared_ptr<Station>> stations, const std::string & stationAName, const std::string & stationBName, int id, int locomotives, int length);
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,29 @@
+#include "IdSpan.h"
+
+namespace mapState
+{
+    const int *IdSpan::begin() const
+    {
+        return this->first;
+    }
+
+    const int *IdSpan::end() const
+    {
+        return this->last;
+    }
+
+    std::size_t IdSpan::size() const
+    {
+        return static_cast<std::size_t>(this->last - this->first);
+    }
+
+    bool IdSpan::empty() const
+    {
+        return this->first == this->last;
+    }
+
+    int IdSpan::operator[](std::size_t index) const
+    {
+        return this->first[index];
+    }
+}
@@ -0,0 +1,30 @@
+// Generated by dia2code
+#ifndef MAPSTATE__IDSPAN__H
+#define MAPSTATE__IDSPAN__H
+
+#include <cstdlib>
+
+namespace mapState {
+
+  /** IdSpan
+   * Class - 
+   * read-only range of ids inside a MapState table, valid until the map is rebuilt
+   */
+  class IdSpan {
+    // Attributes
+  public:
+    const int* first;
+    const int* last;
+    // Operations
+  public:
+    const int* begin () const;
+    const int* end () const;
+    std::size_t size () const;
+    bool empty () const;
+    int operator[] (std::size_t index) const;
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,227 @@
+#include "LongestRoute.h"
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <unordered_map>
+
+#define DEBUG_MODE false
+#if DEBUG_MODE == true
+#define DEBUG
+#define DEBUG_PRINT(x) std::cout << x << std::endl
+#else
+#define DEBUG_PRINT(x)
+#endif
+
+namespace mapState
+{
+    namespace {
+
+        // memo entries kept per component before the search stops caching new states
+        const std::size_t kMaxMemoEntries = 1 << 21;
+
+        // edges of one component renumbered locally, incidence lists per local vertex
+        struct ComponentGraph
+        {
+            std::vector<int> lengths;
+            std::vector<int> edgeA;
+            std::vector<int> edgeB;
+            std::vector<std::vector<int>> incident;
+        };
+
+        int findRoot(std::vector<int> &parents, int vertex)
+        {
+            while (parents[static_cast<std::size_t>(vertex)] != vertex)
+            {
+                parents[static_cast<std::size_t>(vertex)] = parents[static_cast<std::size_t>(parents[static_cast<std::size_t>(vertex)])];
+                vertex = parents[static_cast<std::size_t>(vertex)];
+            }
+            return vertex;
+        }
+
+        // longest extension of a trail standing on vertex with the edges in used already taken,
+        // memoized on (vertex, used) since the answer does not depend on how we got there
+        int extendWithMask(const ComponentGraph &graph, int vertex, std::uint64_t used,
+                           std::vector<std::unordered_map<std::uint64_t, int>> &memo, std::size_t &memoSize)
+        {
+            std::unordered_map<std::uint64_t, int>::const_iterator it = memo[static_cast<std::size_t>(vertex)].find(used);
+            if (it != memo[static_cast<std::size_t>(vertex)].end())
+            {
+                return it->second;
+            }
+            int best = 0;
+            for (int edge : graph.incident[static_cast<std::size_t>(vertex)])
+            {
+                std::uint64_t bit = std::uint64_t(1) << edge;
+                if (used & bit)
+                {
+                    continue;
+                }
+                int next = graph.edgeA[static_cast<std::size_t>(edge)] == vertex ? graph.edgeB[static_cast<std::size_t>(edge)] : graph.edgeA[static_cast<std::size_t>(edge)];
+                best = std::max(best, graph.lengths[static_cast<std::size_t>(edge)] + extendWithMask(graph, next, used | bit, memo, memoSize));
+            }
+            if (memoSize < kMaxMemoEntries)
+            {
+                memo[static_cast<std::size_t>(vertex)].emplace(used, best);
+                ++memoSize;
+            }
+            return best;
+        }
+
+        // same search for components too large for a 64 bit edge mask, without memoization
+        int extendWithFlags(const ComponentGraph &graph, int vertex, std::vector<char> &used)
+        {
+            int best = 0;
+            for (int edge : graph.incident[static_cast<std::size_t>(vertex)])
+            {
+                if (used[static_cast<std::size_t>(edge)])
+                {
+                    continue;
+                }
+                used[static_cast<std::size_t>(edge)] = 1;
+                int next = graph.edgeA[static_cast<std::size_t>(edge)] == vertex ? graph.edgeB[static_cast<std::size_t>(edge)] : graph.edgeA[static_cast<std::size_t>(edge)];
+                best = std::max(best, graph.lengths[static_cast<std::size_t>(edge)] + extendWithFlags(graph, next, used));
+                used[static_cast<std::size_t>(edge)] = 0;
+            }
+            return best;
+        }
+
+    }
+
+    int LongestRoute::solve(const std::vector<int> &endpointsA, const std::vector<int> &endpointsB, const std::vector<int> &lengths)
+    {
+        int best = 0;
+        for (const std::vector<int> &component : LongestRoute::splitComponents(endpointsA, endpointsB))
+        {
+            best = std::max(best, LongestRoute::solveComponent(component, endpointsA, endpointsB, lengths));
+        }
+        return best;
+    }
+
+    // groups edge indexes by connected component, edges with a negative endpoint are dropped
+    std::vector<std::vector<int>> LongestRoute::splitComponents(const std::vector<int> &endpointsA, const std::vector<int> &endpointsB)
+    {
+        int maxVertex = -1;
+        for (std::size_t e = 0; e < endpointsA.size(); ++e)
+        {
+            maxVertex = std::max(maxVertex, std::max(endpointsA[e], endpointsB[e]));
+        }
+        std::vector<int> parents(static_cast<std::size_t>(maxVertex + 1));
+        for (std::size_t v = 0; v < parents.size(); ++v)
+        {
+            parents[v] = static_cast<int>(v);
+        }
+        for (std::size_t e = 0; e < endpointsA.size(); ++e)
+        {
+            if (endpointsA[e] < 0 || endpointsB[e] < 0)
+            {
+                continue;
+            }
+            parents[static_cast<std::size_t>(findRoot(parents, endpointsA[e]))] = findRoot(parents, endpointsB[e]);
+        }
+
+        std::vector<std::vector<int>> components;
+        std::unordered_map<int, std::size_t> componentOfRoot;
+        for (std::size_t e = 0; e < endpointsA.size(); ++e)
+        {
+            if (endpointsA[e] < 0 || endpointsB[e] < 0)
+            {
+                continue;
+            }
+            int root = findRoot(parents, endpointsA[e]);
+            std::unordered_map<int, std::size_t>::const_iterator it = componentOfRoot.find(root);
+            if (it == componentOfRoot.end())
+            {
+                it = componentOfRoot.emplace(root, components.size()).first;
+                components.push_back(std::vector<int>());
+            }
+            components[it->second].push_back(static_cast<int>(e));
+        }
+        return components;
+    }
+
+    // longest trail (each edge used at most once, stations may repeat) inside one connected component
+    int LongestRoute::solveComponent(const std::vector<int> &edges, const std::vector<int> &endpointsA, const std::vector<int> &endpointsB, const std::vector<int> &lengths)
+    {
+        ComponentGraph graph;
+        std::unordered_map<int, int> localVertex;
+        int total = 0;
+        for (int edge : edges)
+        {
+            int ends[2] = {endpointsA[static_cast<std::size_t>(edge)], endpointsB[static_cast<std::size_t>(edge)]};
+            int local[2];
+            for (int i = 0; i < 2; ++i)
+            {
+                std::unordered_map<int, int>::const_iterator it = localVertex.find(ends[i]);
+                if (it == localVertex.end())
+                {
+                    it = localVertex.emplace(ends[i], static_cast<int>(graph.incident.size())).first;
+                    graph.incident.push_back(std::vector<int>());
+                }
+                local[i] = it->second;
+            }
+            int index = static_cast<int>(graph.lengths.size());
+            graph.lengths.push_back(lengths[static_cast<std::size_t>(edge)]);
+            graph.edgeA.push_back(local[0]);
+            graph.edgeB.push_back(local[1]);
+            graph.incident[static_cast<std::size_t>(local[0])].push_back(index);
+            if (local[1] != local[0])
+            {
+                graph.incident[static_cast<std::size_t>(local[1])].push_back(index);
+            }
+            total += lengths[static_cast<std::size_t>(edge)];
+        }
+
+        // a trail that cannot be extended starts on an odd degree station unless it is closed, and a
+        // closed one that cannot be extended covers the whole component: with 0 or 2 odd stations an
+        // Euler trail takes every road, otherwise only odd stations need to be tried as starts
+        std::vector<int> starts;
+        for (std::size_t v = 0; v < graph.incident.size(); ++v)
+        {
+            std::size_t degree = graph.incident[v].size();
+            for (int edge : graph.incident[v])
+            {
+                if (graph.edgeA[static_cast<std::size_t>(edge)] == graph.edgeB[static_cast<std::size_t>(edge)])
+                {
+                    ++degree;
+                }
+            }
+            if (degree % 2 == 1)
+            {
+                starts.push_back(static_cast<int>(v));
+            }
+        }
+        if (starts.size() <= 2)
+        {
+            return total;
+        }
+
+        int best = 0;
+        if (graph.lengths.size() <= 64)
+        {
+            std::vector<std::unordered_map<std::uint64_t, int>> memo(graph.incident.size());
+            std::size_t memoSize = 0;
+            for (int start : starts)
+            {
+                best = std::max(best, extendWithMask(graph, start, 0, memo, memoSize));
+                if (best == total)
+                {
+                    break;
+                }
+            }
+        }
+        else
+        {
+            std::vector<char> used(graph.lengths.size(), 0);
+            for (int start : starts)
+            {
+                best = std::max(best, extendWithFlags(graph, start, used));
+                if (best == total)
+                {
+                    break;
+                }
+            }
+        }
+        DEBUG_PRINT("LongestRoute component of " << edges.size() << " roads solved: " << best);
+        return best;
+    }
+}
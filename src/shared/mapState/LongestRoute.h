@@ -0,0 +1,24 @@
+// Generated by dia2code
+#ifndef MAPSTATE__LONGESTROUTE__H
+#define MAPSTATE__LONGESTROUTE__H
+
+#include <vector>
+
+namespace mapState {
+
+  /** LongestRoute
+   * Class - 
+   * exact longest continuous route (European Express bonus) over a set of roads
+   */
+  class LongestRoute {
+    // Operations
+  public:
+    static int solve (const std::vector<int>& endpointsA, const std::vector<int>& endpointsB, const std::vector<int>& lengths);
+    static std::vector<std::vector<int>> splitComponents (const std::vector<int>& endpointsA, const std::vector<int>& endpointsB);
+    static int solveComponent (const std::vector<int>& edges, const std::vector<int>& endpointsA, const std::vector<int>& endpointsB, const std::vector<int>& lengths);
+    // Setters and Getters
+  };
+
+};
+
+#endif
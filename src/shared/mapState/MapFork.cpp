@@ -0,0 +1,281 @@
+#include "MapFork.h"
+#include "Road.h"
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <queue>
+
+#define DEBUG_MODE false
+#if DEBUG_MODE == true
+#define DEBUG
+#define DEBUG_PRINT(x) std::cout << x << std::endl
+#else
+#define DEBUG_PRINT(x)
+#endif
+
+namespace mapState
+{
+    namespace {
+
+        const int kUnreachable = std::numeric_limits<int>::max() / 4;
+
+    }
+
+    MapFork::MapFork(std::shared_ptr<const MapTopology> topology, std::shared_ptr<const std::vector<int>> baseOwners,
+                     std::shared_ptr<const std::vector<std::shared_ptr<playersState::Player>>> ownerTable)
+        : topology(topology), baseOwners(baseOwners), ownerTable(ownerTable)
+    {
+    }
+
+    // another independent view on top of this one; only the claims made so far are copied
+    MapFork MapFork::fork() const
+    {
+        return *this;
+    }
+
+    std::shared_ptr<const MapTopology> MapFork::getTopology() const
+    {
+        return this->topology;
+    }
+
+    // owner of the road in this view, -1 when it is free or out of range
+    int MapFork::getOwnerSlot(int road) const
+    {
+        if (road < 0 || static_cast<std::size_t>(road) >= this->baseOwners->size())
+        {
+            return -1;
+        }
+        std::unordered_map<int, int>::const_iterator changed = this->ownerChanges.find(road);
+        return changed != this->ownerChanges.end() ? changed->second : (*this->baseOwners)[static_cast<std::size_t>(road)];
+    }
+
+    std::shared_ptr<playersState::Player> MapFork::getOwner(int road) const
+    {
+        int slot = this->getOwnerSlot(road);
+        if (slot < 0)
+        {
+            return nullptr;
+        }
+        if (static_cast<std::size_t>(slot) < this->ownerTable->size())
+        {
+            return (*this->ownerTable)[static_cast<std::size_t>(slot)];
+        }
+        return this->addedOwners[static_cast<std::size_t>(slot) - this->ownerTable->size()];
+    }
+
+    // gives the road to player in this view only (nullptr frees it); the live map is left untouched
+    void MapFork::claimRoad(int road, std::shared_ptr<playersState::Player> player)
+    {
+        if (road < 0 || static_cast<std::size_t>(road) >= this->baseOwners->size())
+        {
+            return;
+        }
+        int slot = this->findOwnerSlot(player);
+        if (player && slot < 0)
+        {
+            slot = static_cast<int>(this->ownerTable->size() + this->addedOwners.size());
+            this->addedOwners.push_back(player);
+        }
+        if (slot == (*this->baseOwners)[static_cast<std::size_t>(road)])
+        {
+            this->ownerChanges.erase(road);
+        }
+        else
+        {
+            this->ownerChanges[road] = slot;
+        }
+    }
+
+    // same rules as MapState::isRoadClaimable, read against this view's owners
+    bool MapFork::isRoadClaimable(int road, int nbPlayers, std::shared_ptr<playersState::Player> player) const
+    {
+        if (road < 0 || static_cast<std::size_t>(road) >= this->baseOwners->size() || this->getOwnerSlot(road) >= 0)
+        {
+            return false;
+        }
+        int group = this->topology->parallelGroupOf[static_cast<std::size_t>(road)];
+        if (group < 0)
+        {
+            return true;
+        }
+        for (int i = this->topology->parallelGroupOffsets[group]; i < this->topology->parallelGroupOffsets[group + 1]; ++i)
+        {
+            int sibling = this->topology->parallelGroupRoads[i];
+            if (sibling == road || this->getOwnerSlot(sibling) < 0)
+            {
+                continue;
+            }
+            if (nbPlayers <= 3)
+            {
+                return false;
+            }
+            if (player && this->getOwner(sibling)->getColor() == player->getColor())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::vector<int> MapFork::getClaimableRoads(int nbPlayers, std::shared_ptr<playersState::Player> player) const
+    {
+        std::vector<int> claimable;
+        for (std::size_t r = 0; r < this->baseOwners->size(); ++r)
+        {
+            if (this->isRoadClaimable(static_cast<int>(r), nbPlayers, player))
+            {
+                claimable.push_back(static_cast<int>(r));
+            }
+        }
+        return claimable;
+    }
+
+    // whether the player's own and borrowed roads in this view join the two stations
+    bool MapFork::isDestinationReached(std::shared_ptr<playersState::Player> player, int stationA, int stationB) const
+    {
+        const std::size_t n = this->topology->stationNames.size();
+        if (!player || stationA < 0 || stationB < 0 || static_cast<std::size_t>(stationA) >= n || static_cast<std::size_t>(stationB) >= n)
+        {
+            return false;
+        }
+        std::vector<int> weights = this->computeRoadWeights(player);
+        std::vector<char> seen(n, 0);
+        std::vector<int> queue = {stationA};
+        seen[static_cast<std::size_t>(stationA)] = 1;
+        for (std::size_t head = 0; head < queue.size(); ++head)
+        {
+            int current = queue[head];
+            if (current == stationB)
+            {
+                return true;
+            }
+            for (int e = this->topology->adjacencyOffsets[current]; e < this->topology->adjacencyOffsets[current + 1]; ++e)
+            {
+                int next = this->topology->adjacencyTargets[e];
+                if (weights[static_cast<std::size_t>(this->topology->adjacencyRoads[e])] == 0 && !seen[static_cast<std::size_t>(next)])
+                {
+                    seen[static_cast<std::size_t>(next)] = 1;
+                    queue.push_back(next);
+                }
+            }
+        }
+        return false;
+    }
+
+    // wagons (or roads when useRoadLength is false) still to lay between the stations in this view, -1 when cut off
+    int MapFork::getStationDistance(std::shared_ptr<playersState::Player> player, int stationA, int stationB, bool useRoadLength) const
+    {
+        const std::size_t n = this->topology->stationNames.size();
+        if (stationA < 0 || stationB < 0 || static_cast<std::size_t>(stationA) >= n || static_cast<std::size_t>(stationB) >= n)
+        {
+            return -1;
+        }
+        std::vector<int> weights = this->computeRoadWeights(player);
+        std::vector<int> distances(n, kUnreachable);
+        typedef std::pair<int, int> QueueEntry;
+        std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+        distances[static_cast<std::size_t>(stationA)] = 0;
+        queue.push(QueueEntry(0, stationA));
+        while (!queue.empty())
+        {
+            QueueEntry top = queue.top();
+            queue.pop();
+            int current = top.second;
+            if (current == stationB)
+            {
+                return top.first;
+            }
+            if (top.first > distances[static_cast<std::size_t>(current)])
+            {
+                continue;
+            }
+            for (int e = this->topology->adjacencyOffsets[current]; e < this->topology->adjacencyOffsets[current + 1]; ++e)
+            {
+                int weight = weights[static_cast<std::size_t>(this->topology->adjacencyRoads[e])];
+                if (weight == kUnreachable)
+                {
+                    continue;
+                }
+                if (!useRoadLength && weight > 0)
+                {
+                    weight = 1;
+                }
+                int next = this->topology->adjacencyTargets[e];
+                if (top.first + weight < distances[static_cast<std::size_t>(next)])
+                {
+                    distances[static_cast<std::size_t>(next)] = top.first + weight;
+                    queue.push(QueueEntry(top.first + weight, next));
+                }
+            }
+        }
+        return -1;
+    }
+
+    // roads whose owner differs from the map the view was forked from
+    std::size_t MapFork::getChangeCount() const
+    {
+        return this->ownerChanges.size();
+    }
+
+    // owners are matched by pointer first, then by name, like the live map does
+    int MapFork::findOwnerSlot(std::shared_ptr<playersState::Player> player) const
+    {
+        if (!player)
+        {
+            return -1;
+        }
+        const std::size_t shared = this->ownerTable->size();
+        for (std::size_t i = 0; i < shared + this->addedOwners.size(); ++i)
+        {
+            if ((i < shared ? (*this->ownerTable)[i] : this->addedOwners[i - shared]) == player)
+            {
+                return static_cast<int>(i);
+            }
+        }
+        for (std::size_t i = 0; i < shared + this->addedOwners.size(); ++i)
+        {
+            if ((i < shared ? (*this->ownerTable)[i] : this->addedOwners[i - shared])->getName() == player->getName())
+            {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    // own and borrowed roads are free, opponents' roads are cut, free roads cost their length (whole map when player is null)
+    std::vector<int> MapFork::computeRoadWeights(std::shared_ptr<playersState::Player> player) const
+    {
+        std::vector<int> weights(this->topology->roadLengths);
+        if (!player)
+        {
+            return weights;
+        }
+        // sweep the shared owners, then patch the roads this view changed
+        const int self = this->findOwnerSlot(player);
+        const std::vector<int> &owners = *this->baseOwners;
+        const std::vector<int> &lengths = this->topology->roadLengths;
+        for (std::size_t r = 0; r < weights.size(); ++r)
+        {
+            weights[r] = owners[r] < 0 ? lengths[r] : (owners[r] == self ? 0 : kUnreachable);
+        }
+        for (const std::pair<const int, int> &change : this->ownerChanges)
+        {
+            std::size_t r = static_cast<std::size_t>(change.first);
+            weights[r] = change.second < 0 ? lengths[r] : (change.second == self ? 0 : kUnreachable);
+        }
+        for (const std::shared_ptr<Road> &road : player->getBorrowedRoads())
+        {
+            int id = road ? road->getId() : -1;
+            if (id < 0 || static_cast<std::size_t>(id) >= this->topology->roadIdSlots.size())
+            {
+                continue;
+            }
+            int slot = this->topology->roadIdSlots[static_cast<std::size_t>(id)];
+            if (slot >= 0)
+            {
+                weights[static_cast<std::size_t>(slot)] = 0;
+            }
+        }
+        return weights;
+    }
+}
@@ -0,0 +1,59 @@
+// Generated by dia2code
+#ifndef MAPSTATE__MAPFORK__H
+#define MAPSTATE__MAPFORK__H
+
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include <cstdlib>
+
+namespace mapState {
+  // Forward declaration
+  class MapTopology;
+  // Forward declaration
+  class MapFork;
+};
+namespace playersState {
+  // Forward declaration
+  class Player;
+}
+
+#include "MapTopology.h"
+#include "playersState/Player.h"
+
+namespace mapState {
+
+  /** MapFork
+   * Class - 
+   * copy-on-write view of a map's road owners for what-if searches: shares the board and the owners at fork time, records only its own claims; each copy can go to its own thread
+   */
+  class MapFork {
+    // Attributes
+  private:
+    std::shared_ptr<const MapTopology> topology;
+    std::shared_ptr<const std::vector<int>> baseOwners;
+    std::shared_ptr<const std::vector<std::shared_ptr<playersState::Player>>> ownerTable;
+    std::vector<std::shared_ptr<playersState::Player>> addedOwners;
+    std::unordered_map<int,int> ownerChanges;
+    // Operations
+  public:
+    MapFork (std::shared_ptr<const MapTopology> topology, std::shared_ptr<const std::vector<int>> baseOwners, std::shared_ptr<const std::vector<std::shared_ptr<playersState::Player>>> ownerTable);
+    MapFork fork () const;
+    std::shared_ptr<const MapTopology> getTopology () const;
+    int getOwnerSlot (int road) const;
+    std::shared_ptr<playersState::Player> getOwner (int road) const;
+    void claimRoad (int road, std::shared_ptr<playersState::Player> player);
+    bool isRoadClaimable (int road, int nbPlayers, std::shared_ptr<playersState::Player> player) const;
+    std::vector<int> getClaimableRoads (int nbPlayers, std::shared_ptr<playersState::Player> player) const;
+    bool isDestinationReached (std::shared_ptr<playersState::Player> player, int stationA, int stationB) const;
+    int getStationDistance (std::shared_ptr<playersState::Player> player, int stationA, int stationB, bool useRoadLength) const;
+    std::size_t getChangeCount () const;
+  private:
+    int findOwnerSlot (std::shared_ptr<playersState::Player> player) const;
+    std::vector<int> computeRoadWeights (std::shared_ptr<playersState::Player> player) const;
+    // Setters and Getters
+  };
+
+};
+
+#endif
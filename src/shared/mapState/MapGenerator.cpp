@@ -0,0 +1,250 @@
+#include "MapGenerator.h"
+#include <json/json.h>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#define DEBUG_MODE false
+#if DEBUG_MODE == true
+#define DEBUG
+#define DEBUG_PRINT(x) std::cout << x << std::endl
+#else
+#define DEBUG_PRINT(x)
+#endif
+
+namespace mapState
+{
+    namespace {
+
+        // per mille odds, tuned on the Europe board: about three roads per station, one in ten a tunnel,
+        // one in twenty a ferry and a few double routes
+        const int kGridRoadOdds = 620;
+        const int kDiagonalRoadOdds = 120;
+        const int kDoubleRoadOdds = 80;
+        const int kTunnelOdds = 100;
+        const int kFerryOdds = 50;
+        const int kGreyOdds = 250;
+
+        // road lengths weighted like the printed boards: mostly 2 to 4, a few long hauls
+        const int kLengthValues[] = {1, 2, 3, 4, 5, 6, 8};
+        const int kLengthWeights[] = {8, 27, 27, 25, 6, 5, 2};
+
+        const char *const kColorNames[] = {"RED", "BLUE", "GREEN", "BLACK", "YELLOW", "ORANGE", "PINK", "WHITE"};
+
+        // portable draws, so a seed gives the same map with any standard library
+        int draw(std::mt19937 &random, int bound)
+        {
+            return static_cast<int>(random() % static_cast<unsigned int>(bound));
+        }
+
+        bool chance(std::mt19937 &random, int perMille)
+        {
+            return draw(random, 1000) < perMille;
+        }
+
+        int drawLength(std::mt19937 &random)
+        {
+            int total = 0;
+            for (int weight : kLengthWeights)
+            {
+                total += weight;
+            }
+            int pick = draw(random, total);
+            for (std::size_t i = 0; i < sizeof(kLengthWeights) / sizeof(kLengthWeights[0]); ++i)
+            {
+                if (pick < kLengthWeights[i])
+                {
+                    return kLengthValues[i];
+                }
+                pick -= kLengthWeights[i];
+            }
+            return kLengthValues[0];
+        }
+
+        int findRoot(std::vector<int> &parents, int station)
+        {
+            while (parents[static_cast<std::size_t>(station)] != station)
+            {
+                parents[static_cast<std::size_t>(station)] = parents[static_cast<std::size_t>(parents[static_cast<std::size_t>(station)])];
+                station = parents[static_cast<std::size_t>(station)];
+            }
+            return station;
+        }
+
+        bool unite(std::vector<int> &parents, int a, int b)
+        {
+            int rootA = findRoot(parents, a);
+            int rootB = findRoot(parents, b);
+            if (rootA == rootB)
+            {
+                return false;
+            }
+            parents[static_cast<std::size_t>(rootB)] = rootA;
+            return true;
+        }
+
+        std::string stationName(int station)
+        {
+            return "st" + std::to_string(station);
+        }
+
+        struct Builder
+        {
+            std::mt19937 random;
+            Json::Value roads;
+            int nextId;
+
+            explicit Builder(unsigned int seed) : random(seed), roads(Json::arrayValue), nextId(1) {}
+
+            void addRoad(int a, int b, int length, const char *type, const char *color)
+            {
+                Json::Value road(Json::objectValue);
+                road["id"] = nextId++;
+                road["stationA"] = stationName(a);
+                road["stationB"] = stationName(b);
+                road["length"] = length;
+                road["type"] = type;
+                if (color)
+                {
+                    road["color"] = color;
+                }
+                roads.append(road);
+            }
+
+            const char *drawColor()
+            {
+                if (chance(random, kGreyOdds))
+                {
+                    return "NONE";
+                }
+                return kColorNames[draw(random, 8)];
+            }
+
+            // one connection between neighbouring stations, picking its kind like the printed boards do
+            void connect(int a, int b, int length)
+            {
+                int kind = draw(random, 1000);
+                if (kind < kFerryOdds)
+                {
+                    Json::Value ferry(Json::objectValue);
+                    ferry["id"] = nextId++;
+                    ferry["stationA"] = stationName(a);
+                    ferry["stationB"] = stationName(b);
+                    ferry["length"] = length;
+                    ferry["type"] = "FERRY";
+                    ferry["locomotives"] = length >= 4 && chance(random, 500) ? 2 : 1;
+                    roads.append(ferry);
+                    return;
+                }
+                if (kind < kFerryOdds + kTunnelOdds)
+                {
+                    addRoad(a, b, length, "TUNNEL", drawColor());
+                    return;
+                }
+                const char *color = drawColor();
+                addRoad(a, b, length, "ROAD", color);
+                if (chance(random, kDoubleRoadOdds))
+                {
+                    const char *second = drawColor();
+                    while (std::string(second) == color)
+                    {
+                        second = drawColor();
+                    }
+                    addRoad(a, b, length, "ROAD", second);
+                }
+            }
+        };
+
+    }
+
+    // stations sit on a square grid; roads join grid neighbours and some diagonals,
+    // then dropped grid links are put back wherever they join two separate networks
+    std::string MapGenerator::generate(int stationCount, unsigned int seed)
+    {
+        int count = stationCount < 2 ? 2 : stationCount;
+        int width = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(count))));
+        Builder builder(seed);
+
+        Json::Value root(Json::objectValue);
+        root["mapName"] = "synthetic_" + std::to_string(count) + "_" + std::to_string(seed);
+        Json::Value stations(Json::arrayValue);
+        for (int s = 0; s < count; ++s)
+        {
+            stations.append(stationName(s));
+        }
+        root["stations"] = stations;
+
+        std::vector<int> parents(static_cast<std::size_t>(count));
+        for (int s = 0; s < count; ++s)
+        {
+            parents[static_cast<std::size_t>(s)] = s;
+        }
+        std::vector<std::pair<int, int>> dropped;
+
+        for (int s = 0; s < count; ++s)
+        {
+            int column = s % width;
+            int right = column + 1 < width && s + 1 < count ? s + 1 : -1;
+            int down = s + width < count ? s + width : -1;
+            int diagonal = right >= 0 && s + width + 1 < count ? s + width + 1 : -1;
+            int antiDiagonal = column > 0 && s + width - 1 < count ? s + width - 1 : -1;
+
+            for (int next : {right, down})
+            {
+                if (next < 0)
+                {
+                    continue;
+                }
+                if (chance(builder.random, kGridRoadOdds))
+                {
+                    builder.connect(s, next, drawLength(builder.random));
+                    unite(parents, s, next);
+                }
+                else
+                {
+                    dropped.emplace_back(s, next);
+                }
+            }
+            for (int next : {diagonal, antiDiagonal})
+            {
+                if (next >= 0 && chance(builder.random, kDiagonalRoadOdds))
+                {
+                    builder.connect(s, next, std::min(drawLength(builder.random) + 1, 8));
+                    unite(parents, s, next);
+                }
+            }
+        }
+
+        // the full grid is connected, so restoring bridging links leaves a single network
+        for (const std::pair<int, int> &link : dropped)
+        {
+            if (unite(parents, link.first, link.second))
+            {
+                builder.connect(link.first, link.second, drawLength(builder.random));
+            }
+        }
+
+        root["roads"] = builder.roads;
+        DEBUG_PRINT("MapGenerator: " << count << " stations, " << builder.roads.size() << " roads");
+
+        Json::StreamWriterBuilder writer;
+        writer["commentStyle"] = "None";
+        writer["indentation"] = "";
+        return Json::writeString(writer, root);
+    }
+
+    bool MapGenerator::generateFile(int stationCount, unsigned int seed, const std::string &path)
+    {
+        std::ofstream file(path.c_str(), std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            return false;
+        }
+        std::string json = generate(stationCount, seed);
+        file.write(json.data(), static_cast<std::streamsize>(json.size()));
+        return static_cast<bool>(file);
+    }
+}
@@ -0,0 +1,23 @@
+// Generated by dia2code
+#ifndef MAPSTATE__MAPGENERATOR__H
+#define MAPSTATE__MAPGENERATOR__H
+
+#include <string>
+
+namespace mapState {
+
+  /** MapGenerator
+   * Class - 
+   * synthetic maps in the JSON schema ParseFromJSON reads, for scaling tests and benchmarks
+   */
+  class MapGenerator {
+    // Operations
+  public:
+    static std::string generate (int stationCount, unsigned int seed);
+    static bool generateFile (int stationCount, unsigned int seed, const std::string& path);
+    // Setters and Getters
+  };
+
+};
+
+#endif
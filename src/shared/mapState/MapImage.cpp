@@ -0,0 +1,578 @@
+#include "MapImage.h"
+#include "MapTopology.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+#include <json/json.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define DEBUG_MODE false
+#if DEBUG_MODE == true
+#define DEBUG
+#define DEBUG_PRINT(x) std::cout << x << std::endl
+#else
+#define DEBUG_PRINT(x)
+#endif
+
+namespace mapState
+{
+    int MapImage::formatVersion = 1;
+
+    namespace {
+
+        const char kMagic[8] = {'T', 'T', 'R', 'M', 'A', 'P', 'I', '\0'};
+        // written as is, reads back differently on a machine of the other byte order
+        const std::uint32_t kByteOrderMark = 0x01020304u;
+        const std::uint64_t kFnvOffset = 1469598103934665603ull;
+        const std::uint64_t kFnvPrime = 1099511628211ull;
+
+        // road kinds, in the order MapState stores them
+        const int kKindRoad = 0;
+        const int kKindTunnel = 1;
+        const int kKindFerry = 2;
+
+        struct ImageHeader
+        {
+            char magic[8];
+            std::uint32_t byteOrder;
+            std::uint32_t version;
+            std::uint32_t stationCount;
+            std::uint32_t roadCount;
+            std::uint32_t stringBytes;
+            std::uint32_t reserved;
+            std::uint64_t checksum;
+        };
+
+        // strings are (offset, length) pairs into the pool that follows the records
+        struct StationRecord
+        {
+            std::uint32_t name;
+            std::uint32_t nameLength;
+            std::uint32_t owner;
+            std::uint32_t ownerLength;
+            std::int32_t row;
+            std::int32_t column;
+            std::uint32_t nickname;
+            std::uint32_t nicknameLength;
+        };
+
+        struct RoadRecord
+        {
+            std::int32_t id;
+            std::uint32_t stationA;
+            std::uint32_t stationB;
+            std::int32_t length;
+            std::int32_t color;
+            std::int32_t kind;
+            std::int32_t locomotives;
+            std::uint32_t owner;
+            std::uint32_t ownerLength;
+        };
+
+        static_assert(sizeof(ImageHeader) == 40, "map image header layout changed");
+        static_assert(sizeof(StationRecord) == 32, "map image station layout changed");
+        static_assert(sizeof(RoadRecord) == 36, "map image road layout changed");
+
+        const StationRecord &stationRecord(const char *data, int station)
+        {
+            return reinterpret_cast<const StationRecord *>(data + sizeof(ImageHeader))[station];
+        }
+
+        const RoadRecord &roadRecord(const char *data, int road)
+        {
+            const ImageHeader *header = reinterpret_cast<const ImageHeader *>(data);
+            return reinterpret_cast<const RoadRecord *>(data + sizeof(ImageHeader) + header->stationCount * sizeof(StationRecord))[road];
+        }
+
+        std::string poolString(const char *data, std::uint32_t offset, std::uint32_t length)
+        {
+            const ImageHeader *header = reinterpret_cast<const ImageHeader *>(data);
+            const char *pool = data + sizeof(ImageHeader) + header->stationCount * sizeof(StationRecord) + header->roadCount * sizeof(RoadRecord);
+            return std::string(pool + offset, length);
+        }
+
+        bool inPool(const ImageHeader &header, std::uint32_t offset, std::uint32_t length)
+        {
+            return static_cast<std::uint64_t>(offset) + length <= header.stringBytes;
+        }
+
+        // the getters index without checks, so every record has to point inside the image
+        bool validRecords(const char *data)
+        {
+            const ImageHeader &header = *reinterpret_cast<const ImageHeader *>(data);
+            for (std::uint32_t s = 0; s < header.stationCount; ++s)
+            {
+                const StationRecord &record = stationRecord(data, static_cast<int>(s));
+                if (!inPool(header, record.name, record.nameLength) || !inPool(header, record.owner, record.ownerLength) ||
+                    !inPool(header, record.nickname, record.nicknameLength))
+                {
+                    return false;
+                }
+            }
+            for (std::uint32_t r = 0; r < header.roadCount; ++r)
+            {
+                const RoadRecord &record = roadRecord(data, static_cast<int>(r));
+                if (record.stationA >= header.stationCount || record.stationB >= header.stationCount ||
+                    record.kind < kKindRoad || record.kind > kKindFerry || !inPool(header, record.owner, record.ownerLength))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        std::string readString(const Json::Value &node, const char *key)
+        {
+            if (node.isMember(key) && node[key].isString())
+            {
+                return node[key].asString();
+            }
+            return std::string();
+        }
+
+        int readInt(const Json::Value &node, const char *key, int fallback)
+        {
+            if (node.isMember(key) && node[key].isInt())
+            {
+                return node[key].asInt();
+            }
+            return fallback;
+        }
+
+        bool parseDocument(const std::string &text, Json::Value &root)
+        {
+            Json::CharReaderBuilder builder;
+            builder["collectComments"] = false;
+            std::string error;
+            std::istringstream input(text);
+            if (!Json::parseFromStream(builder, input, &root, &error))
+            {
+                return false;
+            }
+            // state files keep the map under a "map" member
+            if (root.isObject() && root.isMember("map") && root["map"].isObject())
+            {
+                Json::Value map = root["map"];
+                root = map;
+            }
+            return root.isObject();
+        }
+
+        RoadColor parseColor(const Json::Value &value)
+        {
+            if (value.isInt())
+            {
+                return static_cast<RoadColor>(value.asInt());
+            }
+            if (!value.isString())
+            {
+                return RoadColor::UNKNOWN;
+            }
+            static const std::unordered_map<std::string, RoadColor> colors = {
+                {"none", RoadColor::NONE}, {"red", RoadColor::RED}, {"blue", RoadColor::BLUE},
+                {"green", RoadColor::GREEN}, {"black", RoadColor::BLACK}, {"yellow", RoadColor::YELLOW},
+                {"orange", RoadColor::ORANGE}, {"pink", RoadColor::PINK}, {"white", RoadColor::WHITE}};
+            std::unordered_map<std::string, RoadColor>::const_iterator it = colors.find(MapTopology::normalizeName(value.asString()));
+            return it == colors.end() ? RoadColor::UNKNOWN : it->second;
+        }
+
+        std::pair<std::uint32_t, std::uint32_t> addString(std::string &pool, const std::string &value)
+        {
+            std::pair<std::uint32_t, std::uint32_t> entry(static_cast<std::uint32_t>(pool.size()), static_cast<std::uint32_t>(value.size()));
+            pool += value;
+            return entry;
+        }
+
+        // same reading rules as MapState::ParseFromJSON; entries naming unknown stations are dropped
+        void collectRoads(const Json::Value &entries, const char *defaultType, const std::unordered_map<std::string, int> &stationIndex,
+                          int &nextId, std::vector<RoadRecord> &records, std::vector<std::string> &owners)
+        {
+            if (!entries.isArray())
+            {
+                return;
+            }
+            for (Json::ArrayIndex i = 0; i < entries.size(); ++i)
+            {
+                const Json::Value &entry = entries[i];
+                if (!entry.isObject())
+                {
+                    continue;
+                }
+                std::string from = readString(entry, "from");
+                if (from.empty())
+                {
+                    from = readString(entry, "stationA");
+                }
+                std::string to = readString(entry, "to");
+                if (to.empty())
+                {
+                    to = readString(entry, "stationB");
+                }
+                std::unordered_map<std::string, int>::const_iterator a = stationIndex.find(MapTopology::normalizeName(from));
+                std::unordered_map<std::string, int>::const_iterator b = stationIndex.find(MapTopology::normalizeName(to));
+                if (from.empty() || to.empty() || a == stationIndex.end() || b == stationIndex.end())
+                {
+                    continue;
+                }
+
+                bool hasId = entry.isMember("id") && entry["id"].isInt();
+                int id = hasId ? entry["id"].asInt() : nextId;
+                if (!hasId)
+                {
+                    ++nextId;
+                }
+                else if (id >= nextId)
+                {
+                    nextId = id + 1;
+                }
+
+                std::string type = readString(entry, "type");
+                if (type.empty())
+                {
+                    type = readString(entry, "roadType");
+                }
+                type = MapTopology::normalizeName(type.empty() ? std::string(defaultType) : type);
+
+                RoadRecord record;
+                std::memset(&record, 0, sizeof(record));
+                record.id = id;
+                record.stationA = static_cast<std::uint32_t>(a->second);
+                record.stationB = static_cast<std::uint32_t>(b->second);
+                record.length = readInt(entry, "length", 0);
+                record.color = static_cast<std::int32_t>(entry.isMember("color") ? parseColor(entry["color"]) : RoadColor::UNKNOWN);
+                record.kind = kKindRoad;
+                if (type == "tunnel")
+                {
+                    record.kind = kKindTunnel;
+                }
+                else if (type == "ferry")
+                {
+                    record.kind = kKindFerry;
+                    record.locomotives = readInt(entry, "locomotives", 0);
+                    if (record.locomotives == 0)
+                    {
+                        record.locomotives = readInt(entry, "locos", 0);
+                    }
+                }
+                records.push_back(record);
+                owners.push_back(readString(entry, "owner"));
+            }
+        }
+
+    }
+
+    MapImage::MapImage() : mapping(), size(0)
+    {
+    }
+
+    // maps the image read-only and checks its header, checksum and records; false leaves the image closed
+    bool MapImage::open(const std::string &path)
+    {
+        this->close();
+        int descriptor = ::open(path.c_str(), O_RDONLY);
+        if (descriptor < 0)
+        {
+            return false;
+        }
+        struct stat info;
+        if (fstat(descriptor, &info) != 0 || static_cast<std::size_t>(info.st_size) < sizeof(ImageHeader))
+        {
+            ::close(descriptor);
+            return false;
+        }
+        std::size_t length = static_cast<std::size_t>(info.st_size);
+        void *address = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        ::close(descriptor);
+        if (address == MAP_FAILED)
+        {
+            return false;
+        }
+        std::shared_ptr<const char> mapped(static_cast<const char *>(address), [length](const char *data) {
+            munmap(const_cast<char *>(data), length);
+        });
+
+        const ImageHeader *header = reinterpret_cast<const ImageHeader *>(mapped.get());
+        if (std::memcmp(header->magic, kMagic, sizeof(kMagic)) != 0 || header->byteOrder != kByteOrderMark)
+        {
+            // layouts and JSON maps go through here too, they are simply not images
+            DEBUG_PRINT(path << " is not a map image");
+            return false;
+        }
+        if (header->version != static_cast<std::uint32_t>(MapImage::formatVersion))
+        {
+            std::cerr << "Error: map image " << path << " has format version " << header->version
+                      << ", expected " << MapImage::formatVersion << std::endl;
+            return false;
+        }
+        std::size_t expected = sizeof(ImageHeader) + header->stationCount * sizeof(StationRecord) + header->roadCount * sizeof(RoadRecord) + header->stringBytes;
+        if (expected != length || MapImage::checksum(mapped.get() + sizeof(ImageHeader), length - sizeof(ImageHeader)) != header->checksum)
+        {
+            std::cerr << "Error: map image " << path << " is corrupted" << std::endl;
+            return false;
+        }
+        if (!validRecords(mapped.get()))
+        {
+            std::cerr << "Error: map image " << path << " has records pointing outside of it" << std::endl;
+            return false;
+        }
+        this->mapping = mapped;
+        this->size = length;
+        DEBUG_PRINT("Map image " << path << " opened: " << header->stationCount << " stations, " << header->roadCount << " roads");
+        return true;
+    }
+
+    void MapImage::close()
+    {
+        this->mapping.reset();
+        this->size = 0;
+    }
+
+    bool MapImage::isOpen() const
+    {
+        return this->mapping != nullptr;
+    }
+
+    // builds the image of a map JSON (as read by MapState::ParseFromJSON); the TUI layout of each station
+    // comes from layoutJson when given, from the map itself otherwise. Stations no road reaches are refused
+    bool MapImage::compile(const std::string &mapJson, const std::string &layoutJson, std::string &image)
+    {
+        Json::Value root;
+        if (!parseDocument(mapJson, root) || !root.isMember("stations") || !root["stations"].isArray())
+        {
+            return false;
+        }
+        Json::Value layoutRoot = root;
+        if (!layoutJson.empty() && !parseDocument(layoutJson, layoutRoot))
+        {
+            return false;
+        }
+        std::unordered_map<std::string, Json::Value> layouts;
+        if (layoutRoot.isMember("stations") && layoutRoot["stations"].isArray())
+        {
+            for (Json::ArrayIndex i = 0; i < layoutRoot["stations"].size(); ++i)
+            {
+                const Json::Value &entry = layoutRoot["stations"][i];
+                if (entry.isObject() && !readString(entry, "name").empty())
+                {
+                    layouts[MapTopology::normalizeName(readString(entry, "name"))] = entry;
+                }
+            }
+        }
+
+        std::string pool;
+        std::vector<StationRecord> stations;
+        std::unordered_map<std::string, int> stationIndex;
+        for (Json::ArrayIndex i = 0; i < root["stations"].size(); ++i)
+        {
+            const Json::Value &entry = root["stations"][i];
+            std::string name = entry.isString() ? entry.asString() : (entry.isObject() ? readString(entry, "name") : std::string());
+            if (name.empty())
+            {
+                continue;
+            }
+            name = MapTopology::normalizeName(name);
+            StationRecord record;
+            std::memset(&record, 0, sizeof(record));
+            std::pair<std::uint32_t, std::uint32_t> text = addString(pool, name);
+            record.name = text.first;
+            record.nameLength = text.second;
+            text = addString(pool, entry.isObject() ? readString(entry, "owner") : std::string());
+            record.owner = text.first;
+            record.ownerLength = text.second;
+            record.row = -1;
+            record.column = -1;
+            std::unordered_map<std::string, Json::Value>::const_iterator layout = layouts.find(name);
+            if (layout != layouts.end())
+            {
+                record.row = readInt(layout->second, "TUIrow", -1);
+                record.column = readInt(layout->second, "TUIcolumn", -1);
+                text = addString(pool, readString(layout->second, "TUInickname"));
+                record.nickname = text.first;
+                record.nicknameLength = text.second;
+            }
+            stationIndex[name] = static_cast<int>(stations.size());
+            stations.push_back(record);
+        }
+
+        std::vector<RoadRecord> roads;
+        std::vector<std::string> owners;
+        int nextId = 1;
+        collectRoads(root["roads"], "ROAD", stationIndex, nextId, roads, owners);
+        collectRoads(root["tunnels"], "TUNNEL", stationIndex, nextId, roads, owners);
+        collectRoads(root["ferries"], "FERRY", stationIndex, nextId, roads, owners);
+        for (std::size_t r = 0; r < roads.size(); ++r)
+        {
+            std::pair<std::uint32_t, std::uint32_t> text = addString(pool, owners[r]);
+            roads[r].owner = text.first;
+            roads[r].ownerLength = text.second;
+        }
+        // MapState keeps plain roads first, then tunnels, then ferries
+        std::stable_sort(roads.begin(), roads.end(), [](const RoadRecord &left, const RoadRecord &right) {
+            return left.kind < right.kind;
+        });
+
+        std::vector<int> degrees(stations.size(), 0);
+        for (const RoadRecord &road : roads)
+        {
+            ++degrees[road.stationA];
+            ++degrees[road.stationB];
+        }
+        if (stations.empty() || std::find(degrees.begin(), degrees.end(), 0) != degrees.end())
+        {
+            std::cerr << "Error: map has isolated stations, no image written" << std::endl;
+            return false;
+        }
+
+        ImageHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.byteOrder = kByteOrderMark;
+        header.version = static_cast<std::uint32_t>(MapImage::formatVersion);
+        header.stationCount = static_cast<std::uint32_t>(stations.size());
+        header.roadCount = static_cast<std::uint32_t>(roads.size());
+        header.stringBytes = static_cast<std::uint32_t>(pool.size());
+
+        image.assign(reinterpret_cast<const char *>(&header), sizeof(header));
+        image.append(reinterpret_cast<const char *>(stations.data()), stations.size() * sizeof(StationRecord));
+        image.append(reinterpret_cast<const char *>(roads.data()), roads.size() * sizeof(RoadRecord));
+        image.append(pool);
+        header.checksum = MapImage::checksum(image.data() + sizeof(header), image.size() - sizeof(header));
+        image.replace(0, sizeof(header), reinterpret_cast<const char *>(&header), sizeof(header));
+        return true;
+    }
+
+    bool MapImage::compileFile(const std::string &mapPath, const std::string &layoutPath, const std::string &imagePath)
+    {
+        std::ifstream mapFile(mapPath.c_str());
+        if (!mapFile.is_open())
+        {
+            std::cerr << "Error: cannot read " << mapPath << std::endl;
+            return false;
+        }
+        std::stringstream mapText;
+        mapText << mapFile.rdbuf();
+        std::stringstream layoutText;
+        if (!layoutPath.empty())
+        {
+            std::ifstream layoutFile(layoutPath.c_str());
+            if (!layoutFile.is_open())
+            {
+                std::cerr << "Error: cannot read " << layoutPath << std::endl;
+                return false;
+            }
+            layoutText << layoutFile.rdbuf();
+        }
+
+        std::string image;
+        if (!MapImage::compile(mapText.str(), layoutText.str(), image))
+        {
+            return false;
+        }
+        std::ofstream output(imagePath.c_str(), std::ios::binary | std::ios::trunc);
+        output.write(image.data(), static_cast<std::streamsize>(image.size()));
+        return static_cast<bool>(output);
+    }
+
+    // 64 bit FNV-1a
+    std::uint64_t MapImage::checksum(const char *data, std::size_t size)
+    {
+        std::uint64_t hash = kFnvOffset;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            hash ^= static_cast<unsigned char>(data[i]);
+            hash *= kFnvPrime;
+        }
+        return hash;
+    }
+
+    int MapImage::getStationCount() const
+    {
+        return this->isOpen() ? static_cast<int>(reinterpret_cast<const ImageHeader *>(this->mapping.get())->stationCount) : 0;
+    }
+
+    int MapImage::getRoadCount() const
+    {
+        return this->isOpen() ? static_cast<int>(reinterpret_cast<const ImageHeader *>(this->mapping.get())->roadCount) : 0;
+    }
+
+    std::string MapImage::getStationName(int station) const
+    {
+        const StationRecord &record = stationRecord(this->mapping.get(), station);
+        return poolString(this->mapping.get(), record.name, record.nameLength);
+    }
+
+    // empty when the station has no owner
+    std::string MapImage::getStationOwner(int station) const
+    {
+        const StationRecord &record = stationRecord(this->mapping.get(), station);
+        return poolString(this->mapping.get(), record.owner, record.ownerLength);
+    }
+
+    // TUI position of the station, -1 when the layout did not place it
+    int MapImage::getStationRow(int station) const
+    {
+        return stationRecord(this->mapping.get(), station).row;
+    }
+
+    int MapImage::getStationColumn(int station) const
+    {
+        return stationRecord(this->mapping.get(), station).column;
+    }
+
+    std::string MapImage::getStationNickname(int station) const
+    {
+        const StationRecord &record = stationRecord(this->mapping.get(), station);
+        return poolString(this->mapping.get(), record.nickname, record.nicknameLength);
+    }
+
+    int MapImage::getRoadId(int road) const
+    {
+        return roadRecord(this->mapping.get(), road).id;
+    }
+
+    // endpoints are station indexes of the image
+    int MapImage::getRoadStationA(int road) const
+    {
+        return static_cast<int>(roadRecord(this->mapping.get(), road).stationA);
+    }
+
+    int MapImage::getRoadStationB(int road) const
+    {
+        return static_cast<int>(roadRecord(this->mapping.get(), road).stationB);
+    }
+
+    int MapImage::getRoadLength(int road) const
+    {
+        return roadRecord(this->mapping.get(), road).length;
+    }
+
+    RoadColor MapImage::getRoadColor(int road) const
+    {
+        return static_cast<RoadColor>(roadRecord(this->mapping.get(), road).color);
+    }
+
+    // 0 for a plain road, 1 for a tunnel, 2 for a ferry
+    int MapImage::getRoadKind(int road) const
+    {
+        return roadRecord(this->mapping.get(), road).kind;
+    }
+
+    int MapImage::getRoadLocomotives(int road) const
+    {
+        return roadRecord(this->mapping.get(), road).locomotives;
+    }
+
+    std::string MapImage::getRoadOwner(int road) const
+    {
+        const RoadRecord &record = roadRecord(this->mapping.get(), road);
+        return poolString(this->mapping.get(), record.owner, record.ownerLength);
+    }
+}
@@ -0,0 +1,56 @@
+// Generated by dia2code
+#ifndef MAPSTATE__MAPIMAGE__H
+#define MAPSTATE__MAPIMAGE__H
+
+#include <memory>
+#include <cstdlib>
+#include <string>
+#include <cstdint>
+
+#include "RoadColor.h"
+
+namespace mapState {
+
+  /** MapImage
+   * Class - 
+   * compiled binary map: fixed-size station and road records plus a string pool, memory mapped read-only and checked against its version and checksum
+   */
+  class MapImage {
+    // Attributes
+  public:
+    /// bumped whenever the record layout changes, older images are rejected
+    static int formatVersion;
+  private:
+    /// whole file, unmapped when the last copy goes away
+    std::shared_ptr<const char> mapping;
+    std::size_t size;
+    // Operations
+  public:
+    MapImage ();
+    bool open (const std::string& path);
+    void close ();
+    bool isOpen () const;
+    static bool compile (const std::string& mapJson, const std::string& layoutJson, std::string& image);
+    static bool compileFile (const std::string& mapPath, const std::string& layoutPath, const std::string& imagePath);
+    static std::uint64_t checksum (const char* data, std::size_t size);
+    int getStationCount () const;
+    int getRoadCount () const;
+    std::string getStationName (int station) const;
+    std::string getStationOwner (int station) const;
+    int getStationRow (int station) const;
+    int getStationColumn (int station) const;
+    std::string getStationNickname (int station) const;
+    int getRoadId (int road) const;
+    int getRoadStationA (int road) const;
+    int getRoadStationB (int road) const;
+    int getRoadLength (int road) const;
+    RoadColor getRoadColor (int road) const;
+    int getRoadKind (int road) const;
+    int getRoadLocomotives (int road) const;
+    std::string getRoadOwner (int road) const;
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -5,6 +5,17 @@
 #include "Road.h"
 #include "Tunnel.h"
 #include "Ferry.h"
+#include "LongestRoute.h"
+#include "StationBorrowing.h"
+#include "ChokepointAnalysis.h"
+#include "TicketTable.h"
+#include "NetworkDistances.h"
+#include "WorkerPool.h"
+#include "SearchScratch.h"
+#include "SpurSearch.h"
+#include "MapImage.h"
+#include "cardsState/PlayerCards.h"
+#include "cardsState/WagonCard.h"
 #include <iostream>
 #include <algorithm>
 #include <iomanip>
@@ -14,8 +25,11 @@
 #include <memory>
 #include <map>
 #include <queue>
+#include <deque>
+#include <set>
+#include <limits>
+#include <functional>
 #include <sstream>
-#include <algorithm>
 #include <cctype>
 #include <cstdlib>
 #include <json/json.h>
@@ -47,31 +61,63 @@ namespace mapState
 
     namespace {
 
-        std::string trimString(const std::string& value)
+        // above this size the all-pairs tables would not fit comfortably, queries run one search instead
+        const std::size_t kMaxDistanceTableStations = 2048;
+        const int kUnreachable = std::numeric_limits<int>::max();
+
+        // hand-aware weights are counted in hundredths of a card
+        const int kCardCost = 100;
+        // extra price of a coloured card missing from the hand: one draw
+        const int kMissingCardCost = 100;
+        // whole price of a locomotive missing from the hand: the turn spent taking one face up
+        const int kMissingLocomotiveCost = 200;
+        // a tunnel reveals three cards, each asking for one more card with the odds of the full deck
+        const int kTunnelRevealedCards = 3;
+
+        // wagon card colour that pays for a road of this colour, UNKNOWN for grey roads
+        cardsState::ColorCard cardColorOf(RoadColor color)
         {
-            std::size_t start = 0;
-            while (start < value.size() && std::isspace(static_cast<unsigned char>(value[start])))
-            {
-                ++start;
-            }
-            std::size_t end = value.size();
-            while (end > start && std::isspace(static_cast<unsigned char>(value[end - 1])))
+            switch (color)
             {
-                --end;
+            case RoadColor::RED:
+                return cardsState::ColorCard::RED;
+            case RoadColor::BLUE:
+                return cardsState::ColorCard::BLUE;
+            case RoadColor::GREEN:
+                return cardsState::ColorCard::GREEN;
+            case RoadColor::BLACK:
+                return cardsState::ColorCard::BLACK;
+            case RoadColor::YELLOW:
+                return cardsState::ColorCard::YELLOW;
+            case RoadColor::ORANGE:
+                return cardsState::ColorCard::ORANGE;
+            case RoadColor::PINK:
+                return cardsState::ColorCard::PINK;
+            case RoadColor::WHITE:
+                return cardsState::ColorCard::WHITE;
+            default:
+                return cardsState::ColorCard::UNKNOWN;
             }
-            return value.substr(start, end - start);
         }
 
-        std::string normalizeName(const std::string& value)
+        // a road mask is empty (every road) or holds one flag per road slot; anything else is rejected
+        bool checkRoadMask(const std::vector<bool> &roadMask, std::size_t roadCount, const char *query)
         {
-            std::string trimmed = trimString(value);
-            std::string lower = trimmed;
-            std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) {
-                return static_cast<char>(std::tolower(c));
-            });
-            return lower;
+            if (roadMask.empty() || roadMask.size() == roadCount)
+            {
+                return true;
+            }
+            std::cerr << "Error: " << query << " got a road mask of " << roadMask.size() << " entries for " << roadCount << " roads" << std::endl;
+            return false;
         }
 
+        // road kinds stored in a MapImage
+        const int kImageKindTunnel = 1;
+        const int kImageKindFerry = 2;
+
+        // a single search on a board takes a few microseconds, waking the workers only pays off for larger batches
+        const std::size_t kMinParallelSources = 8;
+
         std::string toUpper(const std::string& value)
         {
             std::string out = value;
@@ -226,9 +272,18 @@ namespace mapState
             return playersState->getPlayerByName(ownerName);
         }
 
+        // stations by normalized name, so road entries resolve their endpoints without scanning the station list
+        std::shared_ptr<mapState::Station> findIndexedStation(
+            const std::unordered_map<std::string, std::shared_ptr<mapState::Station>>& stationIndex,
+            const std::string& name)
+        {
+            std::unordered_map<std::string, std::shared_ptr<mapState::Station>>::const_iterator found = stationIndex.find(name);
+            return found == stationIndex.end() ? nullptr : found->second;
+        }
+
         void parseRoadEntry(
             const Json::Value& entry,
-            const std::vector<std::shared_ptr<mapState::Station>>& stationObjects,
+            const std::unordered_map<std::string, std::shared_ptr<mapState::Station>>& stationIndex,
             const std::shared_ptr<playersState::PlayersState>& playersState,
             int& nextId,
             std::vector<RoadInfo>& roadsInfos,
@@ -269,6 +324,8 @@ namespace mapState
 
             std::shared_ptr<playersState::Player> owner = resolveOwner(entry, playersState);
             std::string type = readRoadType(entry);
+            std::shared_ptr<mapState::Station> from = findIndexedStation(stationIndex, MapTopology::normalizeName(fromName));
+            std::shared_ptr<mapState::Station> to = findIndexedStation(stationIndex, MapTopology::normalizeName(toName));
 
             if (type == "FERRY")
             {
@@ -277,9 +334,7 @@ namespace mapState
                 {
                     locomotives = readInt(entry, "locos", 0);
                 }
-                ferrysInfos.push_back(Ferry::genDataByName(
-                    stationObjects, normalizeName(fromName), normalizeName(toName),
-                    id, owner, locomotives, length));
+                ferrysInfos.push_back(Ferry::genData(from, to, id, owner, locomotives, length));
                 return;
             }
 
@@ -291,15 +346,49 @@ namespace mapState
 
             if (type == "TUNNEL")
             {
-                tunnelsInfos.push_back(Tunnel::genDataByName(
-                    stationObjects, normalizeName(fromName), normalizeName(toName),
-                    id, owner, color, length));
+                tunnelsInfos.push_back(Tunnel::genData(from, to, id, owner, color, length));
                 return;
             }
 
-            roadsInfos.push_back(Road::genDataByName(
-                stationObjects, normalizeName(fromName), normalizeName(toName),
-                id, owner, color, length));
+            roadsInfos.push_back(Road::genData(from, to, id, owner, color, length));
+        }
+
+        // road slots of a cheapest route from start to goal, where row holds the distances to goal:
+        // only roads that are tight for that row are walked, breadth first so free own roads cannot loop
+        std::vector<int> traceTightRoute(const std::vector<int> &offsets, const std::vector<int> &adjacentRoads, const std::vector<int> &targets,
+                                         const std::vector<int> &roadWeights, const int *row, int start, int goal)
+        {
+            std::vector<int> viaRoad(offsets.size() - 1, -1);
+            std::vector<int> previous(offsets.size() - 1, -1);
+            std::vector<char> seen(offsets.size() - 1, 0);
+            std::queue<int> pending;
+            seen[static_cast<std::size_t>(start)] = 1;
+            pending.push(start);
+            while (!pending.empty() && !seen[static_cast<std::size_t>(goal)])
+            {
+                int current = pending.front();
+                pending.pop();
+                for (int e = offsets[current]; e < offsets[current + 1]; ++e)
+                {
+                    int road = adjacentRoads[e];
+                    int next = targets[e];
+                    int weight = roadWeights[road];
+                    if (seen[next] || weight == kUnreachable || row[next] == kUnreachable || row[next] + weight != row[current])
+                    {
+                        continue;
+                    }
+                    seen[next] = 1;
+                    viaRoad[next] = road;
+                    previous[next] = current;
+                    pending.push(next);
+                }
+            }
+            std::vector<int> route;
+            for (int current = goal; current != start && previous[current] >= 0; current = previous[current])
+            {
+                route.push_back(viaRoad[current]);
+            }
+            return route;
         }
 
     } // namespace
@@ -308,6 +397,19 @@ namespace mapState
     {
         DEBUG_PRINT("default MapState creation started...");
         this->gameGraph = std::make_shared<boost::adjacency_list<>>();
+        this->topology = MapTopology::intern(this->stations, this->roads);
+        this->distanceEpoch = -1;
+        this->claimableEpoch = -1;
+        this->roadOwnerEpoch = 0;
+        this->forkEpoch = -1;
+        this->ticketWatchEpoch = -1;
+        this->connectivityParents.clear();
+        this->connectivityRoads.clear();
+        this->connectivityEpochs.clear();
+        this->connectivityBorrowCounts.clear();
+        this->longestRouteComponents.clear();
+        this->longestRouteValues.clear();
+        this->longestRouteEpochs.clear();
 #ifdef DEBUG
         this->display();
 #endif
@@ -318,6 +420,11 @@ namespace mapState
     {
         DEBUG_PRINT("Parameterized MapState creation started...");
         this->gameGraph = gameGraph;
+        this->distanceEpoch = -1;
+        this->claimableEpoch = -1;
+        this->roadOwnerEpoch = 0;
+        this->forkEpoch = -1;
+        this->ticketWatchEpoch = -1;
         this->fillMapWithInfos(stationsInfos, roadsInfos, tunnelsInfos, ferrysInfos, gameGraph);
 #ifdef DEBUG
         std::cout << "Final MapState:" << std::endl;
@@ -345,6 +452,14 @@ namespace mapState
             return MapState();
         }
 
+        // compiled map images are named by their path, see MapImage::compile
+        const std::string imageExtension = ".bin";
+        if (mapName.size() > imageExtension.size() && mapName.compare(mapName.size() - imageExtension.size(), imageExtension.size(), imageExtension) == 0)
+        {
+            return MapState::FromImage(mapName, nullptr);
+        }
+
+        std::cerr << "Error: unknown map '" << mapName << "'" << std::endl;
         return MapState();
     }
     //// Predefined Maps
@@ -595,6 +710,7 @@ namespace mapState
             std::cerr << std::endl;
             std::exit(EXIT_FAILURE);
         }
+        this->buildRoutingGraph();
         DEBUG_PRINT("MapState fillMapWithInfos finished !");
     }
 
@@ -616,19 +732,17 @@ namespace mapState
         std::cout << indentation << "\t" << "##### ROADS #####" << std::endl;
         for (const std::shared_ptr<Road> &road : roads)
         {
-            if (typeid(*road) == typeid(Tunnel))
-            {
-                std::shared_ptr<Tunnel> tunnel = std::dynamic_pointer_cast<Tunnel>(road);
-                tunnel->display(indent + 2);
-            }
-            else if (typeid(*road) == typeid(Ferry))
-            {
-                std::shared_ptr<Ferry> ferry = std::dynamic_pointer_cast<Ferry>(road);
-                ferry->display(indent + 2);
-            }
-            else
+            switch (road->getKind())
             {
+            case RoadKind::TUNNEL:
+                std::static_pointer_cast<Tunnel>(road)->display(indent + 2);
+                break;
+            case RoadKind::FERRY:
+                std::static_pointer_cast<Ferry>(road)->display(indent + 2);
+                break;
+            default:
                 road->display(indent + 2);
+                break;
             }
         }
         std::cout << indentation << "\t" << "#####################" << std::endl;
@@ -648,13 +762,121 @@ namespace mapState
         return this->roads;
     }
 
+    // per-slot road columns, indexed like getRoads(); they let whole-map scans run over plain arrays
+    const std::vector<int> &MapState::getRoadLengths()
+    {
+        this->ensureRoutingGraph();
+        return this->topology->roadLengths;
+    }
+
+    const std::vector<RoadColor> &MapState::getRoadColors()
+    {
+        this->ensureRoutingGraph();
+        return this->topology->roadColors;
+    }
+
+    const std::vector<RoadKind> &MapState::getRoadKinds()
+    {
+        this->ensureRoutingGraph();
+        return this->topology->roadKinds;
+    }
+
+    const std::vector<int> &MapState::getRoadLocomotives()
+    {
+        this->ensureRoutingGraph();
+        return this->topology->roadLocomotives;
+    }
+
+    // station ids at both ends of each road, -1 for roads off the map
+    const std::vector<int> &MapState::getRoadEndpointsA()
+    {
+        this->ensureRoutingGraph();
+        return this->topology->roadEndpointsA;
+    }
+
+    const std::vector<int> &MapState::getRoadEndpointsB()
+    {
+        this->ensureRoutingGraph();
+        return this->topology->roadEndpointsB;
+    }
+
+    // index of each road's owner in getRoadOwnerTable(), -1 while the road is free
+    const std::vector<int> &MapState::getRoadOwnerSlots()
+    {
+        this->ensureRoutingGraph();
+        this->refreshRoadOwners();
+        return this->roadOwnerSlots;
+    }
+
+    // every player seen owning a road, in order of first sighting; slots stay stable until the map is rebuilt
+    const std::vector<std::shared_ptr<playersState::Player>> &MapState::getRoadOwnerTable()
+    {
+        this->ensureRoutingGraph();
+        this->refreshRoadOwners();
+        return this->roadOwnerTable;
+    }
+
+    // board tables shared with every other game on the same map; ownership stays on this map's roads
+    std::shared_ptr<const MapTopology> MapState::getTopology()
+    {
+        this->ensureRoutingGraph();
+        return this->topology;
+    }
+
+    // copy-on-write view for what-if searches: the board and the current owners are shared with the map
+    // and every other fork taken before the next claim, the fork only stores the claims made on it
+    MapFork MapState::fork()
+    {
+        this->ensureRoutingGraph();
+        this->refreshRoadOwners();
+        if (!this->forkOwners || this->forkEpoch != this->roadOwnerEpoch || this->forkOwners->size() != this->roads.size())
+        {
+            this->forkOwners = std::make_shared<const std::vector<int>>(this->roadOwnerSlots);
+            this->forkOwnerTable = std::make_shared<const std::vector<std::shared_ptr<playersState::Player>>>(this->roadOwnerTable);
+            this->forkEpoch = this->roadOwnerEpoch;
+        }
+        return MapFork(this->topology, this->forkOwners, this->forkOwnerTable);
+    }
+
     std::shared_ptr<Station> MapState::getStationByName(const std::string &name)
     {
-        return Station::getStationByName(this->stations, name);
+        return this->getStationById(this->getStationId(name));
+    }
+
+    std::shared_ptr<Station> MapState::getStationById(int id)
+    {
+        this->ensureRoutingGraph();
+        if (id < 0 || static_cast<std::size_t>(id) >= this->stations.size())
+        {
+            return nullptr;
+        }
+        return this->stations[static_cast<std::size_t>(id)];
+    }
+
+    // dense id of the station carrying this name (case and surrounding spaces ignored), -1 if unknown
+    int MapState::getStationId(const std::string &name)
+    {
+        this->ensureRoutingGraph();
+        std::unordered_map<std::string, int>::const_iterator it = this->topology->stationIndex.find(name);
+        if (it == this->topology->stationIndex.end())
+        {
+            it = this->topology->stationIndex.find(MapTopology::normalizeName(name));
+        }
+        return it == this->topology->stationIndex.end() ? -1 : it->second;
     }
 
     std::shared_ptr<Road> MapState::getRoadByID(int id)
     {
+        this->ensureRoutingGraph();
+        if (id >= 0 && static_cast<std::size_t>(id) < this->topology->roadIdSlots.size())
+        {
+            int slot = this->topology->roadIdSlots[static_cast<std::size_t>(id)];
+            if (slot >= 0 && this->roads[static_cast<std::size_t>(slot)]->id == id)
+            {
+                return this->roads[static_cast<std::size_t>(slot)];
+            }
+        }
+        // ids outside the table (negative or far too large) are rare enough to scan for
         for (const std::shared_ptr<Road> &road : this->roads)
         {
             if (road && road->id == id)
@@ -667,17 +889,247 @@ namespace mapState
 
     std::vector<std::shared_ptr<Road>> MapState::getRoadsBetweenStations(std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB)
     {
-        return Road::getRoadsBetweenStations(this->roads, stationA, stationB);
+        int a = this->getStationSlot(stationA);
+        int b = this->getStationSlot(stationB);
+        if (a < 0 || b < 0)
+        {
+            return Road::getRoadsBetweenStations(this->roads, stationA, stationB);
+        }
+        std::vector<std::shared_ptr<Road>> matchingRoads;
+        for (int e = this->topology->adjacencyOffsets[a]; e < this->topology->adjacencyOffsets[a + 1]; ++e)
+        {
+            if (this->topology->adjacencyTargets[e] == b)
+            {
+                matchingRoads.push_back(this->roads[static_cast<std::size_t>(this->topology->adjacencyRoads[e])]);
+            }
+        }
+        return matchingRoads;
+    }
+
+    // the other roads running between the same two stations (double routes)
+    std::vector<std::shared_ptr<Road>> MapState::getParallelRoads(std::shared_ptr<Road> road)
+    {
+        std::vector<std::shared_ptr<Road>> parallelRoads;
+        int slot = this->getRoadSlot(road);
+        if (slot < 0 || this->topology->parallelGroupOf[slot] < 0)
+        {
+            return parallelRoads;
+        }
+        int group = this->topology->parallelGroupOf[slot];
+        for (int i = this->topology->parallelGroupOffsets[group]; i < this->topology->parallelGroupOffsets[group + 1]; ++i)
+        {
+            if (this->topology->parallelGroupRoads[i] != slot)
+            {
+                parallelRoads.push_back(this->roads[static_cast<std::size_t>(this->topology->parallelGroupRoads[i])]);
+            }
+        }
+        return parallelRoads;
     }
 
     bool MapState::isRoadClaimable(int nbPLayers, std::shared_ptr<mapState::Road> road, std::shared_ptr<playersState::Player> player)
     {
-        return road->isClaimable(this->roads, nbPLayers, player);
+        int slot = this->getRoadSlot(road);
+        if (slot < 0)
+        {
+            return road->isClaimable(this->roads, nbPLayers, player);
+        }
+        this->refreshRoadOwners();
+        return this->isRoadSlotClaimable(slot, nbPLayers, player);
     }
 
     std::vector<std::shared_ptr<Road>> MapState::getClaimableRoads(int nbPlayers, std::shared_ptr<playersState::Player> player)
     {
-        return Road::getClaimableRoads(this->roads, nbPlayers, player);
+        return this->getClaimableRoadsView(nbPlayers, player);
+    }
+
+    // claimable roads of a player, kept up to date across claims; the reference stays valid until the next call
+    const std::vector<std::shared_ptr<Road>> &MapState::getClaimableRoadsView(int nbPlayers, std::shared_ptr<playersState::Player> player)
+    {
+        this->ensureRoutingGraph();
+        this->refreshClaimableViews();
+        this->refreshRoadOwners();
+        std::string key = (player ? player->getName() : std::string()) + "/" + std::to_string(nbPlayers);
+        this->claimablePlayers[key] = player;
+        if (this->claimableViews.find(key) == this->claimableViews.end())
+        {
+            std::vector<bool> &flags = this->claimableFlags[key];
+            std::vector<std::shared_ptr<Road>> &view = this->claimableViews[key];
+            flags.assign(this->roads.size(), false);
+            for (std::size_t r = 0; r < this->roads.size(); ++r)
+            {
+                if (this->roads[r] && this->isRoadSlotClaimable(static_cast<int>(r), nbPlayers, player))
+                {
+                    flags[r] = true;
+                    view.push_back(this->roads[r]);
+                }
+            }
+            this->claimablePlayerCounts[key] = nbPlayers;
+        }
+        return this->claimableViews[key];
+    }
+
+    // re-checks only the roads whose owner changed, together with their double route siblings
+    void MapState::refreshClaimableViews()
+    {
+        this->refreshRoadOwners();
+        if (this->claimableEpoch == this->roadOwnerEpoch && this->claimableOwners.size() == this->roads.size())
+        {
+            return;
+        }
+        this->claimableEpoch = this->roadOwnerEpoch;
+
+        std::vector<int> touched;
+        this->claimableOwners.resize(this->roads.size(), -1);
+        for (std::size_t r = 0; r < this->roads.size(); ++r)
+        {
+            int owner = this->roadOwnerSlots[r];
+            if (owner == this->claimableOwners[r])
+            {
+                continue;
+            }
+            this->claimableOwners[r] = owner;
+            touched.push_back(static_cast<int>(r));
+            int group = this->topology->parallelGroupOf[r];
+            if (group < 0)
+            {
+                continue;
+            }
+            for (int i = this->topology->parallelGroupOffsets[group]; i < this->topology->parallelGroupOffsets[group + 1]; ++i)
+            {
+                if (this->topology->parallelGroupRoads[i] != static_cast<int>(r))
+                {
+                    touched.push_back(this->topology->parallelGroupRoads[i]);
+                }
+            }
+        }
+        if (touched.empty())
+        {
+            return;
+        }
+
+        for (std::pair<const std::string, std::vector<bool>> &entry : this->claimableFlags)
+        {
+            std::vector<bool> &flags = entry.second;
+            std::shared_ptr<playersState::Player> player = this->claimablePlayers[entry.first];
+            int nbPlayers = this->claimablePlayerCounts[entry.first];
+            bool changed = false;
+            for (int slot : touched)
+            {
+                bool claimable = this->roads[static_cast<std::size_t>(slot)] && this->isRoadSlotClaimable(slot, nbPlayers, player);
+                if (flags[static_cast<std::size_t>(slot)] != claimable)
+                {
+                    flags[static_cast<std::size_t>(slot)] = claimable;
+                    changed = true;
+                }
+            }
+            if (!changed)
+            {
+                continue;
+            }
+            // rebuilt in road order so callers see the same ordering as a fresh scan
+            std::vector<std::shared_ptr<Road>> &view = this->claimableViews[entry.first];
+            view.clear();
+            for (std::size_t r = 0; r < flags.size(); ++r)
+            {
+                if (flags[r])
+                {
+                    view.push_back(this->roads[r]);
+                }
+            }
+        }
+    }
+
+    // same rules as Road::isClaimable, but only looks at the precomputed double route group;
+    // reads the owner slots, so refreshRoadOwners must have run since the last claim
+    bool MapState::isRoadSlotClaimable(int slot, int nbPlayers, std::shared_ptr<playersState::Player> player) const
+    {
+        if (this->roadOwnerSlots[static_cast<std::size_t>(slot)] >= 0)
+        {
+            return false;
+        }
+        int group = this->topology->parallelGroupOf[slot];
+        if (group < 0)
+        {
+            return true;
+        }
+        for (int i = this->topology->parallelGroupOffsets[group]; i < this->topology->parallelGroupOffsets[group + 1]; ++i)
+        {
+            int sibling = this->topology->parallelGroupRoads[i];
+            int siblingOwner = this->roadOwnerSlots[static_cast<std::size_t>(sibling)];
+            if (sibling == slot || siblingOwner < 0)
+            {
+                continue;
+            }
+            if (nbPlayers <= 3)
+            {
+                return false;
+            }
+            if (player && this->roadOwnerTable[static_cast<std::size_t>(siblingOwner)]->getColor() == player->getColor())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // resyncs the owner column with the roads of this map and bumps roadOwnerEpoch when an owner changed.
+    // Roads still held by the object seen last time cost one pointer compare; owners are interned by name,
+    // so copies of a player share a slot
+    void MapState::refreshRoadOwners()
+    {
+        bool changed = this->roadOwnerSlots.size() != this->roads.size();
+        if (changed)
+        {
+            this->roadOwnerSlots.assign(this->roads.size(), -1);
+        }
+        for (std::size_t r = 0; r < this->roads.size(); ++r)
+        {
+            const playersState::Player *owner = this->roads[r] ? this->roads[r]->owner.get() : nullptr;
+            const int known = this->roadOwnerSlots[r];
+            if (known < 0 ? owner == nullptr : this->roadOwnerTable[static_cast<std::size_t>(known)].get() == owner)
+            {
+                continue;
+            }
+            int slot = owner ? this->findOwnerSlot(this->roads[r]->owner) : -1;
+            if (owner && slot < 0)
+            {
+                slot = static_cast<int>(this->roadOwnerTable.size());
+                this->roadOwnerTable.push_back(this->roads[r]->owner);
+            }
+            if (slot != known)
+            {
+                this->roadOwnerSlots[r] = slot;
+                changed = true;
+            }
+        }
+        if (changed)
+        {
+            ++this->roadOwnerEpoch;
+        }
+    }
+
+    // slot of the player in the owner table, -1 if they own nothing yet
+    int MapState::findOwnerSlot(std::shared_ptr<playersState::Player> player) const
+    {
+        if (!player)
+        {
+            return -1;
+        }
+        for (std::size_t i = 0; i < this->roadOwnerTable.size(); ++i)
+        {
+            if (this->roadOwnerTable[i] == player)
+            {
+                return static_cast<int>(i);
+            }
+        }
+        for (std::size_t i = 0; i < this->roadOwnerTable.size(); ++i)
+        {
+            if (this->roadOwnerTable[i]->getName() == player->getName())
+            {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
     }
 
     // shared helper for pathfinding with Dijkstra algorithm
@@ -695,7 +1147,60 @@ namespace mapState
         if (!src || !dest)
             return path;
 
-        // build a temporary undirected graph from provided stations and roads
+        // translate the provided lists into masks over the cached routing graph
+        this->ensureRoutingGraph();
+        bool foreignElements = false;
+        std::vector<bool> roadMask(this->roads.size(), false);
+        for (const std::shared_ptr<Road> &road : roads)
+        {
+            if (!road)
+            {
+                continue;
+            }
+            std::unordered_map<const Road *, int>::const_iterator it = this->roadSlots.find(road.get());
+            if (it == this->roadSlots.end())
+            {
+                foreignElements = true;
+                break;
+            }
+            roadMask[static_cast<std::size_t>(it->second)] = true;
+        }
+
+        bool sameStations = stations.size() == this->stations.size();
+        for (std::size_t i = 0; sameStations && i < stations.size(); ++i)
+        {
+            sameStations = stations[i] == this->stations[i];
+        }
+        std::vector<bool> stationMask;
+        std::vector<std::shared_ptr<Station>> stationObjects;
+        if (!sameStations && !foreignElements)
+        {
+            stationMask.assign(this->stations.size(), false);
+            stationObjects.assign(this->stations.size(), nullptr);
+            for (const std::shared_ptr<Station> &station : stations)
+            {
+                if (!station)
+                {
+                    continue;
+                }
+                int slot = this->getStationSlot(station);
+                if (slot < 0)
+                {
+                    foreignElements = true;
+                    break;
+                }
+                stationMask[static_cast<std::size_t>(slot)] = true;
+                stationObjects[static_cast<std::size_t>(slot)] = station;
+            }
+        }
+
+        if (!foreignElements)
+        {
+            return this->searchRoutingGraph(this->getStationSlot(src), this->getStationSlot(dest),
+                                            roadMask, stationMask, stationObjects, useRoadLength);
+        }
+
+        // lists not taken from this map: build a temporary undirected graph from them
         typedef boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS> TempGraph;
         TempGraph graph;
         typedef boost::graph_traits<TempGraph>::vertex_descriptor vertex_descriptor;
@@ -829,100 +1334,1877 @@ namespace mapState
         return path;
     }
 
-    // get shortest path by number of roads (sets edge weight = 1)
-    Path MapState::getShortestPath(
-        std::shared_ptr<Station> src,
-        std::shared_ptr<Station> dest,
-        std::vector<std::shared_ptr<Station>> stations,
-        std::vector<std::shared_ptr<Road>> roads)
-    {
-        return this->buildPathWithDijkstra(src, dest, stations, roads, false);
-    }
-
-    // gets most efficient path by road length (edge weight = road length)
-    Path MapState::getMostEfficientPath(
-        std::shared_ptr<Station> src,
-        std::shared_ptr<Station> dest,
-        std::vector<std::shared_ptr<Station>> stations,
-        std::vector<std::shared_ptr<Road>> roads)
-    {
-        return this->buildPathWithDijkstra(src, dest, stations, roads, true);
-    }
-
-    std::vector<std::shared_ptr<Station>> MapState::getAdjacentStations(std::shared_ptr<Station> station)
-    {
-        if (!station)
-        {
-            return {};
-        }
-        return station->getAdjacentStations(this->roads);
-    }
-    std::vector<std::shared_ptr<Road>> MapState::getRoadsOwnedByPlayer(std::shared_ptr<playersState::Player> player)
-    {
-        return Road::getRoadsOwnedByPlayer(player, this->roads);
-    }
-    std::vector<std::shared_ptr<Road>> MapState::getRoadsUsableByPlayer(std::shared_ptr<playersState::Player> player)
-    {
-        return Road::getRoadsUsableByPlayer(player, this->roads);
-    }
-    bool MapState::isDestinationReached(std::vector<std::shared_ptr<Road>> playerRoads, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB)
+    // builds the compact adjacency (CSR) used by every path query, once per map load
+    void MapState::buildRoutingGraph()
     {
-        if (!stationA || !stationB)
+        this->stationSlots.clear();
+        this->roadSlots.clear();
+        this->lengthDistances.clear();
+        this->hopDistances.clear();
+        this->distanceRoadWeights.clear();
+        this->distancePlayers.clear();
+        this->distanceBorrowCounts.clear();
+        this->claimableViews.clear();
+        this->claimableFlags.clear();
+        this->claimablePlayers.clear();
+        this->claimablePlayerCounts.clear();
+        this->claimableOwners.clear();
+        this->claimableEpoch = -1;
+        // claims survive the rebuild, carried over by road id; the owner generation keeps counting, so caches
+        // made before the rebuild can never match again
+        std::vector<std::pair<int, int>> carriedOwners;
+        if (this->topology)
         {
-            return false;
+            for (std::size_t r = 0; r < this->roadOwnerSlots.size() && r < this->topology->roadIds.size(); ++r)
+            {
+                if (this->roadOwnerSlots[r] >= 0 && this->topology->roadIds[r] >= 0)
+                {
+                    carriedOwners.push_back(std::make_pair(this->topology->roadIds[r], this->roadOwnerSlots[r]));
+                }
+            }
         }
-        if (stationA->getName() == stationB->getName())
+        this->roadOwnerSlots.clear();
+        this->forkOwners = nullptr;
+        this->forkOwnerTable = nullptr;
+        this->chokepointAnalyses.clear();
+        this->chokepointKeys.clear();
+        this->ticketTable = nullptr;
+        this->networkDistances.clear();
+        this->networkDistanceKeys.clear();
+        this->ticketWatches.clear();
+        this->ticketWatchKeys.clear();
+        this->ticketWatchOwners.clear();
+        this->ticketWatchEpoch = -1;
+
+        // the tables only depend on the board, so games on the same map share them
+        this->topology = MapTopology::intern(this->stations, this->roads);
+        this->roadOwnerSlots.assign(this->roads.size(), -1);
+        for (const std::pair<int, int> &carried : carriedOwners)
         {
-            return true;
-        }
+            const std::vector<int> &ids = this->topology->roadIds;
+            int slot = static_cast<std::size_t>(carried.first) < this->topology->roadIdSlots.size()
+                           ? this->topology->roadIdSlots[static_cast<std::size_t>(carried.first)]
+                           : static_cast<int>(std::find(ids.begin(), ids.end(), carried.first) - ids.begin());
+            if (slot < 0 || static_cast<std::size_t>(slot) >= this->roads.size() || !this->roads[static_cast<std::size_t>(slot)])
+            {
+                continue;
+            }
+            this->roadOwnerSlots[static_cast<std::size_t>(slot)] = carried.second;
+            // a road object swapped in for a claimed one takes the claim over
+            if (!this->roads[static_cast<std::size_t>(slot)]->owner)
+            {
+                this->roads[static_cast<std::size_t>(slot)]->owner = this->roadOwnerTable[static_cast<std::size_t>(carried.second)];
+            }
+        }
+
+        // stations are interned to their index, roads pointing to foreign station objects were matched by name
+        for (std::size_t i = 0; i < this->stations.size(); ++i)
+        {
+            if (!this->stations[i])
+            {
+                continue;
+            }
+            this->stations[i]->setId(static_cast<int>(i));
+            this->stationSlots[this->stations[i].get()] = static_cast<int>(i);
+        }
+        for (std::size_t r = 0; r < this->roads.size(); ++r)
+        {
+            const std::shared_ptr<Road> &road = this->roads[r];
+            if (!road)
+            {
+                continue;
+            }
+            this->roadSlots[road.get()] = static_cast<int>(r);
+            int a = this->topology->roadEndpointsA[r];
+            int b = this->topology->roadEndpointsB[r];
+            if (a < 0 || b < 0)
+            {
+                continue;
+            }
+            // endpoint objects share the id of the map station they stand for
+            road->getStationA()->setId(a);
+            road->getStationB()->setId(b);
+        }
+        DEBUG_PRINT("MapState routing graph built: " << this->stations.size() << " stations, " << this->roads.size() << " roads");
+    }
+
+    // rebuilds the routing graph if stations or roads were edited directly
+    void MapState::ensureRoutingGraph()
+    {
+        if (!this->topology || this->topology->adjacencyOffsets.size() != this->stations.size() + 1
+            || this->topology->roadEndpointsA.size() != this->roads.size())
+        {
+            this->buildRoutingGraph();
+        }
+    }
+
+    int MapState::getStationSlot(std::shared_ptr<Station> station)
+    {
+        if (!station)
+        {
+            return -1;
+        }
+        this->ensureRoutingGraph();
+        int id = station->getId();
+        if (id >= 0 && static_cast<std::size_t>(id) < this->stations.size() && this->stations[static_cast<std::size_t>(id)] == station)
+        {
+            return id;
+        }
+        std::unordered_map<const Station *, int>::const_iterator it = this->stationSlots.find(station.get());
+        if (it != this->stationSlots.end())
+        {
+            return it->second;
+        }
+        return this->getStationId(station->getName());
+    }
+
+    int MapState::getRoadSlot(std::shared_ptr<Road> road)
+    {
+        if (!road)
+        {
+            return -1;
+        }
+        this->ensureRoutingGraph();
+        std::unordered_map<const Road *, int>::const_iterator it = this->roadSlots.find(road.get());
+        return it == this->roadSlots.end() ? -1 : it->second;
+    }
+
+    std::vector<bool> MapState::getRoadMask(const std::vector<std::shared_ptr<Road>> &roads)
+    {
+        this->ensureRoutingGraph();
+        std::vector<bool> mask(this->roads.size(), false);
+        for (const std::shared_ptr<Road> &road : roads)
+        {
+            std::unordered_map<const Road *, int>::const_iterator it = this->roadSlots.find(road.get());
+            if (it != this->roadSlots.end())
+            {
+                mask[static_cast<std::size_t>(it->second)] = true;
+            }
+        }
+        return mask;
+    }
+
+    // Dijkstra over the cached adjacency, restricted to the roads and stations enabled in the masks
+    Path MapState::searchRoutingGraph(
+        int src,
+        int dest,
+        const std::vector<bool> &roadMask,
+        const std::vector<bool> &stationMask,
+        const std::vector<std::shared_ptr<Station>> &stationObjects,
+        bool useRoadLength) const
+    {
+        std::vector<int> distances;
+        std::vector<int> viaRoad;
+        this->searchFromSource(src, {dest}, roadMask, stationMask, useRoadLength, distances, viaRoad);
+        return this->tracePath(src, dest, distances, viaRoad, stationObjects);
+    }
+
+    // one Dijkstra from src, stopped once every target is settled (never when targets is empty);
+    // distances and viaRoad are left empty when src is not a usable station
+    void MapState::searchFromSource(
+        int src,
+        const std::vector<int> &targets,
+        const std::vector<bool> &roadMask,
+        const std::vector<bool> &stationMask,
+        bool useRoadLength,
+        std::vector<int> &distances,
+        std::vector<int> &viaRoad) const
+    {
+        distances.clear();
+        viaRoad.clear();
+        const int n = static_cast<int>(this->stations.size());
+        if (src < 0 || src >= n || (!stationMask.empty() && !stationMask[src]))
+        {
+            return;
+        }
+
+        distances.assign(static_cast<std::size_t>(n), kUnreachable);
+        viaRoad.assign(static_cast<std::size_t>(n), -1);
+        std::vector<char> wanted(static_cast<std::size_t>(n), 0);
+        std::size_t remaining = 0;
+        for (int target : targets)
+        {
+            if (target >= 0 && target < n && !wanted[target])
+            {
+                wanted[target] = 1;
+                ++remaining;
+            }
+        }
+        typedef std::pair<int, int> QueueEntry;
+        std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+        distances[src] = 0;
+        queue.push(QueueEntry(0, src));
+
+        while (!queue.empty())
+        {
+            QueueEntry top = queue.top();
+            queue.pop();
+            int current = top.second;
+            if (top.first > distances[current])
+            {
+                continue;
+            }
+            if (wanted[current])
+            {
+                wanted[current] = 0;
+                if (--remaining == 0)
+                {
+                    break;
+                }
+            }
+            for (int e = this->topology->adjacencyOffsets[current]; e < this->topology->adjacencyOffsets[current + 1]; ++e)
+            {
+                int road = this->topology->adjacencyRoads[e];
+                int next = this->topology->adjacencyTargets[e];
+                if (!roadMask.empty() && !roadMask[road])
+                {
+                    continue;
+                }
+                if (!stationMask.empty() && !stationMask[next])
+                {
+                    continue;
+                }
+                int weight = useRoadLength ? this->roads[road]->getLength() : 1;
+                if (distances[current] + weight < distances[next])
+                {
+                    distances[next] = distances[current] + weight;
+                    viaRoad[next] = road;
+                    queue.push(QueueEntry(distances[next], next));
+                }
+            }
+        }
+    }
+
+    // A* by road length with the ALT bound: for every landmark L, |d(L, dest) - d(L, v)| <= d(v, dest) by the
+    // triangle inequality. The landmark distances are over the whole map, so the bound also holds for any roadMask
+    Path MapState::searchWithLandmarks(int src, int dest, const std::vector<bool> &roadMask) const
+    {
+        Path path;
+        path.TOTALLENGTH = 0;
+        path.NUMEDGES = 0;
+        const int n = static_cast<int>(this->stations.size());
+        if (src < 0 || dest < 0 || src >= n || dest >= n)
+        {
+            return path;
+        }
+
+        const MapTopology &topology = *this->topology;
+        const std::size_t landmarks = topology.landmarkStations.size();
+        SearchScratch &scratch = SearchScratch::acquire(static_cast<std::size_t>(n));
+        scratch.targetRow.assign(topology.landmarkDistances.begin() + static_cast<std::ptrdiff_t>(static_cast<std::size_t>(dest) * landmarks),
+                                 topology.landmarkDistances.begin() + static_cast<std::ptrdiff_t>(static_cast<std::size_t>(dest + 1) * landmarks));
+        auto bound = [&](int station) {
+            const int *row = &topology.landmarkDistances[static_cast<std::size_t>(station) * landmarks];
+            int best = 0;
+            for (std::size_t l = 0; l < landmarks; ++l)
+            {
+                if (row[l] >= 0 && scratch.targetRow[l] >= 0)
+                {
+                    best = std::max(best, std::abs(scratch.targetRow[l] - row[l]));
+                }
+            }
+            return best;
+        };
+
+        typedef std::pair<int, int> QueueEntry;
+        std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+        scratch.stamps[src] = scratch.stamp;
+        scratch.distances[src] = 0;
+        scratch.viaRoad[src] = -1;
+        queue.push(QueueEntry(bound(src), src));
+        bool reached = false;
+        while (!queue.empty())
+        {
+            QueueEntry top = queue.top();
+            queue.pop();
+            int current = top.second;
+            int distance = scratch.distances[current];
+            // a stale entry: the station was reached more cheaply since it was queued
+            if (top.first - bound(current) > distance)
+            {
+                continue;
+            }
+            if (current == dest)
+            {
+                reached = true;
+                break;
+            }
+            for (int e = topology.adjacencyOffsets[current]; e < topology.adjacencyOffsets[current + 1]; ++e)
+            {
+                int road = topology.adjacencyRoads[e];
+                if (!roadMask.empty() && !roadMask[road])
+                {
+                    continue;
+                }
+                int next = topology.adjacencyTargets[e];
+                int candidate = distance + topology.roadLengths[road];
+                if (scratch.stamps[next] == scratch.stamp && candidate >= scratch.distances[next])
+                {
+                    continue;
+                }
+                scratch.stamps[next] = scratch.stamp;
+                scratch.distances[next] = candidate;
+                scratch.viaRoad[next] = road;
+                queue.push(QueueEntry(candidate + bound(next), next));
+            }
+        }
+        if (!reached)
+        {
+            return path;
+        }
+
+        for (int current = dest;; current = topology.roadEndpointsA[scratch.viaRoad[current]] == current
+                                                 ? topology.roadEndpointsB[scratch.viaRoad[current]]
+                                                 : topology.roadEndpointsA[scratch.viaRoad[current]])
+        {
+            path.STATIONS.push_back(this->stations[current]);
+            if (current == src)
+            {
+                break;
+            }
+            path.ROADS.push_back(this->roads[scratch.viaRoad[current]]);
+        }
+        std::reverse(path.STATIONS.begin(), path.STATIONS.end());
+        std::reverse(path.ROADS.begin(), path.ROADS.end());
+        path.NUMEDGES = int(path.STATIONS.size()) - 1;
+        path.TOTALLENGTH = scratch.distances[dest];
+        return path;
+    }
+
+    // Dijkstra over the kept stations only: each chain of pass-through stations is crossed in one step, using
+    // the prefix lengths (or positions for hop counts). A pass-through src starts from its place in its chain and
+    // a pass-through dest is reached from inside its chain. With a roadMask the chain is walked road by road
+    // to find where it is cut. Each station remembers the chain position it was reached from, so the path
+    // is expanded back to every real station and road
+    Path MapState::searchContracted(int src, int dest, const std::vector<bool> &roadMask, bool useRoadLength) const
+    {
+        Path path;
+        path.TOTALLENGTH = 0;
+        path.NUMEDGES = 0;
+        const int n = static_cast<int>(this->stations.size());
+        if (src < 0 || dest < 0 || src >= n || dest >= n)
+        {
+            return path;
+        }
+
+        const MapTopology &topology = *this->topology;
+        SearchScratch &scratch = SearchScratch::acquire(static_cast<std::size_t>(n));
+        typedef std::pair<int, int> QueueEntry;
+        std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+        // viaRoad holds the chain position a station was reached at, viaStart the position the step started from
+        auto relax = [&](int station, int distance, int fromPos, int toPos) {
+            if (scratch.stamps[station] == scratch.stamp && distance >= scratch.distances[station])
+            {
+                return;
+            }
+            scratch.stamps[station] = scratch.stamp;
+            scratch.distances[station] = distance;
+            scratch.viaStart[station] = fromPos;
+            scratch.viaRoad[station] = toPos;
+            queue.push(QueueEntry(distance, station));
+        };
+        auto cost = [&](int fromPos, int toPos) {
+            return useRoadLength ? std::abs(topology.chainPrefix[toPos] - topology.chainPrefix[fromPos]) : std::abs(toPos - fromPos);
+        };
+        const int destChain = topology.stationChain[dest];
+        // crosses chain from position fromPos in direction step (+1 or -1), stopping at a cut road
+        auto cross = [&](int chain, int fromPos, int step, int distance) {
+            const int first = topology.chainOffsets[chain];
+            const int last = topology.chainOffsets[chain + 1] - 1;
+            int endPos = step > 0 ? last : first;
+            if (!roadMask.empty())
+            {
+                for (int pos = fromPos; pos != endPos; pos += step)
+                {
+                    int road = topology.chainRoads[static_cast<std::size_t>((step > 0 ? pos : pos - 1) - chain)];
+                    if (!roadMask[road])
+                    {
+                        endPos = pos;
+                        break;
+                    }
+                }
+            }
+            if (chain == destChain)
+            {
+                int destPos = topology.stationChainPos[dest];
+                if ((destPos - fromPos) * step > 0 && (endPos - destPos) * step >= 0)
+                {
+                    relax(dest, distance + cost(fromPos, destPos), fromPos, destPos);
+                }
+            }
+            if (endPos == (step > 0 ? last : first) && endPos != fromPos)
+            {
+                relax(topology.chainStations[endPos], distance + cost(fromPos, endPos), fromPos, endPos);
+            }
+        };
+
+        scratch.stamps[src] = scratch.stamp;
+        scratch.distances[src] = 0;
+        scratch.viaStart[src] = -1;
+        scratch.viaRoad[src] = -1;
+        queue.push(QueueEntry(0, src));
+        bool reached = false;
+        while (!queue.empty())
+        {
+            QueueEntry top = queue.top();
+            queue.pop();
+            int current = top.second;
+            if (top.first > scratch.distances[current])
+            {
+                continue;
+            }
+            if (current == dest)
+            {
+                reached = true;
+                break;
+            }
+            int chain = topology.stationChain[current];
+            if (chain >= 0)
+            {
+                // only src can be popped inside a chain
+                cross(chain, topology.stationChainPos[current], 1, top.first);
+                cross(chain, topology.stationChainPos[current], -1, top.first);
+                continue;
+            }
+            for (int e = topology.contractedOffsets[current]; e < topology.contractedOffsets[current + 1]; ++e)
+            {
+                int edge = topology.contractedChains[e];
+                int edgeChain = edge / 2;
+                if (edge % 2 == 0)
+                {
+                    cross(edgeChain, topology.chainOffsets[edgeChain], 1, top.first);
+                }
+                else
+                {
+                    cross(edgeChain, topology.chainOffsets[edgeChain + 1] - 1, -1, top.first);
+                }
+            }
+        }
+        if (!reached)
+        {
+            return path;
+        }
+
+        // expand each chain step back into its stations and roads
+        path.STATIONS.push_back(this->stations[dest]);
+        for (int current = dest; current != src;)
+        {
+            int fromPos = scratch.viaStart[current];
+            int toPos = scratch.viaRoad[current];
+            int chain = static_cast<int>(std::upper_bound(topology.chainOffsets.begin(), topology.chainOffsets.end(), toPos) - topology.chainOffsets.begin()) - 1;
+            int step = fromPos < toPos ? 1 : -1;
+            for (int pos = toPos; pos != fromPos; pos -= step)
+            {
+                path.ROADS.push_back(this->roads[topology.chainRoads[static_cast<std::size_t>((step > 0 ? pos - 1 : pos) - chain)]]);
+                path.STATIONS.push_back(this->stations[topology.chainStations[static_cast<std::size_t>(pos - step)]]);
+            }
+            current = topology.chainStations[static_cast<std::size_t>(fromPos)];
+        }
+        std::reverse(path.STATIONS.begin(), path.STATIONS.end());
+        std::reverse(path.ROADS.begin(), path.ROADS.end());
+        path.NUMEDGES = int(path.STATIONS.size()) - 1;
+        path.TOTALLENGTH = scratch.distances[dest];
+        return path;
+    }
+
+    // walks back along the roads used to reach dest; an empty Path when the search did not reach it
+    Path MapState::tracePath(
+        int src,
+        int dest,
+        const std::vector<int> &distances,
+        const std::vector<int> &viaRoad,
+        const std::vector<std::shared_ptr<Station>> &stationObjects) const
+    {
+        Path path;
+        path.TOTALLENGTH = 0;
+        path.NUMEDGES = 0;
+        if (dest < 0 || static_cast<std::size_t>(dest) >= distances.size() || distances[dest] == kUnreachable)
+        {
+            return path;
+        }
+
+        int current = dest;
+        while (true)
+        {
+            path.STATIONS.push_back(stationObjects.empty() ? this->stations[current] : stationObjects[current]);
+            if (current == src)
+            {
+                break;
+            }
+            int road = viaRoad[current];
+            path.ROADS.push_back(this->roads[road]);
+            current = (this->topology->roadEndpointsA[road] == current) ? this->topology->roadEndpointsB[road] : this->topology->roadEndpointsA[road];
+        }
+        std::reverse(path.STATIONS.begin(), path.STATIONS.end());
+        std::reverse(path.ROADS.begin(), path.ROADS.end());
+        path.NUMEDGES = int(path.STATIONS.size()) - 1;
+        path.TOTALLENGTH = distances[dest];
+        return path;
+    }
+
+    // get shortest path by number of roads (sets edge weight = 1)
+    Path MapState::getShortestPath(
+        std::shared_ptr<Station> src,
+        std::shared_ptr<Station> dest,
+        std::vector<std::shared_ptr<Station>> stations,
+        std::vector<std::shared_ptr<Road>> roads)
+    {
+        return this->buildPathWithDijkstra(src, dest, stations, roads, false);
+    }
+
+    // gets most efficient path by road length (edge weight = road length)
+    Path MapState::getMostEfficientPath(
+        std::shared_ptr<Station> src,
+        std::shared_ptr<Station> dest,
+        std::vector<std::shared_ptr<Station>> stations,
+        std::vector<std::shared_ptr<Road>> roads)
+    {
+        return this->buildPathWithDijkstra(src, dest, stations, roads, true);
+    }
+
+    Path MapState::getShortestPath(std::shared_ptr<Station> src, std::shared_ptr<Station> dest, const std::vector<bool> &roadMask)
+    {
+        if (!checkRoadMask(roadMask, this->roads.size(), "getShortestPath"))
+        {
+            Path path;
+            path.TOTALLENGTH = 0;
+            path.NUMEDGES = 0;
+            return path;
+        }
+        int srcSlot = this->getStationSlot(src);
+        int destSlot = this->getStationSlot(dest);
+        return this->searchRoutingGraph(srcSlot, destSlot, roadMask, {}, {}, false);
+    }
+
+    Path MapState::getMostEfficientPath(std::shared_ptr<Station> src, std::shared_ptr<Station> dest, const std::vector<bool> &roadMask)
+    {
+        if (!checkRoadMask(roadMask, this->roads.size(), "getMostEfficientPath"))
+        {
+            Path path;
+            path.TOTALLENGTH = 0;
+            path.NUMEDGES = 0;
+            return path;
+        }
+        int srcSlot = this->getStationSlot(src);
+        int destSlot = this->getStationSlot(dest);
+        return this->searchRoutingGraph(srcSlot, destSlot, roadMask, {}, {}, true);
+    }
+
+    // same route cost as getMostEfficientPath, found with A* guided by the topology's landmark distances
+    Path MapState::getLandmarkPath(std::shared_ptr<Station> src, std::shared_ptr<Station> dest, const std::vector<bool> &roadMask)
+    {
+        if (!checkRoadMask(roadMask, this->roads.size(), "getLandmarkPath"))
+        {
+            Path path;
+            path.TOTALLENGTH = 0;
+            path.NUMEDGES = 0;
+            return path;
+        }
+        int srcSlot = this->getStationSlot(src);
+        int destSlot = this->getStationSlot(dest);
+        return this->searchWithLandmarks(srcSlot, destSlot, roadMask);
+    }
+
+    // same route cost as getShortestPath / getMostEfficientPath, searched over the chain-contracted graph
+    Path MapState::getContractedPath(std::shared_ptr<Station> src, std::shared_ptr<Station> dest, const std::vector<bool> &roadMask, bool useRoadLength)
+    {
+        if (!checkRoadMask(roadMask, this->roads.size(), "getContractedPath"))
+        {
+            Path path;
+            path.TOTALLENGTH = 0;
+            path.NUMEDGES = 0;
+            return path;
+        }
+        int srcSlot = this->getStationSlot(src);
+        int destSlot = this->getStationSlot(dest);
+        return this->searchContracted(srcSlot, destSlot, roadMask, useRoadLength);
+    }
+
+    // free roads whose loss would cut one of the player's outstanding tickets off within their usable network;
+    // roads they own or borrow are left out, nobody can take those any more
+    std::vector<std::shared_ptr<Road>> MapState::getChokepointRoads(int nbPlayers, std::shared_ptr<playersState::Player> player)
+    {
+        std::vector<std::shared_ptr<Road>> chokepoints;
+        if (!player)
+        {
+            return chokepoints;
+        }
+        const ChokepointAnalysis &analysis = this->refreshChokepoints(nbPlayers, player);
+        const std::vector<std::pair<int, int>> tickets = this->getOutstandingTickets(player);
+        std::vector<int> slots;
+        for (std::size_t b = 0; b < analysis.bridgeRoads.size(); ++b)
+        {
+            int road = analysis.bridgeRoads[b];
+            if (this->roadOwnerSlots[static_cast<std::size_t>(road)] >= 0)
+            {
+                continue;
+            }
+            for (const std::pair<int, int> &ticket : tickets)
+            {
+                if (analysis.separatesAtBridge(b, ticket.first, ticket.second))
+                {
+                    slots.push_back(road);
+                    break;
+                }
+            }
+        }
+        std::sort(slots.begin(), slots.end());
+        for (int slot : slots)
+        {
+            chokepoints.push_back(this->roads[static_cast<std::size_t>(slot)]);
+        }
+        return chokepoints;
+    }
+
+    // stations every route of one of the player's outstanding tickets has to pass through, endpoints excluded
+    std::vector<std::shared_ptr<Station>> MapState::getChokepointStations(int nbPlayers, std::shared_ptr<playersState::Player> player)
+    {
+        std::vector<std::shared_ptr<Station>> chokepoints;
+        if (!player)
+        {
+            return chokepoints;
+        }
+        const ChokepointAnalysis &analysis = this->refreshChokepoints(nbPlayers, player);
+        const std::vector<std::pair<int, int>> tickets = this->getOutstandingTickets(player);
+        for (std::size_t first = 0; first < analysis.cutStations.size();)
+        {
+            std::size_t last = first;
+            while (last < analysis.cutStations.size() && analysis.cutStations[last] == analysis.cutStations[first])
+            {
+                ++last;
+            }
+            for (const std::pair<int, int> &ticket : tickets)
+            {
+                if (analysis.separatesAtCut(first, last, ticket.first, ticket.second))
+                {
+                    chokepoints.push_back(this->stations[static_cast<std::size_t>(analysis.cutStations[first])]);
+                    break;
+                }
+            }
+            first = last;
+        }
+        return chokepoints;
+    }
+
+    // distance from the player's whole network (own and borrowed roads) to every station, priced like
+    // getStationDistance, with the road each station is reached by. Kept per player and searched again only
+    // once a claim or a borrow changed the roads' weights for them. The reference lives until the graph is rebuilt
+    const NetworkDistances &MapState::getNetworkDistances(std::shared_ptr<playersState::Player> player, bool useRoadLength)
+    {
+        this->ensureRoutingGraph();
+        const std::string key = (player ? player->getName() : std::string()) + "/" + (useRoadLength ? "length" : "hops");
+        const std::size_t borrowed = player ? player->getBorrowedRoads().size() : 0;
+        std::unordered_map<std::string, int>::iterator found = this->networkDistanceKeys.find(key);
+        if (found == this->networkDistanceKeys.end())
+        {
+            found = this->networkDistanceKeys.emplace(key, static_cast<int>(this->networkDistances.size())).first;
+            this->networkDistances.emplace_back();
+            this->networkDistances.back().epoch = -1;
+            this->networkDistances.back().borrowedCount = 0;
+        }
+        NetworkDistances &cached = this->networkDistances[static_cast<std::size_t>(found->second)];
+        this->refreshRoadOwners();
+        if (cached.epoch == this->roadOwnerEpoch && cached.borrowedCount == borrowed && cached.weights.size() == this->roads.size())
+        {
+            return cached;
+        }
+        cached.epoch = this->roadOwnerEpoch;
+        cached.borrowedCount = borrowed;
+
+        // claims elsewhere that leave every weight as it was keep the previous search
+        std::vector<int> weights = this->computeRoadWeights(player);
+        if (weights != cached.weights)
+        {
+            cached.build(*this->topology, weights, useRoadLength);
+            DEBUG_PRINT("network distances " << key << " searched again");
+        }
+        return cached;
+    }
+
+    // difficulty table of the catalog's tickets on this map: kept for the game once computed, and read from
+    // (or written to) cacheDirectory when one is given, under the checksum of the map and the catalog
+    std::shared_ptr<const TicketTable> MapState::getTicketTable(const std::vector<std::shared_ptr<cardsState::DestinationCard>> &catalog, const std::string &cacheDirectory)
+    {
+        this->ensureRoutingGraph();
+        std::vector<std::pair<int, int>> tickets;
+        for (const std::shared_ptr<cardsState::DestinationCard> &card : catalog)
+        {
+            int stationA = card ? this->getStationSlot(card->getstationA()) : -1;
+            int stationB = card ? this->getStationSlot(card->getstationB()) : -1;
+            if (stationA >= 0 && stationB >= 0)
+            {
+                tickets.emplace_back(std::min(stationA, stationB), std::max(stationA, stationB));
+            }
+        }
+        // the catalog comes shuffled, the table does not depend on its order
+        std::sort(tickets.begin(), tickets.end());
+        tickets.erase(std::unique(tickets.begin(), tickets.end()), tickets.end());
+        const std::uint64_t key = TicketTable::keyOf(*this->topology, tickets);
+        if (this->ticketTable && this->ticketTable->key == key)
+        {
+            return this->ticketTable;
+        }
+
+        std::string path;
+        if (!cacheDirectory.empty())
+        {
+            std::ostringstream name;
+            name << cacheDirectory << "/tickets-" << std::hex << std::setw(16) << std::setfill('0') << key << ".bin";
+            path = name.str();
+        }
+        std::shared_ptr<TicketTable> table = std::make_shared<TicketTable>();
+        if (path.empty() || !table->load(path, key))
+        {
+            table = this->computeTicketTable(tickets);
+            table->key = key;
+            if (!path.empty() && !table->save(path))
+            {
+                DEBUG_PRINT("ticket table could not be cached in " << path);
+            }
+        }
+        this->ticketTable = table;
+        return table;
+    }
+
+    // answers many (src, dest) queries at once: one search per distinct source, stopped when all of its
+    // destinations are settled, with the sources spread over the cores; paths come back in query order
+    std::vector<Path> MapState::getPaths(const std::vector<std::pair<std::shared_ptr<Station>, std::shared_ptr<Station>>> &queries, const std::vector<bool> &roadMask, bool useRoadLength)
+    {
+        std::vector<Path> paths(queries.size());
+        for (Path &path : paths)
+        {
+            path.TOTALLENGTH = 0;
+            path.NUMEDGES = 0;
+        }
+        if (!checkRoadMask(roadMask, this->roads.size(), "getPaths"))
+        {
+            return paths;
+        }
+        this->ensureRoutingGraph();
+
+        // slots are resolved up front, the searches themselves only read the routing graph
+        std::vector<int> sources;
+        std::vector<std::vector<int>> targets;
+        std::vector<std::vector<std::size_t>> members;
+        std::unordered_map<int, std::size_t> groupOf;
+        std::vector<int> destinations(queries.size(), -1);
+        for (std::size_t q = 0; q < queries.size(); ++q)
+        {
+            int src = this->getStationSlot(queries[q].first);
+            destinations[q] = this->getStationSlot(queries[q].second);
+            if (src < 0 || destinations[q] < 0)
+            {
+                continue;
+            }
+            std::unordered_map<int, std::size_t>::iterator group = groupOf.find(src);
+            if (group == groupOf.end())
+            {
+                group = groupOf.emplace(src, sources.size()).first;
+                sources.push_back(src);
+                targets.emplace_back();
+                members.emplace_back();
+            }
+            targets[group->second].push_back(destinations[q]);
+            members[group->second].push_back(q);
+        }
+
+        WorkerPool::run(sources.size(), [&](std::size_t g) {
+            std::vector<int> distances;
+            std::vector<int> viaRoad;
+            this->searchFromSource(sources[g], targets[g], roadMask, {}, useRoadLength, distances, viaRoad);
+            for (std::size_t q : members[g])
+            {
+                paths[q] = this->tracePath(sources[g], destinations[q], distances, viaRoad, {});
+            }
+        }, kMinParallelSources);
+        DEBUG_PRINT("getPaths: " << queries.size() << " queries over " << sources.size() << " sources");
+        return paths;
+    }
+
+    // up to k loopless routes from src to dest ranked by cost (Yen's algorithm), over the roads enabled in
+    // roadMask (every road when empty); double routes count as distinct roads, so they give distinct paths
+    std::vector<Path> MapState::getKShortestPaths(std::shared_ptr<Station> src, std::shared_ptr<Station> dest, int k, const std::vector<bool> &roadMask, bool useRoadLength)
+    {
+        std::vector<Path> paths;
+        if (!checkRoadMask(roadMask, this->roads.size(), "getKShortestPaths"))
+        {
+            return paths;
+        }
+        int srcSlot = this->getStationSlot(src);
+        int destSlot = this->getStationSlot(dest);
+        if (srcSlot < 0 || destSlot < 0 || k <= 0)
+        {
+            return paths;
+        }
+
+        std::vector<int> weights(this->roads.size(), kUnreachable);
+        for (std::size_t r = 0; r < this->roads.size(); ++r)
+        {
+            if (this->roads[r] && (roadMask.empty() || roadMask[r]))
+            {
+                weights[r] = useRoadLength ? this->roads[r]->getLength() : 1;
+            }
+        }
+        SpurSearch search(*this->topology, weights);
+
+        typedef std::pair<int, std::vector<int>> Candidate;
+        std::vector<Candidate> accepted;
+        std::set<Candidate> candidates;
+        std::set<std::vector<int>> known;
+        std::vector<int> route;
+        search.reset();
+        int cost = search.run(srcSlot, destSlot, route);
+        if (cost == kUnreachable)
+        {
+            return paths;
+        }
+        accepted.push_back(Candidate(cost, route));
+        known.insert(route);
+
+        while (static_cast<int>(accepted.size()) < k)
+        {
+            const std::vector<int> previous = accepted.back().second;
+            int rootCost = 0;
+            for (std::size_t j = 0; j < previous.size(); ++j)
+            {
+                // spur from the j-th station: the root up to it is kept, the roads accepted paths take
+                // next from the same root and the root's own stations are banned
+                search.reset();
+                for (const Candidate &path : accepted)
+                {
+                    if (path.second.size() > j && std::equal(previous.begin(), previous.begin() + static_cast<std::ptrdiff_t>(j), path.second.begin()))
+                    {
+                        search.banRoad(path.second[j]);
+                    }
+                }
+                int rootStation = srcSlot;
+                for (std::size_t r = 0; r < j; ++r)
+                {
+                    search.banStation(rootStation);
+                    int road = previous[r];
+                    rootStation = this->topology->roadEndpointsA[road] == rootStation ? this->topology->roadEndpointsB[road] : this->topology->roadEndpointsA[road];
+                }
+
+                route.assign(previous.begin(), previous.begin() + static_cast<std::ptrdiff_t>(j));
+                int spurCost = search.run(rootStation, destSlot, route);
+                if (spurCost != kUnreachable && known.insert(route).second)
+                {
+                    candidates.insert(Candidate(rootCost + spurCost, route));
+                }
+
+                rootCost += weights[previous[j]];
+            }
+            if (candidates.empty())
+            {
+                break;
+            }
+            accepted.push_back(*candidates.begin());
+            candidates.erase(candidates.begin());
+        }
+
+        for (const Candidate &candidate : accepted)
+        {
+            Path path;
+            int current = srcSlot;
+            path.STATIONS.push_back(this->stations[static_cast<std::size_t>(current)]);
+            for (int road : candidate.second)
+            {
+                current = this->topology->roadEndpointsA[road] == current ? this->topology->roadEndpointsB[road] : this->topology->roadEndpointsA[road];
+                path.ROADS.push_back(this->roads[static_cast<std::size_t>(road)]);
+                path.STATIONS.push_back(this->stations[static_cast<std::size_t>(current)]);
+            }
+            path.NUMEDGES = static_cast<int>(path.ROADS.size());
+            path.TOTALLENGTH = candidate.first;
+            paths.push_back(path);
+        }
+        DEBUG_PRINT("Found " << paths.size() << " of " << k << " shortest paths");
+        return paths;
+    }
+
+    // cheapest route for what the player's hand can pay (see computeHandRoadWeights); TOTALLENGTH is the
+    // expected number of cards to spend and draw, rounded up
+    Path MapState::getAffordablePath(std::shared_ptr<playersState::Player> player, std::shared_ptr<Station> src, std::shared_ptr<Station> dest)
+    {
+        Path path;
+        path.TOTALLENGTH = 0;
+        path.NUMEDGES = 0;
+        int srcSlot = this->getStationSlot(src);
+        int destSlot = this->getStationSlot(dest);
+        if (srcSlot < 0 || destSlot < 0)
+        {
+            return path;
+        }
+
+        std::vector<int> weights = this->computeHandRoadWeights(player);
+        SpurSearch search(*this->topology, weights);
+        std::vector<int> route;
+        search.reset();
+        int cost = search.run(srcSlot, destSlot, route);
+        if (cost == kUnreachable)
+        {
+            return path;
+        }
+
+        int current = srcSlot;
+        path.STATIONS.push_back(this->stations[static_cast<std::size_t>(current)]);
+        for (int road : route)
+        {
+            current = this->topology->roadEndpointsA[road] == current ? this->topology->roadEndpointsB[road] : this->topology->roadEndpointsA[road];
+            path.ROADS.push_back(this->roads[static_cast<std::size_t>(road)]);
+            path.STATIONS.push_back(this->stations[static_cast<std::size_t>(current)]);
+        }
+        path.NUMEDGES = static_cast<int>(path.ROADS.size());
+        path.TOTALLENGTH = (cost + kCardCost - 1) / kCardCost;
+        return path;
+    }
+
+    // per-road weight of the network usable by a player: own/borrowed roads are free, opponents' roads are cut
+    std::vector<int> MapState::computeRoadWeights(std::shared_ptr<playersState::Player> player)
+    {
+        this->refreshRoadOwners();
+        std::vector<int> weights(this->topology->roadLengths);
+        if (!player)
+        {
+            return weights;
+        }
+        // one branch-free sweep over the owner and length columns
+        const int self = this->findOwnerSlot(player);
+        const int *owners = this->roadOwnerSlots.data();
+        const int *lengths = this->topology->roadLengths.data();
+        int *out = weights.data();
+        for (std::size_t r = 0; r < weights.size(); ++r)
+        {
+            out[r] = owners[r] < 0 ? lengths[r] : (owners[r] == self ? 0 : kUnreachable);
+        }
+        for (const std::shared_ptr<Road> &road : player->getBorrowedRoads())
+        {
+            int slot = this->getRoadSlot(road);
+            if (slot >= 0)
+            {
+                weights[static_cast<std::size_t>(slot)] = 0;
+            }
+        }
+        return weights;
+    }
+
+    // per-road price for the player's current hand, in hundredths of a card: the cards the road takes,
+    // plus the expected tunnel surcharge, plus a penalty for every card the hand is short of. Each road is
+    // priced against the whole hand; own and borrowed roads are free and opponents' roads are cut
+    std::vector<int> MapState::computeHandRoadWeights(std::shared_ptr<playersState::Player> player)
+    {
+        std::vector<int> weights = this->computeRoadWeights(player);
+        // indexed by ColorCard
+        int colorCounts[cardsState::ColorCard::WHITE + 1] = {};
+        int locomotives = 0;
+        std::shared_ptr<cardsState::PlayerCards> hand = player ? player->getHand() : nullptr;
+        if (hand && hand->wagonCards)
+        {
+            for (const std::shared_ptr<cardsState::WagonCard> &card : hand->wagonCards->cards)
+            {
+                cardsState::ColorCard color = card ? card->getColor() : cardsState::ColorCard::UNKNOWN;
+                if (color == cardsState::ColorCard::LOCOMOTIVE)
+                {
+                    ++locomotives;
+                }
+                else if (color >= cardsState::ColorCard::RED && color <= cardsState::ColorCard::WHITE)
+                {
+                    ++colorCounts[color];
+                }
+            }
+        }
+        int bestColor = *std::max_element(std::begin(colorCounts), std::end(colorCounts));
+        const int deckSize = 8 * cardsState::WagonCard::otherInitCardsCount + cardsState::WagonCard::locomotiveInitCardsCount;
+        const int tunnelSurcharge = kTunnelRevealedCards * kCardCost * (cardsState::WagonCard::otherInitCardsCount + cardsState::WagonCard::locomotiveInitCardsCount) / deckSize;
+
+        for (std::size_t r = 0; r < this->roads.size(); ++r)
+        {
+            if (weights[r] == 0 || weights[r] == kUnreachable)
+            {
+                continue;
+            }
+            int length = this->topology->roadLengths[r];
+            cardsState::ColorCard cardColor = cardColorOf(this->topology->roadColors[r]);
+            int matching = cardColor == cardsState::ColorCard::UNKNOWN ? bestColor : colorCounts[cardColor];
+            int heldLocomotives = 0;
+            int missingLocomotives = 0;
+            int coloredNeeded = length;
+            int spareLocomotives = locomotives;
+            if (this->topology->roadKinds[r] == RoadKind::FERRY)
+            {
+                int required = std::min(this->topology->roadLocomotives[r], length);
+                heldLocomotives = std::min(required, locomotives);
+                missingLocomotives = required - heldLocomotives;
+                spareLocomotives = locomotives - heldLocomotives;
+                coloredNeeded = length - required;
+            }
+            int needed = coloredNeeded * kCardCost;
+            if (this->topology->roadKinds[r] == RoadKind::TUNNEL)
+            {
+                needed += tunnelSurcharge;
+            }
+            int missing = std::max(0, needed - (matching + spareLocomotives) * kCardCost);
+            // locomotives in hand are spent like any card, a missing one is priced once at the turn it takes
+            weights[r] = heldLocomotives * kCardCost + needed + missing * kMissingCardCost / kCardCost + missingLocomotives * kMissingLocomotiveCost;
+        }
+        return weights;
+    }
+
+    // diffs the owner column against the last look. A claim can only close routes, so it queues for a
+    // recheck just the tickets whose witness used the road or its double; a road freed or changing hands
+    // can open routes again, and then every watch is rebuilt on its next query
+    void MapState::refreshTicketWatches()
+    {
+        this->refreshRoadOwners();
+        if (this->ticketWatchEpoch == this->roadOwnerEpoch && this->ticketWatchOwners.size() == this->roadOwnerSlots.size())
+        {
+            return;
+        }
+        bool reset = this->ticketWatchOwners.size() != this->roadOwnerSlots.size();
+        std::vector<int> touched;
+        for (std::size_t r = 0; r < this->roadOwnerSlots.size() && !reset; ++r)
+        {
+            int previous = this->ticketWatchOwners[r];
+            if (previous == this->roadOwnerSlots[r])
+            {
+                continue;
+            }
+            if (previous >= 0)
+            {
+                reset = true;
+                break;
+            }
+            touched.push_back(static_cast<int>(r));
+            int group = this->topology->parallelGroupOf[r];
+            if (group < 0)
+            {
+                continue;
+            }
+            for (int i = this->topology->parallelGroupOffsets[group]; i < this->topology->parallelGroupOffsets[group + 1]; ++i)
+            {
+                if (this->topology->parallelGroupRoads[i] != static_cast<int>(r))
+                {
+                    touched.push_back(this->topology->parallelGroupRoads[i]);
+                }
+            }
+        }
+        this->ticketWatchOwners = this->roadOwnerSlots;
+        this->ticketWatchEpoch = this->roadOwnerEpoch;
+        for (TicketWatch &watch : this->ticketWatches)
+        {
+            if (reset)
+            {
+                // budgets are never negative, so the next query rebuilds the watch
+                watch.borrowBudget = -1;
+                continue;
+            }
+            for (int ticket : watch.ticketsUsing(touched))
+            {
+                if (std::find(watch.staleTickets.begin(), watch.staleTickets.end(), ticket) == watch.staleTickets.end())
+                {
+                    watch.staleTickets.push_back(ticket);
+                }
+            }
+        }
+    }
+
+    // brings the player's watch up to date: rebuilt when the hand, the station budget or the borrows
+    // changed, otherwise only the tickets queued by refreshTicketWatches are searched again
+    TicketWatch &MapState::refreshTicketWatch(int nbPlayers, std::shared_ptr<playersState::Player> player)
+    {
+        this->ensureRoutingGraph();
+        this->refreshTicketWatches();
+        const std::string name = player->getName();
+        const std::string key = name + "/" + std::to_string(nbPlayers);
+        std::unordered_map<std::string, int>::iterator found = this->ticketWatchKeys.find(key);
+        if (found == this->ticketWatchKeys.end())
+        {
+            found = this->ticketWatchKeys.emplace(key, static_cast<int>(this->ticketWatches.size())).first;
+            this->ticketWatches.emplace_back();
+            this->ticketWatches.back().borrowBudget = -1;
+            this->ticketWatches.back().borrowedCount = 0;
+        }
+        TicketWatch &watch = this->ticketWatches[static_cast<std::size_t>(found->second)];
+
+        // stations still in hand, plus the placed ones that have not borrowed a road yet
+        int placed = 0;
+        for (std::size_t s = 0; s < this->stations.size(); ++s)
+        {
+            std::shared_ptr<playersState::Player> owner = this->stations[s] ? this->stations[s]->getOwner() : nullptr;
+            placed += owner && owner->getName() == name ? 1 : 0;
+        }
+        const int budget = player->getNbStations() + std::max(0, placed - static_cast<int>(player->borrowedRoads.size()));
+        std::vector<int> ticketA;
+        std::vector<int> ticketB;
+        if (player->getHand() && player->getHand()->destinationCards)
+        {
+            for (const std::shared_ptr<cardsState::DestinationCard> &card : player->getHand()->destinationCards->cards)
+            {
+                ticketA.push_back(card ? this->getStationSlot(card->getstationA()) : -1);
+                ticketB.push_back(card ? this->getStationSlot(card->getstationB()) : -1);
+            }
+        }
+        if (ticketA != watch.ticketA || ticketB != watch.ticketB || budget != watch.borrowBudget || player->borrowedRoads.size() != watch.borrowedCount)
+        {
+            watch.ticketA = ticketA;
+            watch.ticketB = ticketB;
+            watch.borrowBudget = budget;
+            watch.borrowedCount = player->borrowedRoads.size();
+            watch.feasible.assign(ticketA.size(), false);
+            watch.witnesses.assign(ticketA.size(), std::vector<int>());
+            watch.roadTickets.clear();
+            watch.staleTickets.clear();
+            for (std::size_t i = 0; i < ticketA.size(); ++i)
+            {
+                watch.staleTickets.push_back(static_cast<int>(i));
+            }
+        }
+        if (watch.staleTickets.empty())
+        {
+            return watch;
+        }
+
+        const std::vector<int> costs = this->computeTicketRoadCosts(nbPlayers, player);
+        for (int ticket : watch.staleTickets)
+        {
+            std::size_t i = static_cast<std::size_t>(ticket);
+            std::vector<int> witness;
+            // stations that are not on this map are never reported as blocked
+            watch.feasible[i] = watch.ticketA[i] < 0 || watch.ticketB[i] < 0
+                                || this->searchTicketRoute(costs, budget, watch.ticketA[i], watch.ticketB[i], witness);
+            watch.setWitness(ticket, witness);
+        }
+        watch.staleTickets.clear();
+        DEBUG_PRINT("ticket watch " << key << " refreshed, budget " << budget);
+        return watch;
+    }
+
+    // the player's analysis, redone only when a claim or a borrow changed which roads they can still use:
+    // their own claims on single roads leave the network as it was and keep the previous result
+    ChokepointAnalysis &MapState::refreshChokepoints(int nbPlayers, std::shared_ptr<playersState::Player> player)
+    {
+        this->ensureRoutingGraph();
+        this->refreshRoadOwners();
+        const std::string key = player->getName() + "/" + std::to_string(nbPlayers);
+        std::unordered_map<std::string, int>::iterator found = this->chokepointKeys.find(key);
+        if (found == this->chokepointKeys.end())
+        {
+            found = this->chokepointKeys.emplace(key, static_cast<int>(this->chokepointAnalyses.size())).first;
+            this->chokepointAnalyses.emplace_back();
+            this->chokepointAnalyses.back().epoch = -1;
+            this->chokepointAnalyses.back().borrowedCount = 0;
+        }
+        ChokepointAnalysis &analysis = this->chokepointAnalyses[static_cast<std::size_t>(found->second)];
+        if (analysis.epoch == this->roadOwnerEpoch && analysis.borrowedCount == player->borrowedRoads.size()
+            && analysis.network.size() == this->roads.size())
+        {
+            return analysis;
+        }
+        analysis.epoch = this->roadOwnerEpoch;
+        analysis.borrowedCount = player->borrowedRoads.size();
+
+        const std::vector<int> costs = this->computeTicketRoadCosts(nbPlayers, player);
+        std::vector<bool> network(costs.size(), false);
+        for (std::size_t r = 0; r < costs.size(); ++r)
+        {
+            network[r] = costs[r] == 0;
+        }
+        if (network != analysis.network)
+        {
+            analysis.build(*this->topology, network);
+            DEBUG_PRINT("chokepoints " << key << ": " << analysis.bridgeRoads.size() << " bridges");
+        }
+        return analysis;
+    }
+
+    // station slots of the tickets in hand that are not completed yet
+    std::vector<std::pair<int, int>> MapState::getOutstandingTickets(std::shared_ptr<playersState::Player> player)
+    {
+        std::vector<std::pair<int, int>> tickets;
+        if (!player->getHand() || !player->getHand()->destinationCards)
+        {
+            return tickets;
+        }
+        for (const std::shared_ptr<cardsState::DestinationCard> &card : player->getHand()->destinationCards->cards)
+        {
+            if (!card || std::find(player->completedDestinations.begin(), player->completedDestinations.end(), card) != player->completedDestinations.end())
+            {
+                continue;
+            }
+            int stationA = this->getStationSlot(card->getstationA());
+            int stationB = this->getStationSlot(card->getstationB());
+            if (stationA >= 0 && stationB >= 0)
+            {
+                tickets.emplace_back(stationA, stationB);
+            }
+        }
+        return tickets;
+    }
+
+    // one length and one hop search per distinct ticket station, then the per-ticket rows, all spread over the cores
+    std::shared_ptr<TicketTable> MapState::computeTicketTable(const std::vector<std::pair<int, int>> &tickets) const
+    {
+        std::shared_ptr<TicketTable> table = std::make_shared<TicketTable>();
+        const MapTopology &topology = *this->topology;
+        std::vector<int> endpoints;
+        for (const std::pair<int, int> &ticket : tickets)
+        {
+            table->ticketA.push_back(ticket.first);
+            table->ticketB.push_back(ticket.second);
+            endpoints.push_back(ticket.first);
+            endpoints.push_back(ticket.second);
+        }
+        std::sort(endpoints.begin(), endpoints.end());
+        endpoints.erase(std::unique(endpoints.begin(), endpoints.end()), endpoints.end());
+        auto rowOf = [&](int station) {
+            return static_cast<std::size_t>(std::lower_bound(endpoints.begin(), endpoints.end(), station) - endpoints.begin());
+        };
+
+        std::vector<std::vector<int>> lengths(endpoints.size());
+        std::vector<std::vector<int>> hops(endpoints.size());
+        WorkerPool::run(endpoints.size(), [&](std::size_t i) {
+            std::vector<int> viaRoad;
+            this->searchFromSource(endpoints[i], {}, {}, {}, true, lengths[i], viaRoad);
+            this->searchFromSource(endpoints[i], {}, {}, {}, false, hops[i], viaRoad);
+        });
+
+        const std::size_t count = tickets.size();
+        table->minLengths.assign(count, -1);
+        table->minHops.assign(count, -1);
+        table->disjointRoutes.assign(count, 0);
+        std::vector<std::vector<int>> shortest(count);
+        WorkerPool::run(count, [&](std::size_t t) {
+            const int a = tickets[t].first;
+            const int b = tickets[t].second;
+            const std::vector<int> &fromA = lengths[rowOf(a)];
+            const std::vector<int> &fromB = lengths[rowOf(b)];
+            const int best = fromA[static_cast<std::size_t>(b)];
+            if (best == kUnreachable)
+            {
+                return;
+            }
+            table->minLengths[t] = best;
+            table->minHops[t] = hops[rowOf(a)][static_cast<std::size_t>(b)];
+            table->disjointRoutes[t] = topology.countDisjointRoutes(a, b);
+            // a road is on a shortest route when going through it in one direction costs no more than the best
+            for (std::size_t r = 0; r < topology.roadLengths.size(); ++r)
+            {
+                int u = topology.roadEndpointsA[r];
+                int v = topology.roadEndpointsB[r];
+                if (u < 0 || v < 0 || fromA[static_cast<std::size_t>(u)] == kUnreachable)
+                {
+                    continue;
+                }
+                long forward = static_cast<long>(fromA[static_cast<std::size_t>(u)]) + topology.roadLengths[r] + fromB[static_cast<std::size_t>(v)];
+                long backward = static_cast<long>(fromA[static_cast<std::size_t>(v)]) + topology.roadLengths[r] + fromB[static_cast<std::size_t>(u)];
+                if (forward == best || backward == best)
+                {
+                    shortest[t].push_back(static_cast<int>(r));
+                }
+            }
+        });
+
+        table->shortestRoadOffsets.assign(1, 0);
+        table->roadContention.assign(topology.roadLengths.size(), 0);
+        for (const std::vector<int> &roads : shortest)
+        {
+            for (int road : roads)
+            {
+                table->shortestRoads.push_back(road);
+                ++table->roadContention[static_cast<std::size_t>(road)];
+            }
+            table->shortestRoadOffsets.push_back(static_cast<int>(table->shortestRoads.size()));
+        }
+        DEBUG_PRINT("ticket table computed: " << count << " tickets over " << endpoints.size() << " stations");
+        return table;
+    }
+
+    // borrows needed per road: 0 for own, borrowed and still claimable roads, 1 for an opponent's road,
+    // -1 for a free road the player may not claim (the other half of a double route)
+    std::vector<int> MapState::computeTicketRoadCosts(int nbPlayers, std::shared_ptr<playersState::Player> player)
+    {
+        this->refreshRoadOwners();
+        const int self = this->findOwnerSlot(player);
+        std::vector<int> costs(this->roads.size(), -1);
+        for (std::size_t r = 0; r < this->roads.size(); ++r)
+        {
+            int owner = this->roadOwnerSlots[r];
+            if (owner < 0)
+            {
+                costs[r] = this->isRoadSlotClaimable(static_cast<int>(r), nbPlayers, player) ? 0 : -1;
+            }
+            else
+            {
+                costs[r] = owner == self ? 0 : 1;
+            }
+        }
+        for (const std::shared_ptr<Road> &road : player->borrowedRoads)
+        {
+            int slot = this->getRoadSlot(road);
+            if (slot >= 0)
+            {
+                costs[static_cast<std::size_t>(slot)] = 0;
+            }
+        }
+        return costs;
+    }
+
+    // 0-1 BFS over the road costs, giving up past borrowBudget; witness gets the road slots of the route found
+    bool MapState::searchTicketRoute(const std::vector<int> &roadCosts, int borrowBudget, int stationA, int stationB, std::vector<int> &witness) const
+    {
+        witness.clear();
+        const std::size_t n = this->stations.size();
+        std::vector<int> borrows(n, kUnreachable);
+        std::vector<int> via(n, -1);
+        std::deque<int> queue;
+        borrows[static_cast<std::size_t>(stationA)] = 0;
+        queue.push_back(stationA);
+        while (!queue.empty())
+        {
+            int current = queue.front();
+            queue.pop_front();
+            if (current == stationB)
+            {
+                break;
+            }
+            for (int e = this->topology->adjacencyOffsets[current]; e < this->topology->adjacencyOffsets[current + 1]; ++e)
+            {
+                int road = this->topology->adjacencyRoads[e];
+                int cost = roadCosts[static_cast<std::size_t>(road)];
+                if (cost < 0)
+                {
+                    continue;
+                }
+                int next = this->topology->adjacencyTargets[e];
+                int reached = borrows[static_cast<std::size_t>(current)] + cost;
+                if (reached > borrowBudget || reached >= borrows[static_cast<std::size_t>(next)])
+                {
+                    continue;
+                }
+                borrows[static_cast<std::size_t>(next)] = reached;
+                via[static_cast<std::size_t>(next)] = road;
+                if (cost == 0)
+                {
+                    queue.push_front(next);
+                }
+                else
+                {
+                    queue.push_back(next);
+                }
+            }
+        }
+        if (borrows[static_cast<std::size_t>(stationB)] > borrowBudget)
+        {
+            return false;
+        }
+        for (int station = stationB; station != stationA;)
+        {
+            int road = via[static_cast<std::size_t>(station)];
+            witness.push_back(road);
+            station = this->topology->roadEndpointsA[road] == station ? this->topology->roadEndpointsB[road] : this->topology->roadEndpointsA[road];
+        }
+        return true;
+    }
+
+
+    // single source Dijkstra over the routing graph, writing one row of a distance table
+    void MapState::computeDistanceRow(const std::vector<int> &roadWeights, int source, bool useRoadLength, int *row) const
+    {
+        const std::size_t n = this->stations.size();
+        std::fill(row, row + n, kUnreachable);
+        typedef std::pair<int, int> QueueEntry;
+        std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+        row[source] = 0;
+        queue.push(QueueEntry(0, source));
+        while (!queue.empty())
+        {
+            QueueEntry top = queue.top();
+            queue.pop();
+            int current = top.second;
+            if (top.first > row[current])
+            {
+                continue;
+            }
+            for (int e = this->topology->adjacencyOffsets[current]; e < this->topology->adjacencyOffsets[current + 1]; ++e)
+            {
+                int weight = roadWeights[this->topology->adjacencyRoads[e]];
+                if (weight == kUnreachable)
+                {
+                    continue;
+                }
+                if (!useRoadLength && weight > 0)
+                {
+                    weight = 1;
+                }
+                int next = this->topology->adjacencyTargets[e];
+                if (row[current] + weight < row[next])
+                {
+                    row[next] = row[current] + weight;
+                    queue.push(QueueEntry(row[next], next));
+                }
+            }
+        }
+    }
+
+    // brings every cached table in line with the current road owners and borrowed roads
+    void MapState::refreshDistanceTables()
+    {
+        bool borrowsChanged = false;
+        for (const std::pair<const std::string, std::shared_ptr<playersState::Player>> &entry : this->distancePlayers)
+        {
+            if (entry.second && entry.second->getBorrowedRoads().size() != this->distanceBorrowCounts[entry.first])
+            {
+                borrowsChanged = true;
+            }
+        }
+        this->refreshRoadOwners();
+        if (this->distanceEpoch == this->roadOwnerEpoch && !borrowsChanged)
+        {
+            return;
+        }
+        this->distanceEpoch = this->roadOwnerEpoch;
+
+        for (std::pair<const std::string, std::shared_ptr<playersState::Player>> &entry : this->distancePlayers)
+        {
+            if (!entry.second)
+            {
+                continue;
+            }
+            this->distanceBorrowCounts[entry.first] = entry.second->getBorrowedRoads().size();
+            std::vector<int> weights = this->computeRoadWeights(entry.second);
+            std::vector<int> &known = this->distanceRoadWeights[entry.first];
+            for (std::size_t r = 0; r < weights.size(); ++r)
+            {
+                if (weights[r] != known[r])
+                {
+                    this->applyRoadWeightChange(entry.first, static_cast<int>(r), known[r], weights[r]);
+                    known[r] = weights[r];
+                }
+            }
+        }
+    }
+
+    // updates the tables of one player after a single road changed weight
+    void MapState::applyRoadWeightChange(const std::string &key, int road, int oldWeight, int newWeight)
+    {
+        const int n = static_cast<int>(this->stations.size());
+        const int a = this->topology->roadEndpointsA[road];
+        const int b = this->topology->roadEndpointsB[road];
+        if (a < 0 || b < 0)
+        {
+            return;
+        }
+
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            bool useRoadLength = (pass == 0);
+            std::vector<int> &table = useRoadLength ? this->lengthDistances[key] : this->hopDistances[key];
+            int before = (oldWeight == kUnreachable || useRoadLength || oldWeight == 0) ? oldWeight : 1;
+            int after = (newWeight == kUnreachable || useRoadLength || newWeight == 0) ? newWeight : 1;
+            if (before == after)
+            {
+                continue;
+            }
+
+            if (after < before)
+            {
+                // cheaper road: relax every pair through it, no search needed
+                std::vector<int> fromA(table.begin() + static_cast<std::ptrdiff_t>(a) * n, table.begin() + static_cast<std::ptrdiff_t>(a + 1) * n);
+                std::vector<int> fromB(table.begin() + static_cast<std::ptrdiff_t>(b) * n, table.begin() + static_cast<std::ptrdiff_t>(b + 1) * n);
+                for (int s = 0; s < n; ++s)
+                {
+                    int *row = &table[static_cast<std::size_t>(s) * n];
+                    for (int t = 0; t < n; ++t)
+                    {
+                        if (fromA[s] != kUnreachable && fromB[t] != kUnreachable && fromA[s] + after + fromB[t] < row[t])
+                        {
+                            row[t] = fromA[s] + after + fromB[t];
+                        }
+                        if (fromB[s] != kUnreachable && fromA[t] != kUnreachable && fromB[s] + after + fromA[t] < row[t])
+                        {
+                            row[t] = fromB[s] + after + fromA[t];
+                        }
+                    }
+                }
+                continue;
+            }
+
+            // dearer or removed road: only rows whose shortest path tree uses it can change
+            std::vector<int> affected;
+            for (int s = 0; s < n; ++s)
+            {
+                const int *row = &table[static_cast<std::size_t>(s) * n];
+                if (row[a] == kUnreachable || row[b] == kUnreachable)
+                {
+                    continue;
+                }
+                if (row[a] + before == row[b] || row[b] + before == row[a])
+                {
+                    affected.push_back(s);
+                }
+            }
+            std::vector<int> weights = this->distanceRoadWeights[key];
+            weights[road] = newWeight;
+            for (int s : affected)
+            {
+                this->computeDistanceRow(weights, s, useRoadLength, &table[static_cast<std::size_t>(s) * n]);
+            }
+        }
+    }
+
+    const std::vector<int> &MapState::getDistanceTable(std::shared_ptr<playersState::Player> player, bool useRoadLength)
+    {
+        this->ensureRoutingGraph();
+        this->refreshDistanceTables();
+        std::string key = player ? player->getName() : std::string();
+        if (this->lengthDistances.find(key) == this->lengthDistances.end())
+        {
+            const std::size_t n = this->stations.size();
+            std::vector<int> weights = this->computeRoadWeights(player);
+            std::vector<int> &lengths = this->lengthDistances[key];
+            std::vector<int> &hops = this->hopDistances[key];
+            lengths.assign(n * n, kUnreachable);
+            hops.assign(n * n, kUnreachable);
+            for (std::size_t s = 0; s < n; ++s)
+            {
+                this->computeDistanceRow(weights, static_cast<int>(s), true, &lengths[s * n]);
+                this->computeDistanceRow(weights, static_cast<int>(s), false, &hops[s * n]);
+            }
+            this->distanceRoadWeights[key] = weights;
+            this->distancePlayers[key] = player;
+            this->distanceBorrowCounts[key] = player ? player->getBorrowedRoads().size() : 0;
+        }
+        return useRoadLength ? this->lengthDistances[key] : this->hopDistances[key];
+    }
+
+    // distance between two stations over the network usable by the player (whole map when player is null),
+    // own and borrowed roads count as free; -1 when unreachable
+    int MapState::getStationDistance(std::shared_ptr<playersState::Player> player, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, bool useRoadLength)
+    {
+        int a = this->getStationSlot(stationA);
+        int b = this->getStationSlot(stationB);
+        if (a < 0 || b < 0)
+        {
+            return -1;
+        }
+        const std::size_t n = this->stations.size();
+        int distance = kUnreachable;
+        if (n > kMaxDistanceTableStations)
+        {
+            std::vector<int> row(n);
+            this->computeDistanceRow(this->computeRoadWeights(player), a, useRoadLength, row.data());
+            distance = row[static_cast<std::size_t>(b)];
+        }
+        else
+        {
+            distance = this->getDistanceTable(player, useRoadLength)[static_cast<std::size_t>(a) * n + static_cast<std::size_t>(b)];
+        }
+        return distance == kUnreachable ? -1 : distance;
+    }
+
+    // wagons the player still has to lay to complete the ticket, -1 when it can no longer be completed
+    int MapState::getDestinationDistance(std::shared_ptr<playersState::Player> player, std::shared_ptr<cardsState::DestinationCard> destinationCard)
+    {
+        if (!destinationCard)
+        {
+            return -1;
+        }
+        return this->getStationDistance(player, destinationCard->getstationA(), destinationCard->getstationB(), true);
+    }
+
+    // approximate cheapest network joining every ticket endpoint: shortest path heuristic over the cached
+    // distance table, restarted from each endpoint. ROADS are the roads still to claim, TOTALLENGTH the wagons
+    // they need and STATIONS the stations the network goes through. Own and borrowed roads are free and
+    // opponents' roads are avoided; TOTALLENGTH is -1 when the endpoints can no longer all be joined
+    Path MapState::getTicketNetwork(std::shared_ptr<playersState::Player> player, const std::vector<std::shared_ptr<cardsState::DestinationCard>> &tickets)
+    {
+        Path network;
+        network.TOTALLENGTH = 0;
+        network.NUMEDGES = 0;
+        this->ensureRoutingGraph();
+
+        std::vector<int> terminals;
+        for (const std::shared_ptr<cardsState::DestinationCard> &ticket : tickets)
+        {
+            if (!ticket)
+            {
+                continue;
+            }
+            int ends[2] = {this->getStationSlot(ticket->getstationA()), this->getStationSlot(ticket->getstationB())};
+            for (int end : ends)
+            {
+                if (end < 0)
+                {
+                    network.TOTALLENGTH = -1;
+                    return network;
+                }
+                if (std::find(terminals.begin(), terminals.end(), end) == terminals.end())
+                {
+                    terminals.push_back(end);
+                }
+            }
+        }
+        if (terminals.size() == 1)
+        {
+            network.STATIONS.push_back(this->stations[static_cast<std::size_t>(terminals[0])]);
+        }
+        if (terminals.size() < 2)
+        {
+            return network;
+        }
+
+        // distances from every endpoint, straight from the cached table when the map is small enough
+        const std::size_t n = this->stations.size();
+        const std::size_t k = terminals.size();
+        std::vector<const int *> rows(k);
+        std::vector<int> ownRows;
+        std::vector<int> weights;
+        if (n > kMaxDistanceTableStations)
+        {
+            weights = this->computeRoadWeights(player);
+            ownRows.resize(k * n);
+            for (std::size_t t = 0; t < k; ++t)
+            {
+                this->computeDistanceRow(weights, terminals[t], true, &ownRows[t * n]);
+                rows[t] = &ownRows[t * n];
+            }
+        }
+        else
+        {
+            const std::vector<int> &table = this->getDistanceTable(player, true);
+            weights = this->distanceRoadWeights[player ? player->getName() : std::string()];
+            for (std::size_t t = 0; t < k; ++t)
+            {
+                rows[t] = &table[static_cast<std::size_t>(terminals[t]) * n];
+            }
+        }
+        for (std::size_t t = 1; t < k; ++t)
+        {
+            if (rows[0][terminals[t]] == kUnreachable)
+            {
+                network.TOTALLENGTH = -1;
+                return network;
+            }
+        }
+
+        int bestCost = kUnreachable;
+        std::vector<int> bestRoads;
+        std::vector<int> bestStations;
+        std::vector<char> inTree(n);
+        std::vector<char> roadUsed(this->roads.size());
+        for (std::size_t first = 0; first < k; ++first)
+        {
+            std::fill(inTree.begin(), inTree.end(), 0);
+            std::fill(roadUsed.begin(), roadUsed.end(), 0);
+            std::vector<int> treeStations(1, terminals[first]);
+            std::vector<int> chosenRoads;
+            std::vector<char> joined(k, 0);
+            inTree[static_cast<std::size_t>(terminals[first])] = 1;
+            int cost = 0;
+            while (cost < bestCost)
+            {
+                // closest endpoint not yet in the tree, and the tree station it is closest to
+                int nearest = -1;
+                int from = -1;
+                int distance = kUnreachable;
+                for (std::size_t t = 0; t < k; ++t)
+                {
+                    if (joined[t] || inTree[static_cast<std::size_t>(terminals[t])])
+                    {
+                        joined[t] = 1;
+                        continue;
+                    }
+                    for (int station : treeStations)
+                    {
+                        if (rows[t][station] < distance)
+                        {
+                            distance = rows[t][station];
+                            nearest = static_cast<int>(t);
+                            from = station;
+                        }
+                    }
+                }
+                if (nearest < 0)
+                {
+                    break;
+                }
+                joined[static_cast<std::size_t>(nearest)] = 1;
+                for (int road : traceTightRoute(this->topology->adjacencyOffsets, this->topology->adjacencyRoads, this->topology->adjacencyTargets, weights, rows[static_cast<std::size_t>(nearest)], from, terminals[static_cast<std::size_t>(nearest)]))
+                {
+                    if (roadUsed[static_cast<std::size_t>(road)])
+                    {
+                        continue;
+                    }
+                    roadUsed[static_cast<std::size_t>(road)] = 1;
+                    if (weights[static_cast<std::size_t>(road)] > 0)
+                    {
+                        cost += weights[static_cast<std::size_t>(road)];
+                        chosenRoads.push_back(road);
+                    }
+                    int ends[2] = {this->topology->roadEndpointsA[static_cast<std::size_t>(road)], this->topology->roadEndpointsB[static_cast<std::size_t>(road)]};
+                    for (int end : ends)
+                    {
+                        if (!inTree[static_cast<std::size_t>(end)])
+                        {
+                            inTree[static_cast<std::size_t>(end)] = 1;
+                            treeStations.push_back(end);
+                        }
+                    }
+                }
+            }
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestRoads = chosenRoads;
+                bestStations = treeStations;
+            }
+        }
+
+        for (int station : bestStations)
+        {
+            network.STATIONS.push_back(this->stations[static_cast<std::size_t>(station)]);
+        }
+        for (int road : bestRoads)
+        {
+            network.ROADS.push_back(this->roads[static_cast<std::size_t>(road)]);
+        }
+        network.NUMEDGES = static_cast<int>(network.ROADS.size());
+        network.TOTALLENGTH = bestCost;
+        DEBUG_PRINT("Ticket network over " << k << " stations: " << bestCost << " wagons");
+        return network;
+    }
+
+    // road slots touching a station, straight out of the adjacency table (double routes appear once per road)
+    IdSpan MapState::getIncidentRoads(int station)
+    {
+        this->ensureRoutingGraph();
+        if (station < 0 || static_cast<std::size_t>(station) >= this->stations.size())
+        {
+            return IdSpan{nullptr, nullptr};
+        }
+        const int *roads = this->topology->adjacencyRoads.data();
+        return IdSpan{roads + this->topology->adjacencyOffsets[station], roads + this->topology->adjacencyOffsets[station + 1]};
+    }
+
+    // station at the far end of each road of getIncidentRoads, in the same order
+    IdSpan MapState::getNeighborIds(int station)
+    {
+        this->ensureRoutingGraph();
+        if (station < 0 || static_cast<std::size_t>(station) >= this->stations.size())
+        {
+            return IdSpan{nullptr, nullptr};
+        }
+        const int *targets = this->topology->adjacencyTargets.data();
+        return IdSpan{targets + this->topology->adjacencyOffsets[station], targets + this->topology->adjacencyOffsets[station + 1]};
+    }
+
+    // distinct neighbours in road order, O(degree) over the adjacency table
+    std::vector<std::shared_ptr<Station>> MapState::getAdjacentStations(std::shared_ptr<Station> station)
+    {
+        int slot = this->getStationSlot(station);
+        if (slot < 0)
+        {
+            return station ? station->getAdjacentStations(this->roads) : std::vector<std::shared_ptr<Station>>();
+        }
+        std::vector<std::shared_ptr<Station>> adjacentStations;
+        IdSpan neighbors = this->getNeighborIds(slot);
+        for (std::size_t i = 0; i < neighbors.size(); ++i)
+        {
+            if (std::find(neighbors.begin(), neighbors.begin() + i, neighbors[i]) == neighbors.begin() + i)
+            {
+                adjacentStations.push_back(this->stations[static_cast<std::size_t>(neighbors[i])]);
+            }
+        }
+        return adjacentStations;
+    }
+    std::vector<std::shared_ptr<Road>> MapState::getRoadsOwnedByPlayer(std::shared_ptr<playersState::Player> player)
+    {
+        this->ensureRoutingGraph();
+        this->refreshRoadOwners();
+        std::vector<std::shared_ptr<Road>> ownedRoads;
+        int self = this->findOwnerSlot(player);
+        if (self < 0)
+        {
+            return ownedRoads;
+        }
+        for (std::size_t r = 0; r < this->roadOwnerSlots.size(); ++r)
+        {
+            if (this->roadOwnerSlots[r] == self)
+            {
+                ownedRoads.push_back(this->roads[r]);
+            }
+        }
+        return ownedRoads;
+    }
+    std::vector<std::shared_ptr<Road>> MapState::getRoadsUsableByPlayer(std::shared_ptr<playersState::Player> player)
+    {
+        return Road::getRoadsUsableByPlayer(player, this->roads);
+    }
+    bool MapState::isDestinationReached(std::vector<std::shared_ptr<Road>> playerRoads, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB)
+    {
+        if (!stationA || !stationB)
+        {
+            return false;
+        }
+        if (stationA == stationB || stationA->getName() == stationB->getName())
+        {
+            return true;
+        }
+
+        // stations interned by a map are keyed by id, anything else gets a local key from its name
+        std::unordered_map<std::string, int> foreignKeys;
+        auto stationKey = [&foreignKeys](const std::shared_ptr<Station> &station) -> int {
+            if (station->getId() >= 0)
+            {
+                return station->getId();
+            }
+            std::unordered_map<std::string, int>::const_iterator it = foreignKeys.find(station->getName());
+            if (it != foreignKeys.end())
+            {
+                return it->second;
+            }
+            int key = -2 - static_cast<int>(foreignKeys.size());
+            foreignKeys.emplace(station->getName(), key);
+            return key;
+        };
 
         // build an undirected graph from the provided roads
-        std::unordered_map<std::string, std::vector<std::string>> adjacency;
+        std::unordered_map<int, std::vector<int>> adjacency;
         for (const std::shared_ptr<Road> &road : playerRoads)
         {
             if (!road || !road->getStationA() || !road->getStationB())
             {
                 continue;
             }
-            std::string nameA = road->getStationA()->getName();
-            std::string nameB = road->getStationB()->getName();
-            adjacency[nameA].push_back(nameB);
-            adjacency[nameB].push_back(nameA);
+            int keyA = stationKey(road->getStationA());
+            int keyB = stationKey(road->getStationB());
+            adjacency[keyA].push_back(keyB);
+            adjacency[keyB].push_back(keyA);
         }
 
-        const std::string startName = stationA->getName();
-        const std::string targetName = stationB->getName();
-        if (adjacency.find(startName) == adjacency.end() || adjacency.find(targetName) == adjacency.end())
+        const int start = stationKey(stationA);
+        const int target = stationKey(stationB);
+        if (adjacency.find(start) == adjacency.end() || adjacency.find(target) == adjacency.end())
         {
             return false;
         }
 
         // BFS to check connectivity between the two stations
         // not using boost bfs to avoid need to rebuild graph
-        std::queue<std::string> toVisit;
-        std::unordered_set<std::string> visited;
-        toVisit.push(startName);
-        visited.insert(startName);
+        std::queue<int> toVisit;
+        std::unordered_set<int> visited;
+        toVisit.push(start);
+        visited.insert(start);
 
         while (!toVisit.empty())
         {
-            std::string current = toVisit.front();
+            int current = toVisit.front();
             toVisit.pop();
-            if (current == targetName)
+            if (current == target)
             {
                 return true;
             }
-            std::unordered_map<std::string, std::vector<std::string>>::const_iterator it = adjacency.find(current);
-            if (it == adjacency.end())
-            {
-                continue;
-            }
-            const std::vector<std::string> &neighbors = it->second;
-            for (std::vector<std::string>::const_iterator neighIt = neighbors.begin();
-                 neighIt != neighbors.end();
-                 ++neighIt)
+            for (int neighbor : adjacency[current])
             {
-                const std::string &neighbor = *neighIt;
                 if (visited.insert(neighbor).second)
                 {
                     toVisit.push(neighbor);
@@ -934,10 +3216,113 @@ namespace mapState
 
     bool MapState::isDestinationReached(std::shared_ptr<playersState::Player> player, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB)
     {
+        int a = this->getStationSlot(stationA);
+        int b = this->getStationSlot(stationB);
+        if (player && a >= 0 && b >= 0)
+        {
+            std::vector<int> &parents = this->refreshConnectivity(player);
+            if (a == b)
+            {
+                return true;
+            }
+            return MapState::findConnectivityRoot(parents, a) == MapState::findConnectivityRoot(parents, b);
+        }
+
         std::vector<std::shared_ptr<Road>> playerRoads = this->getRoadsUsableByPlayer(player);
 
         return MapState::isDestinationReached(playerRoads, stationA, stationB);
     }
+
+    // roots store the negated size of their set, every other entry its parent
+    int MapState::findConnectivityRoot(std::vector<int> &parents, int station)
+    {
+        int root = station;
+        while (parents[static_cast<std::size_t>(root)] >= 0)
+        {
+            root = parents[static_cast<std::size_t>(root)];
+        }
+        while (parents[static_cast<std::size_t>(station)] >= 0)
+        {
+            int next = parents[static_cast<std::size_t>(station)];
+            parents[static_cast<std::size_t>(station)] = root;
+            station = next;
+        }
+        return root;
+    }
+
+    // disjoint sets of the stations joined by a player's owned and borrowed roads;
+    // new claims and borrows are merged in, a road leaving the network forces a rebuild
+    std::vector<int> &MapState::refreshConnectivity(std::shared_ptr<playersState::Player> player)
+    {
+        this->ensureRoutingGraph();
+        const std::string key = player->getName();
+        std::vector<int> &parents = this->connectivityParents[key];
+        std::vector<bool> &included = this->connectivityRoads[key];
+        const std::size_t borrowCount = player->borrowedRoads.size();
+        this->refreshRoadOwners();
+        if (parents.size() == this->stations.size() && included.size() == this->roads.size()
+            && this->connectivityEpochs.count(key) > 0 && this->connectivityEpochs[key] == this->roadOwnerEpoch
+            && this->connectivityBorrowCounts[key] == borrowCount)
+        {
+            return parents;
+        }
+        this->connectivityEpochs[key] = this->roadOwnerEpoch;
+        this->connectivityBorrowCounts[key] = borrowCount;
+
+        std::vector<bool> usable(this->roads.size(), false);
+        for (std::size_t r = 0; r < this->roads.size(); ++r)
+        {
+            std::shared_ptr<playersState::Player> owner = this->roads[r] ? this->roads[r]->getOwner() : nullptr;
+            usable[r] = owner && owner->getName() == key;
+        }
+        for (const std::shared_ptr<Road> &road : player->borrowedRoads)
+        {
+            int slot = this->getRoadSlot(road);
+            if (slot >= 0)
+            {
+                usable[static_cast<std::size_t>(slot)] = true;
+            }
+        }
+
+        bool rebuild = parents.size() != this->stations.size() || included.size() != this->roads.size();
+        for (std::size_t r = 0; r < this->roads.size() && !rebuild; ++r)
+        {
+            rebuild = included[r] && !usable[r];
+        }
+        if (rebuild)
+        {
+            parents.assign(this->stations.size(), -1);
+            included.assign(this->roads.size(), false);
+        }
+
+        for (std::size_t r = 0; r < this->roads.size(); ++r)
+        {
+            if (!usable[r] || included[r])
+            {
+                continue;
+            }
+            included[r] = true;
+            int a = this->topology->roadEndpointsA[r];
+            int b = this->topology->roadEndpointsB[r];
+            if (a < 0 || b < 0)
+            {
+                continue;
+            }
+            int rootA = MapState::findConnectivityRoot(parents, a);
+            int rootB = MapState::findConnectivityRoot(parents, b);
+            if (rootA == rootB)
+            {
+                continue;
+            }
+            if (parents[static_cast<std::size_t>(rootA)] > parents[static_cast<std::size_t>(rootB)])
+            {
+                std::swap(rootA, rootB);
+            }
+            parents[static_cast<std::size_t>(rootA)] += parents[static_cast<std::size_t>(rootB)];
+            parents[static_cast<std::size_t>(rootB)] = rootA;
+        }
+        return parents;
+    }
     bool MapState::isDestinationReached(std::shared_ptr<playersState::Player> player, std::shared_ptr<cardsState::DestinationCard> destinationCard)
     {
         std::shared_ptr<Station> stationA = destinationCard->getstationA();
@@ -946,6 +3331,263 @@ namespace mapState
         // let's see if it works :^)
         return MapState::isDestinationReached(player, stationA, stationB);
     }
+
+    // whether the player can still complete the ticket with their own roads, the roads still claimable
+    // and the opponents' roads they have stations left to borrow; tickets in hand are answered from the watch
+    bool MapState::isTicketFeasible(int nbPlayers, std::shared_ptr<playersState::Player> player, std::shared_ptr<cardsState::DestinationCard> ticket)
+    {
+        if (!player || !ticket)
+        {
+            return false;
+        }
+        TicketWatch &watch = this->refreshTicketWatch(nbPlayers, player);
+        if (player->getHand() && player->getHand()->destinationCards)
+        {
+            const std::vector<std::shared_ptr<cardsState::DestinationCard>> &cards = player->getHand()->destinationCards->cards;
+            std::vector<std::shared_ptr<cardsState::DestinationCard>>::const_iterator held = std::find(cards.begin(), cards.end(), ticket);
+            if (held != cards.end() && static_cast<std::size_t>(held - cards.begin()) < watch.feasible.size())
+            {
+                return watch.feasible[static_cast<std::size_t>(held - cards.begin())];
+            }
+        }
+        int stationA = this->getStationSlot(ticket->getstationA());
+        int stationB = this->getStationSlot(ticket->getstationB());
+        if (stationA < 0 || stationB < 0)
+        {
+            return true;
+        }
+        std::vector<int> witness;
+        return this->searchTicketRoute(this->computeTicketRoadCosts(nbPlayers, player), watch.borrowBudget, stationA, stationB, witness);
+    }
+
+    // tickets in the player's hand that can no longer be completed, in hand order
+    std::vector<std::shared_ptr<cardsState::DestinationCard>> MapState::getBlockedTickets(int nbPlayers, std::shared_ptr<playersState::Player> player)
+    {
+        std::vector<std::shared_ptr<cardsState::DestinationCard>> blocked;
+        if (!player || !player->getHand() || !player->getHand()->destinationCards)
+        {
+            return blocked;
+        }
+        TicketWatch &watch = this->refreshTicketWatch(nbPlayers, player);
+        const std::vector<std::shared_ptr<cardsState::DestinationCard>> &cards = player->getHand()->destinationCards->cards;
+        for (std::size_t i = 0; i < cards.size() && i < watch.feasible.size(); ++i)
+        {
+            if (!watch.feasible[i])
+            {
+                blocked.push_back(cards[i]);
+            }
+        }
+        return blocked;
+    }
+    int MapState::getLongestRoute(std::shared_ptr<playersState::Player> player)
+    {
+        return this->getLongestRoutes({player})[0];
+    }
+
+    // longest continuous route of each player over the roads they own. Components already solved
+    // for a player are remembered, so after a claim only the component that changed is searched
+    // again; the remaining searches run on a few threads
+    std::vector<int> MapState::getLongestRoutes(const std::vector<std::shared_ptr<playersState::Player>> &players)
+    {
+        this->ensureRoutingGraph();
+        this->refreshRoadOwners();
+        std::vector<int> results(players.size(), 0);
+
+        struct PendingComponent
+        {
+            std::string key;
+            std::vector<int> roads;
+            int value;
+        };
+        std::vector<PendingComponent> pending;
+        std::unordered_map<std::string, std::vector<std::vector<int>>> currentComponents;
+
+        for (std::size_t p = 0; p < players.size(); ++p)
+        {
+            if (!players[p])
+            {
+                continue;
+            }
+            const std::string key = players[p]->getName();
+            if (this->longestRouteEpochs.count(key) > 0 && this->longestRouteEpochs[key] == this->roadOwnerEpoch)
+            {
+                results[p] = this->longestRouteValues[key];
+                continue;
+            }
+            if (currentComponents.count(key) > 0)
+            {
+                continue;
+            }
+
+            std::vector<int> owned;
+            std::vector<int> ownedA;
+            std::vector<int> ownedB;
+            for (std::size_t r = 0; r < this->roads.size(); ++r)
+            {
+                std::shared_ptr<playersState::Player> owner = this->roads[r] ? this->roads[r]->getOwner() : nullptr;
+                if (owner && owner->getName() == key)
+                {
+                    owned.push_back(static_cast<int>(r));
+                    ownedA.push_back(this->topology->roadEndpointsA[r]);
+                    ownedB.push_back(this->topology->roadEndpointsB[r]);
+                }
+            }
+            std::vector<std::vector<int>> &components = currentComponents[key];
+            for (const std::vector<int> &component : LongestRoute::splitComponents(ownedA, ownedB))
+            {
+                std::vector<int> slots;
+                for (int index : component)
+                {
+                    slots.push_back(owned[static_cast<std::size_t>(index)]);
+                }
+                std::map<std::vector<int>, int> &known = this->longestRouteComponents[key];
+                if (known.find(slots) == known.end())
+                {
+                    PendingComponent work;
+                    work.key = key;
+                    work.roads = slots;
+                    work.value = 0;
+                    pending.push_back(work);
+                }
+                components.push_back(slots);
+            }
+        }
+
+        std::vector<int> lengths(this->roads.size(), 0);
+        for (std::size_t r = 0; r < this->roads.size(); ++r)
+        {
+            lengths[r] = this->roads[r] ? this->roads[r]->getLength() : 0;
+        }
+        WorkerPool::run(pending.size(), [&](std::size_t w) {
+            pending[w].value = LongestRoute::solveComponent(pending[w].roads, this->topology->roadEndpointsA, this->topology->roadEndpointsB, lengths);
+        });
+
+        for (const PendingComponent &work : pending)
+        {
+            this->longestRouteComponents[work.key][work.roads] = work.value;
+        }
+        for (std::pair<const std::string, std::vector<std::vector<int>>> &entry : currentComponents)
+        {
+            // forget components that no longer exist, a merged component replaces its parts
+            std::map<std::vector<int>, int> &known = this->longestRouteComponents[entry.first];
+            std::map<std::vector<int>, int> kept;
+            int best = 0;
+            for (const std::vector<int> &component : entry.second)
+            {
+                kept[component] = known[component];
+                best = std::max(best, known[component]);
+            }
+            known.swap(kept);
+            this->longestRouteValues[entry.first] = best;
+            this->longestRouteEpochs[entry.first] = this->roadOwnerEpoch;
+        }
+        for (std::size_t p = 0; p < players.size(); ++p)
+        {
+            if (players[p])
+            {
+                results[p] = this->longestRouteValues[players[p]->getName()];
+            }
+        }
+        return results;
+    }
+
+    // for each player, the opponent roads to borrow through their placed stations so that the most
+    // ticket points are completed; borrows already recorded use up stations and stay in the network
+    std::vector<std::vector<std::shared_ptr<Road>>> MapState::getBestStationBorrows(const std::vector<std::shared_ptr<playersState::Player>> &players)
+    {
+        this->ensureRoutingGraph();
+        std::vector<StationBorrowing> problems(players.size());
+        for (std::size_t p = 0; p < players.size(); ++p)
+        {
+            StationBorrowing &problem = problems[p];
+            problem.maxBorrows = 0;
+            const std::shared_ptr<playersState::Player> &player = players[p];
+            if (!player)
+            {
+                continue;
+            }
+            const std::string name = player->getName();
+            problem.baseParents = this->refreshConnectivity(player);
+            problem.roadEndpointsA = this->topology->roadEndpointsA;
+            problem.roadEndpointsB = this->topology->roadEndpointsB;
+
+            int placed = 0;
+            for (std::size_t s = 0; s < this->stations.size(); ++s)
+            {
+                std::shared_ptr<playersState::Player> owner = this->stations[s] ? this->stations[s]->getOwner() : nullptr;
+                if (!owner || owner->getName() != name)
+                {
+                    continue;
+                }
+                ++placed;
+                std::vector<int> candidates;
+                for (int e = this->topology->adjacencyOffsets[s]; e < this->topology->adjacencyOffsets[s + 1]; ++e)
+                {
+                    int road = this->topology->adjacencyRoads[e];
+                    std::shared_ptr<playersState::Player> roadOwner = this->roads[static_cast<std::size_t>(road)]->getOwner();
+                    if (!roadOwner || roadOwner->getName() == name || std::find(candidates.begin(), candidates.end(), road) != candidates.end())
+                    {
+                        continue;
+                    }
+                    // roads between stations the network already joins (borrowed ones included) would score nothing
+                    if (MapState::findConnectivityRoot(problem.baseParents, this->topology->roadEndpointsA[road])
+                        == MapState::findConnectivityRoot(problem.baseParents, this->topology->roadEndpointsB[road]))
+                    {
+                        continue;
+                    }
+                    candidates.push_back(road);
+                }
+                if (!candidates.empty())
+                {
+                    problem.candidateRoads.push_back(candidates);
+                }
+            }
+            problem.maxBorrows = std::max(0, placed - static_cast<int>(player->borrowedRoads.size()));
+
+            std::vector<std::shared_ptr<cardsState::DestinationCard>> tickets = player->completedDestinations;
+            if (player->getHand() && player->getHand()->destinationCards)
+            {
+                for (const std::shared_ptr<cardsState::DestinationCard> &card : player->getHand()->destinationCards->cards)
+                {
+                    if (std::find(tickets.begin(), tickets.end(), card) == tickets.end())
+                    {
+                        tickets.push_back(card);
+                    }
+                }
+            }
+            for (const std::shared_ptr<cardsState::DestinationCard> &card : tickets)
+            {
+                int a = card ? this->getStationSlot(card->getstationA()) : -1;
+                int b = card ? this->getStationSlot(card->getstationB()) : -1;
+                if (a < 0 || b < 0)
+                {
+                    continue;
+                }
+                problem.ticketA.push_back(a);
+                problem.ticketB.push_back(b);
+                problem.ticketPoints.push_back(card->getPoints());
+            }
+        }
+
+        std::vector<std::vector<int>> choices(players.size());
+        WorkerPool::run(problems.size(), [&](std::size_t p) {
+            choices[p] = problems[p].solve();
+        });
+
+        std::vector<std::vector<std::shared_ptr<Road>>> borrows(players.size());
+        for (std::size_t p = 0; p < players.size(); ++p)
+        {
+            for (int road : choices[p])
+            {
+                if (road >= 0)
+                {
+                    borrows[p].push_back(this->roads[static_cast<std::size_t>(road)]);
+                }
+            }
+        }
+        return borrows;
+    }
+
     std::string MapState::toString() const
     {
         std::ostringstream out;
@@ -959,16 +3601,17 @@ namespace mapState
         std::cout << "Roads:\n";
         for (const std::shared_ptr<Road> &road : roads)
         {
-            if (typeid(*road)==typeid(Tunnel))
-            {
-                std::dynamic_pointer_cast<Tunnel>(road)->display();
-            }else if (typeid(*road)==typeid(Ferry))
-            {
-                std::dynamic_pointer_cast<Ferry>(road)->display();
-            }
-            else
+            switch (road->getKind())
             {
+            case RoadKind::TUNNEL:
+                std::static_pointer_cast<Tunnel>(road)->display();
+                break;
+            case RoadKind::FERRY:
+                std::static_pointer_cast<Ferry>(road)->display();
+                break;
+            default:
                 road->display();
+                break;
             }
             std::cout << "------------------\n";
         }
@@ -1040,7 +3683,7 @@ namespace mapState
                 {
                     continue;
                 }
-                stationsInfos.push_back(Station::genData(owner, normalizeName(name)));
+                stationsInfos.push_back(Station::genData(owner, MapTopology::normalizeName(name)));
             }
         }
 
@@ -1051,6 +3694,12 @@ namespace mapState
 
         std::vector<std::shared_ptr<Station>> stationObjects =
             Station::BatchConstructor(stationsInfos, mapState.gameGraph);
+        std::unordered_map<std::string, std::shared_ptr<Station>> stationIndex;
+        stationIndex.reserve(stationObjects.size());
+        for (const std::shared_ptr<Station>& station : stationObjects)
+        {
+            stationIndex.emplace(station->getName(), station);
+        }
 
         std::vector<RoadInfo> roadsInfos;
         std::vector<TunnelInfo> tunnelsInfos;
@@ -1061,7 +3710,7 @@ namespace mapState
         {
             for (Json::ArrayIndex i = 0; i < root["roads"].size(); ++i)
             {
-                parseRoadEntry(root["roads"][i], stationObjects, playersState, nextId,
+                parseRoadEntry(root["roads"][i], stationIndex, playersState, nextId,
                                roadsInfos, tunnelsInfos, ferrysInfos);
             }
         }
@@ -1074,7 +3723,7 @@ namespace mapState
                 {
                     entry["type"] = "TUNNEL";
                 }
-                parseRoadEntry(entry, stationObjects, playersState, nextId,
+                parseRoadEntry(entry, stationIndex, playersState, nextId,
                                roadsInfos, tunnelsInfos, ferrysInfos);
             }
         }
@@ -1087,7 +3736,7 @@ namespace mapState
                 {
                     entry["type"] = "FERRY";
                 }
-                parseRoadEntry(entry, stationObjects, playersState, nextId,
+                parseRoadEntry(entry, stationIndex, playersState, nextId,
                                roadsInfos, tunnelsInfos, ferrysInfos);
             }
         }
@@ -1096,4 +3745,61 @@ namespace mapState
         return mapState;
     }
 
+    // loads a map compiled by MapImage::compile: the records are read straight from the mapped file,
+    // roads point at their stations by index, so no JSON and no name lookups are involved
+    MapState MapState::FromImage(const std::string &imagePath, std::shared_ptr<playersState::PlayersState> playersState)
+    {
+        MapImage image;
+        if (!image.open(imagePath))
+        {
+            std::cerr << "Error: cannot load map image '" << imagePath << "'" << std::endl;
+            return MapState();
+        }
+        auto resolveOwnerName = [&playersState](const std::string &name) {
+            return (playersState && !name.empty()) ? playersState->getPlayerByName(name) : std::shared_ptr<playersState::Player>();
+        };
+
+        MapState mapState;
+        mapState.gameGraph = std::make_shared<boost::adjacency_list<>>();
+        const int stationCount = image.getStationCount();
+        const int roadCount = image.getRoadCount();
+        std::vector<StationInfo> stationsInfos;
+        stationsInfos.reserve(static_cast<std::size_t>(stationCount));
+        for (int s = 0; s < stationCount; ++s)
+        {
+            stationsInfos.push_back(Station::genData(resolveOwnerName(image.getStationOwner(s)), image.getStationName(s)));
+        }
+        mapState.stations = Station::BatchConstructor(stationsInfos, mapState.gameGraph);
+
+        std::vector<RoadInfo> roadsInfos;
+        std::vector<TunnelInfo> tunnelsInfos;
+        std::vector<FerryInfo> ferrysInfos;
+        for (int r = 0; r < roadCount; ++r)
+        {
+            std::shared_ptr<Station> stationA = mapState.stations[static_cast<std::size_t>(image.getRoadStationA(r))];
+            std::shared_ptr<Station> stationB = mapState.stations[static_cast<std::size_t>(image.getRoadStationB(r))];
+            std::shared_ptr<playersState::Player> owner = resolveOwnerName(image.getRoadOwner(r));
+            if (image.getRoadKind(r) == kImageKindFerry)
+            {
+                ferrysInfos.push_back(Ferry::genData(stationA, stationB, image.getRoadId(r), owner, image.getRoadLocomotives(r), image.getRoadLength(r)));
+            }
+            else if (image.getRoadKind(r) == kImageKindTunnel)
+            {
+                tunnelsInfos.push_back(Tunnel::genData(stationA, stationB, image.getRoadId(r), owner, image.getRoadColor(r), image.getRoadLength(r)));
+            }
+            else
+            {
+                roadsInfos.push_back(Road::genData(stationA, stationB, image.getRoadId(r), owner, image.getRoadColor(r), image.getRoadLength(r)));
+            }
+        }
+        std::vector<std::shared_ptr<Road>> roadObjects = Road::BatchConstructor(roadsInfos, mapState.gameGraph);
+        std::vector<std::shared_ptr<Tunnel>> tunnelObjects = Tunnel::BatchConstructor(tunnelsInfos, mapState.gameGraph);
+        std::vector<std::shared_ptr<Ferry>> ferryObjects = Ferry::BatchConstructor(ferrysInfos, mapState.gameGraph);
+        mapState.roads = roadObjects;
+        mapState.roads.insert(mapState.roads.end(), tunnelObjects.begin(), tunnelObjects.end());
+        mapState.roads.insert(mapState.roads.end(), ferryObjects.begin(), ferryObjects.end());
+        mapState.buildRoutingGraph();
+        return mapState;
+    }
+
 }
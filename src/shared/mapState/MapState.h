@@ -0,0 +1,222 @@
+// Generated by dia2code
+#ifndef MAPSTATE__MAPSTATE__H
+#define MAPSTATE__MAPSTATE__H
+
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include <string>
+#include <cstdlib>
+#include <map>
+#include <deque>
+#include <tuple>
+#include <utility>
+
+namespace mapState {
+  // Forward declaration
+  class MapTopology;
+  // Forward declaration
+  class TicketWatch;
+  // Forward declaration
+  class ChokepointAnalysis;
+  // Forward declaration
+  class TicketTable;
+  // Forward declaration
+  class NetworkDistances;
+  // Forward declaration
+  class MapState;
+};
+namespace playersState {
+  // Forward declaration
+  class PlayersState;
+};
+namespace mapState {
+  // Forward declaration
+  class MapFork;
+  // Forward declaration
+  class Station;
+  // Forward declaration
+  class IdSpan;
+};
+namespace playersState {
+  // Forward declaration
+  class Player;
+};
+namespace mapState {
+  // Forward declaration
+  class Road;
+  // Forward declaration
+  class Path;
+};
+namespace boost::graph {
+  // Forward declaration
+  template <  class EdgeListS ,   class GraphProperty ,   class EdgeProperty ,   class VertexProperty ,   class DirectedS ,   class VertexListS ,   class OutEdgeListS >
+  class adjacency_list;
+}
+
+#include "MapTopology.h"
+#include "TicketWatch.h"
+#include "ChokepointAnalysis.h"
+#include "TicketTable.h"
+#include "NetworkDistances.h"
+#include "playersState/PlayersState.h"
+#include "MapFork.h"
+#include "Station.h"
+#include "IdSpan.h"
+#include "playersState/Player.h"
+#include "Road.h"
+#include "Path.h"
+#include <boost//graph/adjacency_list.hpp>
+#include "RoadColor.h"
+
+namespace mapState {
+
+  /** MapState
+   * Class - 
+   */
+  class MapState {
+    // Associations
+    // Attributes
+  public:
+    std::shared_ptr<boost::adjacency_list<>> gameGraph;
+    std::vector<std::shared_ptr<Station>> stations;
+    std::vector<std::shared_ptr<Road>> roads;
+  private:
+    std::unordered_map<const Station*, int> stationSlots;
+    std::unordered_map<const Road*, int> roadSlots;
+    std::unordered_map<std::string, std::vector<std::shared_ptr<Road>>> claimableViews;
+    std::unordered_map<std::string, std::vector<bool>> claimableFlags;
+    std::unordered_map<std::string, std::shared_ptr<playersState::Player>> claimablePlayers;
+    std::unordered_map<std::string, int> claimablePlayerCounts;
+    std::vector<int> claimableOwners;
+    int claimableEpoch;
+    std::unordered_map<std::string, std::vector<int>> connectivityParents;
+    std::unordered_map<std::string, std::vector<bool>> connectivityRoads;
+    std::unordered_map<std::string, int> connectivityEpochs;
+    std::unordered_map<std::string, std::size_t> connectivityBorrowCounts;
+    std::unordered_map<std::string, std::map<std::vector<int>, int>> longestRouteComponents;
+    std::unordered_map<std::string, int> longestRouteValues;
+    std::unordered_map<std::string, int> longestRouteEpochs;
+    std::shared_ptr<const MapTopology> topology;
+    std::vector<int> roadOwnerSlots;
+    std::vector<std::shared_ptr<playersState::Player>> roadOwnerTable;
+    /// owner generation of this map, bumped by refreshRoadOwners when it sees an owner change; the ownership caches below are keyed on it
+    int roadOwnerEpoch;
+    std::shared_ptr<const std::vector<int>> forkOwners;
+    std::shared_ptr<const std::vector<std::shared_ptr<playersState::Player>>> forkOwnerTable;
+    int forkEpoch;
+    std::vector<TicketWatch> ticketWatches;
+    std::vector<ChokepointAnalysis> chokepointAnalyses;
+    std::unordered_map<std::string,int> chokepointKeys;
+    std::shared_ptr<const TicketTable> ticketTable;
+    std::unordered_map<std::string,int> ticketWatchKeys;
+    std::vector<int> ticketWatchOwners;
+    int ticketWatchEpoch;
+    std::unordered_map<std::string, std::vector<int>> lengthDistances;
+    std::unordered_map<std::string, std::vector<int>> hopDistances;
+    std::unordered_map<std::string, std::vector<int>> distanceRoadWeights;
+    std::unordered_map<std::string, std::shared_ptr<playersState::Player>> distancePlayers;
+    std::unordered_map<std::string, std::size_t> distanceBorrowCounts;
+    int distanceEpoch;
+    std::deque<NetworkDistances> networkDistances;
+    std::unordered_map<std::string,int> networkDistanceKeys;
+    // Operations
+  public:
+    MapState ();
+    MapState (std::vector<std::tuple<std::shared_ptr<playersState::Player>,std::string>> stationsInfos, std::vector<std::pair<std::pair<std::shared_ptr<Station>,std::shared_ptr<Station>>,std::tuple<int, std::shared_ptr<playersState::Player>, RoadColor, int>>> roadsInfos, std::vector<std::pair<std::pair<std::shared_ptr<Station>,std::shared_ptr<Station>>,std::tuple<int, std::shared_ptr<playersState::Player>, RoadColor, int>>> tunnelsInfos, std::vector<std::pair<std::pair<std::shared_ptr<Station>,std::shared_ptr<Station>>,std::tuple<int, std::shared_ptr<playersState::Player>, int, int>>> ferrysInfos, std::shared_ptr<boost::adjacency_list<>> gameGraph);
+    static MapState Test ();
+    static MapState Europe ();
+    static MapState NamedMapState (std::string mapName);
+    static MapState ParseFromJSON (std::string json, std::shared_ptr<playersState::PlayersState> playersState);
+    static MapState FromImage (const std::string& imagePath, std::shared_ptr<playersState::PlayersState> playersState);
+    void fillMapWithInfos (std::vector<std::tuple<std::shared_ptr<playersState::Player>,std::string>> stationsInfos, std::vector<std::pair<std::pair<std::shared_ptr<Station>,std::shared_ptr<Station>>,std::tuple<int, std::shared_ptr<playersState::Player>, RoadColor, int>>> roadsInfos, std::vector<std::pair<std::pair<std::shared_ptr<Station>,std::shared_ptr<Station>>,std::tuple<int, std::shared_ptr<playersState::Player>, RoadColor, int>>> tunnelsInfos, std::vector<std::pair<std::pair<std::shared_ptr<Station>,std::shared_ptr<Station>>,std::tuple<int, std::shared_ptr<playersState::Player>, int, int>>> ferrysInfos, std::shared_ptr<boost::adjacency_list<>> gameGraph);
+    ~MapState ();
+    void display (int indent = 0) const;
+    std::vector<std::shared_ptr<Station>> getStations () const;
+    std::vector<std::shared_ptr<Road>> getRoads () const;
+    const std::vector<int>& getRoadLengths ();
+    const std::vector<RoadColor>& getRoadColors ();
+    const std::vector<RoadKind>& getRoadKinds ();
+    const std::vector<int>& getRoadLocomotives ();
+    const std::vector<int>& getRoadEndpointsA ();
+    const std::vector<int>& getRoadEndpointsB ();
+    const std::vector<int>& getRoadOwnerSlots ();
+    const std::vector<std::shared_ptr<playersState::Player>>& getRoadOwnerTable ();
+    std::shared_ptr<const MapTopology> getTopology ();
+    MapFork fork ();
+    std::shared_ptr<Station> getStationByName (const std::string& name);
+    std::shared_ptr<Station> getStationById (int id);
+    int getStationId (const std::string& name);
+    std::shared_ptr<Road> getRoadByID (int id);
+    std::vector<std::shared_ptr<Road>> getRoadsBetweenStations (std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB);
+    IdSpan getIncidentRoads (int station);
+    IdSpan getNeighborIds (int station);
+    std::vector<std::shared_ptr<Station>> getAdjacentStations (std::shared_ptr<Station> station);
+    const std::vector<std::shared_ptr<Road>>& getClaimableRoadsView (int nbPlayers, std::shared_ptr<playersState::Player> player);
+    std::vector<std::shared_ptr<Road>> getParallelRoads (std::shared_ptr<Road> road);
+    std::vector<std::shared_ptr<Road>> getClaimableRoads (int nbPlayers, std::shared_ptr<playersState::Player> player);
+    std::vector<std::shared_ptr<Road>> getRoadsOwnedByPlayer (std::shared_ptr<playersState::Player> player);
+    std::vector<std::shared_ptr<Road>> getRoadsUsableByPlayer (std::shared_ptr<playersState::Player> player);
+    bool isRoadClaimable (int nbPLayers, std::shared_ptr<mapState::Road> road, std::shared_ptr<playersState::Player> player);
+    Path getShortestPath (std::shared_ptr<Station> src, std::shared_ptr<Station> dest, std::vector<std::shared_ptr<Station>> stations, std::vector<std::shared_ptr<Road>> roads);
+    Path getMostEfficientPath (std::shared_ptr<Station> src, std::shared_ptr<Station> dest, std::vector<std::shared_ptr<Station>> stations, std::vector<std::shared_ptr<Road>> roads);
+    std::vector<bool> getRoadMask (const std::vector<std::shared_ptr<Road>>& roads);
+    Path getShortestPath (std::shared_ptr<Station> src, std::shared_ptr<Station> dest, const std::vector<bool>& roadMask);
+    Path getMostEfficientPath (std::shared_ptr<Station> src, std::shared_ptr<Station> dest, const std::vector<bool>& roadMask);
+    Path getLandmarkPath (std::shared_ptr<Station> src, std::shared_ptr<Station> dest, const std::vector<bool>& roadMask);
+    Path getContractedPath (std::shared_ptr<Station> src, std::shared_ptr<Station> dest, const std::vector<bool>& roadMask, bool useRoadLength);
+    std::vector<std::shared_ptr<Road>> getChokepointRoads (int nbPlayers, std::shared_ptr<playersState::Player> player);
+    std::vector<std::shared_ptr<Station>> getChokepointStations (int nbPlayers, std::shared_ptr<playersState::Player> player);
+    const NetworkDistances& getNetworkDistances (std::shared_ptr<playersState::Player> player, bool useRoadLength);
+    std::shared_ptr<const TicketTable> getTicketTable (const std::vector<std::shared_ptr<cardsState::DestinationCard>>& catalog, const std::string& cacheDirectory);
+    std::vector<Path> getPaths (const std::vector<std::pair<std::shared_ptr<Station>, std::shared_ptr<Station>>>& queries, const std::vector<bool>& roadMask, bool useRoadLength);
+    std::vector<Path> getKShortestPaths (std::shared_ptr<Station> src, std::shared_ptr<Station> dest, int k, const std::vector<bool>& roadMask, bool useRoadLength);
+    Path getAffordablePath (std::shared_ptr<playersState::Player> player, std::shared_ptr<Station> src, std::shared_ptr<Station> dest);
+    int getStationDistance (std::shared_ptr<playersState::Player> player, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, bool useRoadLength);
+    int getDestinationDistance (std::shared_ptr<playersState::Player> player, std::shared_ptr<cardsState::DestinationCard> destinationCard);
+    Path getTicketNetwork (std::shared_ptr<playersState::Player> player, const std::vector<std::shared_ptr<cardsState::DestinationCard>>& tickets);
+    int getLongestRoute (std::shared_ptr<playersState::Player> player);
+    std::vector<int> getLongestRoutes (const std::vector<std::shared_ptr<playersState::Player>>& players);
+    std::vector<std::vector<std::shared_ptr<Road>>> getBestStationBorrows (const std::vector<std::shared_ptr<playersState::Player>>& players);
+    bool isTicketFeasible (int nbPlayers, std::shared_ptr<playersState::Player> player, std::shared_ptr<cardsState::DestinationCard> ticket);
+    std::vector<std::shared_ptr<cardsState::DestinationCard>> getBlockedTickets (int nbPlayers, std::shared_ptr<playersState::Player> player);
+    std::string toString () const;
+    static bool isDestinationReached (std::vector<std::shared_ptr<Road>> playerRoads , std::shared_ptr<Station> stationA , std::shared_ptr<Station> stationB);
+    bool isDestinationReached (std::shared_ptr<playersState::Player> player, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB);
+    bool isDestinationReached (std::shared_ptr<playersState::Player> player, std::shared_ptr<cardsState::DestinationCard> destinationCard);
+  private:
+    Path buildPathWithDijkstra (std::shared_ptr<Station> src, std::shared_ptr<Station> dest, const std::vector<std::shared_ptr<Station>>& stations, const std::vector<std::shared_ptr<Road>>& roads, bool useRoadLength);
+    void buildRoutingGraph ();
+    void ensureRoutingGraph ();
+    int getStationSlot (std::shared_ptr<Station> station);
+    int getRoadSlot (std::shared_ptr<Road> road);
+    bool isRoadSlotClaimable (int slot, int nbPlayers, std::shared_ptr<playersState::Player> player) const;
+    void refreshRoadOwners ();
+    int findOwnerSlot (std::shared_ptr<playersState::Player> player) const;
+    void refreshClaimableViews ();
+    std::vector<int>& refreshConnectivity (std::shared_ptr<playersState::Player> player);
+    static int findConnectivityRoot (std::vector<int>& parents, int station);
+    Path searchRoutingGraph (int src, int dest, const std::vector<bool>& roadMask, const std::vector<bool>& stationMask, const std::vector<std::shared_ptr<Station>>& stationObjects, bool useRoadLength) const;
+    std::vector<int> computeRoadWeights (std::shared_ptr<playersState::Player> player);
+    std::vector<int> computeHandRoadWeights (std::shared_ptr<playersState::Player> player);
+    void refreshTicketWatches ();
+    TicketWatch& refreshTicketWatch (int nbPlayers, std::shared_ptr<playersState::Player> player);
+    std::vector<int> computeTicketRoadCosts (int nbPlayers, std::shared_ptr<playersState::Player> player);
+    bool searchTicketRoute (const std::vector<int>& roadCosts, int borrowBudget, int stationA, int stationB, std::vector<int>& witness) const;
+    void searchFromSource (int src, const std::vector<int>& targets, const std::vector<bool>& roadMask, const std::vector<bool>& stationMask, bool useRoadLength, std::vector<int>& distances, std::vector<int>& viaRoad) const;
+    Path tracePath (int src, int dest, const std::vector<int>& distances, const std::vector<int>& viaRoad, const std::vector<std::shared_ptr<Station>>& stationObjects) const;
+    Path searchWithLandmarks (int src, int dest, const std::vector<bool>& roadMask) const;
+    Path searchContracted (int src, int dest, const std::vector<bool>& roadMask, bool useRoadLength) const;
+    ChokepointAnalysis& refreshChokepoints (int nbPlayers, std::shared_ptr<playersState::Player> player);
+    std::vector<std::pair<int, int>> getOutstandingTickets (std::shared_ptr<playersState::Player> player);
+    std::shared_ptr<TicketTable> computeTicketTable (const std::vector<std::pair<int, int>>& tickets) const;
+    void computeDistanceRow (const std::vector<int>& roadWeights, int source, bool useRoadLength, int* row) const;
+    const std::vector<int>& getDistanceTable (std::shared_ptr<playersState::Player> player, bool useRoadLength);
+    void refreshDistanceTables ();
+    void applyRoadWeightChange (const std::string& key, int road, int oldWeight, int newWeight);
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,563 @@
+#include "MapTopology.h"
+#include <algorithm>
+#include <cctype>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <queue>
+
+#define DEBUG_MODE false
+#if DEBUG_MODE == true
+#define DEBUG
+#define DEBUG_PRINT(x) std::cout << x << std::endl
+#else
+#define DEBUG_PRINT(x)
+#endif
+
+namespace mapState
+{
+    namespace {
+
+        typedef std::unordered_map<std::size_t, std::weak_ptr<const MapTopology>> Registry;
+
+        // every live topology by fingerprint; games drop their reference when they end and the entry expires.
+        // Function statics, since maps built during static initialisation intern their topology too
+        Registry &registry()
+        {
+            static Registry entries;
+            return entries;
+        }
+
+        std::mutex &registryMutex()
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        // landmarks kept per map for the A* heuristic; a few already cut most searches down
+        const int kLandmarkCount = 8;
+
+        // road-length distance from source to every station, -1 where it cannot be reached
+        std::vector<int> lengthDistances(const MapTopology &topology, int source)
+        {
+            std::vector<int> distances(topology.stationNames.size(), -1);
+            typedef std::pair<int, int> QueueEntry;
+            std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+            distances[static_cast<std::size_t>(source)] = 0;
+            queue.push(QueueEntry(0, source));
+            while (!queue.empty())
+            {
+                QueueEntry top = queue.top();
+                queue.pop();
+                int current = top.second;
+                if (top.first > distances[static_cast<std::size_t>(current)])
+                {
+                    continue;
+                }
+                for (int e = topology.adjacencyOffsets[current]; e < topology.adjacencyOffsets[current + 1]; ++e)
+                {
+                    int next = topology.adjacencyTargets[e];
+                    int reached = top.first + topology.roadLengths[static_cast<std::size_t>(topology.adjacencyRoads[e])];
+                    if (distances[static_cast<std::size_t>(next)] < 0 || reached < distances[static_cast<std::size_t>(next)])
+                    {
+                        distances[static_cast<std::size_t>(next)] = reached;
+                        queue.push(QueueEntry(reached, next));
+                    }
+                }
+            }
+            return distances;
+        }
+
+        // farthest-point selection: each landmark is the station farthest from the ones already picked,
+        // stations in another component counting as farthest so every component gets one
+        void pickLandmarks(MapTopology &topology)
+        {
+            const std::size_t n = topology.stationNames.size();
+            const std::size_t count = std::min<std::size_t>(kLandmarkCount, n);
+            topology.landmarkStations.clear();
+            topology.landmarkDistances.assign(n * count, -1);
+            if (count == 0)
+            {
+                return;
+            }
+            std::vector<int> nearest(n, -1);
+            std::vector<int> start = lengthDistances(topology, 0);
+            int next = static_cast<int>(std::max_element(start.begin(), start.end()) - start.begin());
+            for (std::size_t l = 0; l < count; ++l)
+            {
+                topology.landmarkStations.push_back(next);
+                std::vector<int> distances = lengthDistances(topology, next);
+                for (std::size_t s = 0; s < n; ++s)
+                {
+                    topology.landmarkDistances[s * count + l] = distances[s];
+                    if (distances[s] >= 0 && (nearest[s] < 0 || distances[s] < nearest[s]))
+                    {
+                        nearest[s] = distances[s];
+                    }
+                }
+                // stations still unreached by every landmark come first, then the farthest one
+                next = -1;
+                for (std::size_t s = 0; s < n; ++s)
+                {
+                    if (std::find(topology.landmarkStations.begin(), topology.landmarkStations.end(), static_cast<int>(s)) != topology.landmarkStations.end())
+                    {
+                        continue;
+                    }
+                    if (next < 0 || (nearest[s] < 0 && nearest[static_cast<std::size_t>(next)] >= 0)
+                        || (nearest[s] >= 0 && nearest[static_cast<std::size_t>(next)] >= 0 && nearest[s] > nearest[static_cast<std::size_t>(next)]))
+                    {
+                        next = static_cast<int>(s);
+                    }
+                }
+                if (next < 0)
+                {
+                    break;
+                }
+            }
+        }
+
+        // collapses runs of pass-through stations into chains between the stations that are kept: those
+        // without exactly two roads to two different neighbours, plus one station of every ring made only
+        // of pass-through stations
+        void contractChains(MapTopology &topology)
+        {
+            const std::size_t n = topology.stationNames.size();
+            std::vector<int> &offsets = topology.adjacencyOffsets;
+            std::vector<char> kept(n, 0);
+            for (std::size_t s = 0; s < n; ++s)
+            {
+                int first = offsets[s];
+                kept[s] = offsets[s + 1] - first != 2 || topology.adjacencyTargets[first] == topology.adjacencyTargets[first + 1]
+                          || topology.adjacencyTargets[first] == static_cast<int>(s);
+            }
+            topology.stationChain.assign(n, -1);
+            topology.stationChainPos.assign(n, -1);
+            topology.chainOffsets.assign(1, 0);
+            topology.chainStations.clear();
+            topology.chainRoads.clear();
+            topology.chainPrefix.clear();
+            std::vector<int> roadChain(topology.roadLengths.size(), -1);
+            std::vector<std::vector<int>> incident(n);
+
+            auto walkFrom = [&](int start) {
+                for (int e = offsets[start]; e < offsets[start + 1]; ++e)
+                {
+                    int road = topology.adjacencyRoads[e];
+                    if (roadChain[static_cast<std::size_t>(road)] >= 0)
+                    {
+                        continue;
+                    }
+                    const int chain = static_cast<int>(topology.chainOffsets.size()) - 1;
+                    int current = start;
+                    int length = 0;
+                    topology.chainStations.push_back(start);
+                    topology.chainPrefix.push_back(0);
+                    while (true)
+                    {
+                        roadChain[static_cast<std::size_t>(road)] = chain;
+                        topology.chainRoads.push_back(road);
+                        length += topology.roadLengths[static_cast<std::size_t>(road)];
+                        current = topology.roadEndpointsA[static_cast<std::size_t>(road)] == current ? topology.roadEndpointsB[static_cast<std::size_t>(road)]
+                                                                                                     : topology.roadEndpointsA[static_cast<std::size_t>(road)];
+                        if (kept[static_cast<std::size_t>(current)])
+                        {
+                            break;
+                        }
+                        topology.stationChain[static_cast<std::size_t>(current)] = chain;
+                        topology.stationChainPos[static_cast<std::size_t>(current)] = static_cast<int>(topology.chainStations.size());
+                        topology.chainStations.push_back(current);
+                        topology.chainPrefix.push_back(length);
+                        int first = offsets[current];
+                        road = topology.adjacencyRoads[first] == road ? topology.adjacencyRoads[first + 1] : topology.adjacencyRoads[first];
+                    }
+                    topology.chainStations.push_back(current);
+                    topology.chainPrefix.push_back(length);
+                    topology.chainOffsets.push_back(static_cast<int>(topology.chainStations.size()));
+                    incident[static_cast<std::size_t>(start)].push_back(chain * 2);
+                    incident[static_cast<std::size_t>(current)].push_back(chain * 2 + 1);
+                }
+            };
+            for (std::size_t s = 0; s < n; ++s)
+            {
+                if (kept[s])
+                {
+                    walkFrom(static_cast<int>(s));
+                }
+            }
+            for (std::size_t s = 0; s < n; ++s)
+            {
+                if (!kept[s] && topology.stationChain[s] < 0)
+                {
+                    kept[s] = 1;
+                    walkFrom(static_cast<int>(s));
+                }
+            }
+
+            topology.contractedOffsets.assign(1, 0);
+            topology.contractedChains.clear();
+            for (std::size_t s = 0; s < n; ++s)
+            {
+                topology.contractedChains.insert(topology.contractedChains.end(), incident[s].begin(), incident[s].end());
+                topology.contractedOffsets.push_back(static_cast<int>(topology.contractedChains.size()));
+            }
+        }
+
+        void combine(std::size_t &seed, std::size_t value)
+        {
+            seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+        }
+
+        // station index of every road end: the map's own station objects first, then by name
+        // for roads built against foreign copies of the stations; -1 when the end is missing
+        void resolveEndpoints(const std::vector<std::shared_ptr<Station>> &stations, const std::vector<std::shared_ptr<Road>> &roads,
+                              const std::unordered_map<std::string, int> &stationIndex, std::vector<int> &endpointsA, std::vector<int> &endpointsB)
+        {
+            std::unordered_map<const Station *, int> slots;
+            slots.reserve(stations.size());
+            for (std::size_t i = 0; i < stations.size(); ++i)
+            {
+                if (stations[i])
+                {
+                    slots.emplace(stations[i].get(), static_cast<int>(i));
+                }
+            }
+            auto resolve = [&](const std::shared_ptr<Station> &station) {
+                std::unordered_map<const Station *, int>::const_iterator own = slots.find(station.get());
+                if (own != slots.end())
+                {
+                    return own->second;
+                }
+                std::unordered_map<std::string, int>::const_iterator named = stationIndex.find(station->getName());
+                if (named == stationIndex.end())
+                {
+                    named = stationIndex.find(MapTopology::normalizeName(station->getName()));
+                }
+                return named == stationIndex.end() ? -1 : named->second;
+            };
+
+            endpointsA.assign(roads.size(), -1);
+            endpointsB.assign(roads.size(), -1);
+            for (std::size_t r = 0; r < roads.size(); ++r)
+            {
+                const std::shared_ptr<Road> &road = roads[r];
+                if (!road || !road->getStationA() || !road->getStationB())
+                {
+                    continue;
+                }
+                int a = resolve(road->getStationA());
+                int b = resolve(road->getStationB());
+                if (a < 0 || b < 0)
+                {
+                    continue;
+                }
+                endpointsA[r] = a;
+                endpointsB[r] = b;
+            }
+        }
+
+    }
+
+    // tables of the routing graph: CSR adjacency, per-road columns, id lookup and double-route groups
+    std::shared_ptr<const MapTopology> MapTopology::build(const std::vector<std::shared_ptr<Station>> &stations, const std::vector<std::shared_ptr<Road>> &roads)
+    {
+        std::shared_ptr<MapTopology> topology = std::make_shared<MapTopology>();
+        topology->fingerprint = MapTopology::fingerprintOf(stations, roads);
+
+        topology->stationNames.assign(stations.size(), std::string());
+        for (std::size_t i = 0; i < stations.size(); ++i)
+        {
+            if (!stations[i])
+            {
+                continue;
+            }
+            topology->stationNames[i] = stations[i]->getName();
+            topology->stationIndex.emplace(MapTopology::normalizeName(stations[i]->getName()), static_cast<int>(i));
+        }
+
+        topology->roadIds.assign(roads.size(), -1);
+        topology->roadLengths.assign(roads.size(), 0);
+        topology->roadColors.assign(roads.size(), RoadColor::UNKNOWN);
+        topology->roadKinds.assign(roads.size(), RoadKind::ROAD);
+        topology->roadLocomotives.assign(roads.size(), 0);
+        for (std::size_t r = 0; r < roads.size(); ++r)
+        {
+            const std::shared_ptr<Road> &road = roads[r];
+            if (!road)
+            {
+                continue;
+            }
+            topology->roadIds[r] = road->id;
+            topology->roadLengths[r] = road->getLength();
+            topology->roadColors[r] = road->getColor();
+            topology->roadKinds[r] = road->getKind();
+            topology->roadLocomotives[r] = road->getLocomotives();
+        }
+        resolveEndpoints(stations, roads, topology->stationIndex, topology->roadEndpointsA, topology->roadEndpointsB);
+
+        std::vector<int> &offsets = topology->adjacencyOffsets;
+        offsets.assign(stations.size() + 1, 0);
+        for (std::size_t r = 0; r < roads.size(); ++r)
+        {
+            if (topology->roadEndpointsA[r] >= 0)
+            {
+                ++offsets[static_cast<std::size_t>(topology->roadEndpointsA[r]) + 1];
+                ++offsets[static_cast<std::size_t>(topology->roadEndpointsB[r]) + 1];
+            }
+        }
+        for (std::size_t i = 1; i < offsets.size(); ++i)
+        {
+            offsets[i] += offsets[i - 1];
+        }
+        topology->adjacencyRoads.assign(static_cast<std::size_t>(offsets.back()), -1);
+        topology->adjacencyTargets.assign(static_cast<std::size_t>(offsets.back()), -1);
+        std::vector<int> cursor(offsets.begin(), offsets.end() - 1);
+        for (std::size_t r = 0; r < roads.size(); ++r)
+        {
+            int a = topology->roadEndpointsA[r];
+            int b = topology->roadEndpointsB[r];
+            if (a < 0 || b < 0)
+            {
+                continue;
+            }
+            topology->adjacencyRoads[static_cast<std::size_t>(cursor[a])] = static_cast<int>(r);
+            topology->adjacencyTargets[static_cast<std::size_t>(cursor[a]++)] = b;
+            topology->adjacencyRoads[static_cast<std::size_t>(cursor[b])] = static_cast<int>(r);
+            topology->adjacencyTargets[static_cast<std::size_t>(cursor[b]++)] = a;
+        }
+
+        // dense id -> slot table, ids that would blow the table up stay out of it
+        int maxId = -1;
+        for (int id : topology->roadIds)
+        {
+            if (id >= 0 && static_cast<std::size_t>(id) <= 4 * roads.size() + 64)
+            {
+                maxId = std::max(maxId, id);
+            }
+        }
+        topology->roadIdSlots.assign(static_cast<std::size_t>(maxId + 1), -1);
+        for (std::size_t r = 0; r < roads.size(); ++r)
+        {
+            int id = topology->roadIds[r];
+            if (id >= 0 && id <= maxId && topology->roadIdSlots[static_cast<std::size_t>(id)] < 0)
+            {
+                topology->roadIdSlots[static_cast<std::size_t>(id)] = static_cast<int>(r);
+            }
+        }
+
+        // double routes: roads sharing both endpoints form one group, single roads get no group
+        topology->parallelGroupOf.assign(roads.size(), -1);
+        topology->parallelGroupOffsets.assign(1, 0);
+        for (std::size_t r = 0; r < roads.size(); ++r)
+        {
+            int a = topology->roadEndpointsA[r];
+            int b = topology->roadEndpointsB[r];
+            if (a < 0 || b < 0 || topology->parallelGroupOf[r] >= 0)
+            {
+                continue;
+            }
+            std::vector<int> members;
+            for (int e = offsets[a]; e < offsets[a + 1]; ++e)
+            {
+                if (topology->adjacencyTargets[e] == b && (members.empty() || members.back() != topology->adjacencyRoads[e]))
+                {
+                    members.push_back(topology->adjacencyRoads[e]);
+                }
+            }
+            if (members.size() < 2)
+            {
+                continue;
+            }
+            int group = static_cast<int>(topology->parallelGroupOffsets.size()) - 1;
+            for (int member : members)
+            {
+                topology->parallelGroupOf[static_cast<std::size_t>(member)] = group;
+                topology->parallelGroupRoads.push_back(member);
+            }
+            topology->parallelGroupOffsets.push_back(static_cast<int>(topology->parallelGroupRoads.size()));
+        }
+        pickLandmarks(*topology);
+        contractChains(*topology);
+        DEBUG_PRINT("MapTopology built: " << stations.size() << " stations, " << roads.size() << " roads");
+        return topology;
+    }
+
+    // topology for these stations and roads, reusing the one another game already holds for the same board
+    std::shared_ptr<const MapTopology> MapTopology::intern(const std::vector<std::shared_ptr<Station>> &stations, const std::vector<std::shared_ptr<Road>> &roads)
+    {
+        std::size_t fingerprint = MapTopology::fingerprintOf(stations, roads);
+        {
+            std::lock_guard<std::mutex> lock(registryMutex());
+            Registry::iterator found = registry().find(fingerprint);
+            if (found != registry().end())
+            {
+                std::shared_ptr<const MapTopology> shared = found->second.lock();
+                if (shared && shared->matches(stations, roads))
+                {
+                    return shared;
+                }
+            }
+        }
+
+        std::shared_ptr<const MapTopology> built = MapTopology::build(stations, roads);
+        std::lock_guard<std::mutex> lock(registryMutex());
+        std::weak_ptr<const MapTopology> &slot = registry()[fingerprint];
+        std::shared_ptr<const MapTopology> raced = slot.lock();
+        if (raced && raced->matches(stations, roads))
+        {
+            return raced;
+        }
+        slot = built;
+        // sweep boards nobody plays any more so the registry stays as small as the set of live maps
+        for (Registry::iterator it = registry().begin(); it != registry().end();)
+        {
+            it = it->second.expired() ? registry().erase(it) : std::next(it);
+        }
+        return built;
+    }
+
+    // hash of everything the tables are built from; ownership is left out on purpose
+    std::size_t MapTopology::fingerprintOf(const std::vector<std::shared_ptr<Station>> &stations, const std::vector<std::shared_ptr<Road>> &roads)
+    {
+        std::hash<std::string> hashName;
+        std::size_t seed = stations.size();
+        combine(seed, roads.size());
+        for (const std::shared_ptr<Station> &station : stations)
+        {
+            combine(seed, station ? hashName(station->getName()) : 0);
+        }
+        for (const std::shared_ptr<Road> &road : roads)
+        {
+            if (!road)
+            {
+                combine(seed, 0);
+                continue;
+            }
+            combine(seed, static_cast<std::size_t>(road->id));
+            combine(seed, road->getStationA() ? hashName(road->getStationA()->getName()) : 0);
+            combine(seed, road->getStationB() ? hashName(road->getStationB()->getName()) : 0);
+            combine(seed, static_cast<std::size_t>(road->getLength()));
+            combine(seed, static_cast<std::size_t>(road->getColor()));
+            combine(seed, static_cast<std::size_t>(road->getKind()));
+            combine(seed, static_cast<std::size_t>(road->getLocomotives()));
+        }
+        return seed;
+    }
+
+    std::size_t MapTopology::getSharedCount()
+    {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        std::size_t live = 0;
+        for (const Registry::value_type &entry : registry())
+        {
+            live += entry.second.expired() ? 0 : 1;
+        }
+        return live;
+    }
+
+    // true when build would give the same tables for these stations and roads
+    bool MapTopology::matches(const std::vector<std::shared_ptr<Station>> &stations, const std::vector<std::shared_ptr<Road>> &roads) const
+    {
+        if (stations.size() != this->stationNames.size() || roads.size() != this->roadIds.size())
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < stations.size(); ++i)
+        {
+            if ((stations[i] ? stations[i]->getName() : std::string()) != this->stationNames[i])
+            {
+                return false;
+            }
+        }
+        for (std::size_t r = 0; r < roads.size(); ++r)
+        {
+            const std::shared_ptr<Road> &road = roads[r];
+            if (!road)
+            {
+                if (this->roadIds[r] != -1 || this->roadLengths[r] != 0)
+                {
+                    return false;
+                }
+                continue;
+            }
+            if (road->id != this->roadIds[r] || road->getLength() != this->roadLengths[r] || road->getColor() != this->roadColors[r]
+                || road->getKind() != this->roadKinds[r] || road->getLocomotives() != this->roadLocomotives[r])
+            {
+                return false;
+            }
+        }
+        std::vector<int> endpointsA;
+        std::vector<int> endpointsB;
+        resolveEndpoints(stations, roads, this->stationIndex, endpointsA, endpointsB);
+        return endpointsA == this->roadEndpointsA && endpointsB == this->roadEndpointsB;
+    }
+
+    // trimmed lower-case name, the key of stationIndex
+    std::string MapTopology::normalizeName(const std::string &value)
+    {
+        std::size_t start = 0;
+        while (start < value.size() && std::isspace(static_cast<unsigned char>(value[start])))
+        {
+            ++start;
+        }
+        std::size_t end = value.size();
+        while (end > start && std::isspace(static_cast<unsigned char>(value[end - 1])))
+        {
+            --end;
+        }
+        std::string lower = value.substr(start, end - start);
+        std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) {
+            return static_cast<char>(std::tolower(c));
+        });
+        return lower;
+    }
+
+    // routes from stationA to stationB sharing no road: unit-capacity max flow, each road usable once in either direction
+    int MapTopology::countDisjointRoutes(int stationA, int stationB) const
+    {
+        if (stationA == stationB)
+        {
+            return 0;
+        }
+        // +1 when the road carries a route from its first station to its second, -1 the other way
+        std::vector<int> flow(this->roadLengths.size(), 0);
+        std::vector<int> viaEdge(this->stationNames.size(), -1);
+        int routes = 0;
+        while (true)
+        {
+            std::fill(viaEdge.begin(), viaEdge.end(), -1);
+            std::vector<int> queue = {stationA};
+            viaEdge[static_cast<std::size_t>(stationA)] = std::numeric_limits<int>::max();
+            for (std::size_t head = 0; head < queue.size() && viaEdge[static_cast<std::size_t>(stationB)] < 0; ++head)
+            {
+                int current = queue[head];
+                for (int e = this->adjacencyOffsets[current]; e < this->adjacencyOffsets[current + 1]; ++e)
+                {
+                    int road = this->adjacencyRoads[e];
+                    int next = this->adjacencyTargets[e];
+                    int direction = this->roadEndpointsA[static_cast<std::size_t>(road)] == current ? 1 : -1;
+                    if (viaEdge[static_cast<std::size_t>(next)] >= 0 || flow[static_cast<std::size_t>(road)] == direction)
+                    {
+                        continue;
+                    }
+                    viaEdge[static_cast<std::size_t>(next)] = e;
+                    queue.push_back(next);
+                }
+            }
+            if (viaEdge[static_cast<std::size_t>(stationB)] < 0)
+            {
+                return routes;
+            }
+            for (int current = stationB; current != stationA;)
+            {
+                int e = viaEdge[static_cast<std::size_t>(current)];
+                int road = this->adjacencyRoads[e];
+                int previous = this->roadEndpointsA[static_cast<std::size_t>(road)] == current ? this->roadEndpointsB[static_cast<std::size_t>(road)]
+                                                                                               : this->roadEndpointsA[static_cast<std::size_t>(road)];
+                flow[static_cast<std::size_t>(road)] += this->roadEndpointsA[static_cast<std::size_t>(road)] == previous ? 1 : -1;
+                current = previous;
+            }
+            ++routes;
+        }
+    }
+}
@@ -0,0 +1,83 @@
+// Generated by dia2code
+#ifndef MAPSTATE__MAPTOPOLOGY__H
+#define MAPSTATE__MAPTOPOLOGY__H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdlib>
+#include <memory>
+
+namespace mapState {
+  // Forward declaration
+  class Station;
+  // Forward declaration
+  class Road;
+}
+
+#include "RoadColor.h"
+#include "RoadKind.h"
+#include "Station.h"
+#include "Road.h"
+
+namespace mapState {
+
+  /** MapTopology
+   * Class - 
+   * immutable station and road tables of a map, shared by every game played on the same board
+   */
+  class MapTopology {
+    // Attributes
+  public:
+    std::vector<std::string> stationNames;
+    std::unordered_map<std::string,int> stationIndex;
+    std::vector<int> adjacencyOffsets;
+    std::vector<int> adjacencyRoads;
+    std::vector<int> adjacencyTargets;
+    std::vector<int> roadIds;
+    std::vector<int> roadEndpointsA;
+    std::vector<int> roadEndpointsB;
+    std::vector<int> roadLengths;
+    std::vector<RoadColor> roadColors;
+    std::vector<RoadKind> roadKinds;
+    std::vector<int> roadLocomotives;
+    std::vector<int> roadIdSlots;
+    std::vector<int> parallelGroupOf;
+    std::vector<int> parallelGroupOffsets;
+    std::vector<int> parallelGroupRoads;
+    /// stations picked as A* landmarks, spread out by farthest-point selection
+    std::vector<int> landmarkStations;
+    /// road-length distance from each landmark, one row of landmarkStations.size() entries per station, -1 when unreachable
+    std::vector<int> landmarkDistances;
+    /// chain a pass-through station (exactly two roads, to two different stations) lies on, -1 for the stations kept in the contracted graph
+    std::vector<int> stationChain;
+    /// position of a pass-through station in chainStations, -1 for kept stations
+    std::vector<int> stationChainPos;
+    /// CSR offsets of the contracted graph, one entry per station plus one; only kept stations have edges
+    std::vector<int> contractedOffsets;
+    /// chain * 2 + direction of each contracted edge, direction 1 walking the chain from its last station
+    std::vector<int> contractedChains;
+    /// offsets of each chain in chainStations; chain c has its roads at chainOffsets[c] - c onwards in chainRoads
+    std::vector<int> chainOffsets;
+    /// stations of every chain in order, both kept end stations included
+    std::vector<int> chainStations;
+    /// road slots of every chain in order
+    std::vector<int> chainRoads;
+    /// road length from the first station of the chain, aligned with chainStations
+    std::vector<int> chainPrefix;
+    std::size_t fingerprint;
+    // Operations
+  public:
+    static std::shared_ptr<const MapTopology> build (const std::vector<std::shared_ptr<Station>>& stations, const std::vector<std::shared_ptr<Road>>& roads);
+    static std::shared_ptr<const MapTopology> intern (const std::vector<std::shared_ptr<Station>>& stations, const std::vector<std::shared_ptr<Road>>& roads);
+    static std::size_t fingerprintOf (const std::vector<std::shared_ptr<Station>>& stations, const std::vector<std::shared_ptr<Road>>& roads);
+    static std::size_t getSharedCount ();
+    bool matches (const std::vector<std::shared_ptr<Station>>& stations, const std::vector<std::shared_ptr<Road>>& roads) const;
+    static std::string normalizeName (const std::string& value);
+    int countDisjointRoutes (int stationA, int stationB) const;
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,101 @@
+#include "NetworkDistances.h"
+#include "MapTopology.h"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+
+namespace mapState
+{
+    namespace {
+
+        // weight of a road the player cannot use, as in MapState::computeRoadWeights
+        const int kUnreachable = std::numeric_limits<int>::max();
+
+    }
+
+    // one Dijkstra seeded with every end of a free (own or borrowed) road, so each station gets its distance
+    // to the nearest station of the network; hop counts treat every priced road as 1
+    void NetworkDistances::build(const MapTopology &topology, const std::vector<int> &roadWeights, bool useRoadLength)
+    {
+        const std::size_t n = topology.stationNames.size();
+        this->weights = roadWeights;
+        this->useRoadLength = useRoadLength;
+        std::vector<int> settled(n, kUnreachable);
+        this->previous.assign(n, -1);
+        this->viaRoads.assign(n, -1);
+        this->origins.assign(n, -1);
+
+        typedef std::pair<int, int> QueueEntry;
+        std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+        for (std::size_t r = 0; r < roadWeights.size(); ++r)
+        {
+            if (roadWeights[r] != 0)
+            {
+                continue;
+            }
+            for (int station : {topology.roadEndpointsA[r], topology.roadEndpointsB[r]})
+            {
+                if (station >= 0 && settled[static_cast<std::size_t>(station)] != 0)
+                {
+                    settled[static_cast<std::size_t>(station)] = 0;
+                    this->origins[static_cast<std::size_t>(station)] = station;
+                    queue.push(QueueEntry(0, station));
+                }
+            }
+        }
+
+        while (!queue.empty())
+        {
+            QueueEntry top = queue.top();
+            queue.pop();
+            int current = top.second;
+            if (top.first > settled[static_cast<std::size_t>(current)])
+            {
+                continue;
+            }
+            for (int e = topology.adjacencyOffsets[current]; e < topology.adjacencyOffsets[current + 1]; ++e)
+            {
+                int road = topology.adjacencyRoads[e];
+                int weight = roadWeights[static_cast<std::size_t>(road)];
+                if (weight == kUnreachable)
+                {
+                    continue;
+                }
+                if (!useRoadLength && weight > 0)
+                {
+                    weight = 1;
+                }
+                int next = topology.adjacencyTargets[e];
+                if (top.first + weight < settled[static_cast<std::size_t>(next)])
+                {
+                    settled[static_cast<std::size_t>(next)] = top.first + weight;
+                    this->previous[static_cast<std::size_t>(next)] = current;
+                    this->viaRoads[static_cast<std::size_t>(next)] = road;
+                    this->origins[static_cast<std::size_t>(next)] = this->origins[static_cast<std::size_t>(current)];
+                    queue.push(QueueEntry(settled[static_cast<std::size_t>(next)], next));
+                }
+            }
+        }
+
+        this->distances.resize(n);
+        std::transform(settled.begin(), settled.end(), this->distances.begin(), [](int distance) { return distance == kUnreachable ? -1 : distance; });
+    }
+
+    // road slots leading from the network to station, nearest the network first; empty when the station is on
+    // the network or out of reach
+    std::vector<int> NetworkDistances::routeTo(int station) const
+    {
+        std::vector<int> route;
+        if (station < 0 || static_cast<std::size_t>(station) >= this->distances.size() || this->distances[static_cast<std::size_t>(station)] < 0)
+        {
+            return route;
+        }
+        for (int current = station; this->previous[static_cast<std::size_t>(current)] >= 0; current = this->previous[static_cast<std::size_t>(current)])
+        {
+            route.push_back(this->viaRoads[static_cast<std::size_t>(current)]);
+        }
+        std::reverse(route.begin(), route.end());
+        return route;
+    }
+}
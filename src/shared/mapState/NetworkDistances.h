@@ -0,0 +1,44 @@
+// Generated by dia2code
+#ifndef MAPSTATE__NETWORKDISTANCES__H
+#define MAPSTATE__NETWORKDISTANCES__H
+
+#include <vector>
+#include <cstdlib>
+
+namespace mapState {
+  // Forward declaration
+  class MapTopology;
+}
+
+namespace mapState {
+
+  /** NetworkDistances
+   * Class - 
+   * distances from every station of one player's network (own and borrowed roads) to the rest of the map, from one multi-source search
+   */
+  class NetworkDistances {
+    // Attributes
+  public:
+    /// road weights the search ran on, the cache stays valid while they do
+    std::vector<int> weights;
+    bool useRoadLength;
+    int epoch;
+    std::size_t borrowedCount;
+    /// per station, 0 on the network and -1 when it cannot be reached
+    std::vector<int> distances;
+    /// station before each one on its route from the network, -1 on the network and when unreachable
+    std::vector<int> previous;
+    /// road slot reaching each station from previous
+    std::vector<int> viaRoads;
+    /// network station each route starts from
+    std::vector<int> origins;
+    // Operations
+  public:
+    void build (const MapTopology& topology, const std::vector<int>& roadWeights, bool useRoadLength);
+    std::vector<int> routeTo (int station) const;
+    // Setters and Getters
+  };
+
+};
+
+#endif
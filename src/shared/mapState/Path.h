@@ -0,0 +1,19 @@
+// Generated by dia2code
+#ifndef MAPSTATE__PATH__H
+#define MAPSTATE__PATH__H
+
+#include <vector>
+#include <memory>
+
+namespace mapState {
+
+  struct Path {
+    std::vector<std::shared_ptr<Station>> STATIONS;
+    std::vector<std::shared_ptr<Road>> ROADS;
+    int TOTALLENGTH;
+    int NUMEDGES;
+  };
+
+};
+
+#endif
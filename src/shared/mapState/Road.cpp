@@ -19,6 +19,35 @@ namespace mapState
     using RoadDetail = std::tuple<int, std::shared_ptr<playersState::Player>, RoadColor, int>;
     using RoadInfo = std::pair<StationPair, RoadDetail>;
 
+    namespace {
+
+        // edge of a road built outside any graph: null endpoints and no edge property
+        boost::adjacency_list<>::edge_descriptor detachedEdge()
+        {
+            boost::adjacency_list<>::vertex_descriptor none = boost::graph_traits<boost::adjacency_list<>>::null_vertex();
+            return boost::adjacency_list<>::edge_descriptor(none, none, nullptr);
+        }
+
+        // interned stations compare by id, names are only compared when ids cannot tell them apart
+        bool isSameStation(const std::shared_ptr<Station> &first, const std::shared_ptr<Station> &second)
+        {
+            if (first == second)
+            {
+                return true;
+            }
+            if (!first || !second)
+            {
+                return false;
+            }
+            if (first->id >= 0 && second->id >= 0 && first->id != second->id)
+            {
+                return false;
+            }
+            return first->name == second->name;
+        }
+
+    }
+
     RoadColor Road::possibleColors[10] = {
         RoadColor::UNKNOWN,
         RoadColor::RED,
@@ -46,10 +75,11 @@ namespace mapState
     Road::Road()
     {
         this->id = -1;
+        this->edge = detachedEdge();
         this->color = RoadColor::UNKNOWN;
         this->length = -1;
     }
-    Road::Road(int id, std::shared_ptr<playersState::Player> owner, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, RoadColor color, int length, std::shared_ptr<boost::adjacency_list<>::edge_descriptor> edge)
+    Road::Road(int id, std::shared_ptr<playersState::Player> owner, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, RoadColor color, int length, boost::adjacency_list<>::edge_descriptor edge)
     {
         DEBUG_PRINT("Road creation started ...");
         this->id = id;
@@ -61,12 +91,15 @@ namespace mapState
         this->edge = edge;
         DEBUG_PRINT("Road " << this->id << " created !");
     }
+    Road::Road(int id, std::shared_ptr<playersState::Player> owner, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, RoadColor color, int length)
+        : Road(id, owner, stationA, stationB, color, length, detachedEdge())
+    {
+    }
     Road Road::Init(int id, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, RoadColor color, int length, std::shared_ptr<boost::adjacency_list<>> gameGraph)
     {
         DEBUG_PRINT("Road creation started ...");
         std::shared_ptr<playersState::Player> owner = nullptr;
-        std::shared_ptr<boost::adjacency_list<>::edge_descriptor> edge = std::make_shared<boost::adjacency_list<>::edge_descriptor>(
-            boost::add_edge(*(stationA->getVertex().get()), *(stationB->getVertex().get()), *gameGraph).first);
+        boost::adjacency_list<>::edge_descriptor edge = boost::add_edge(stationA->getVertex(), stationB->getVertex(), *gameGraph).first;
         DEBUG_PRINT("Road " << id << " created !");
         return Road(id, owner, stationA, stationB, color, length, edge);
     }
@@ -88,11 +121,7 @@ namespace mapState
             std::shared_ptr<playersState::Player> owner = std::get<1>(detail);
             RoadColor color = std::get<2>(detail);
             int length = std::get<3>(detail);
-            std::shared_ptr<std::size_t> stationAVertex = stationA->getVertex();
-            std::shared_ptr<std::size_t> stationBVertex = stationB->getVertex();
-            std::shared_ptr<boost::adjacency_list<>::edge_descriptor> edgeDescriptor =
-                std::make_shared<boost::adjacency_list<>::edge_descriptor>(
-                    boost::add_edge(*(stationA->getVertex().get()), *(stationB->getVertex().get()), *gameGraph).first);
+            boost::adjacency_list<>::edge_descriptor edgeDescriptor = boost::add_edge(stationA->getVertex(), stationB->getVertex(), *gameGraph).first;
             roads.push_back(std::make_shared<Road>(id, owner, stationA, stationB, color, length, edgeDescriptor));
         }
         return roads;
@@ -141,6 +170,16 @@ namespace mapState
     {
         return this->length;
     }
+    // plain roads; tunnels and ferries override it so callers can switch without a cast
+    RoadKind Road::getKind()
+    {
+        return RoadKind::ROAD;
+    }
+    // only ferries ask for locomotives
+    int Road::getLocomotives()
+    {
+        return 0;
+    }
     std::shared_ptr<playersState::Player> Road::getOwner()
     {
         return this->owner;
@@ -150,7 +189,7 @@ namespace mapState
         this->owner = owner;
     }
     
-    bool Road::isClaimable(std::vector<std::shared_ptr<Road>> roads, int nbPlayers, std::shared_ptr<playersState::Player> player)
+    bool Road::isClaimable(const std::vector<std::shared_ptr<Road>> &roads, int nbPlayers, std::shared_ptr<playersState::Player> player)
     {
         bool claimable = this->owner == nullptr;
         if (!claimable)
@@ -176,7 +215,7 @@ namespace mapState
         return claimable;
     }
 
-    std::vector<std::shared_ptr<Road>> Road::getClaimableRoads(std::vector<std::shared_ptr<Road>> roads, int nbPlayers, std::shared_ptr<playersState::Player> player)
+    std::vector<std::shared_ptr<Road>> Road::getClaimableRoads(const std::vector<std::shared_ptr<Road>> &roads, int nbPlayers, std::shared_ptr<playersState::Player> player)
     {
         std::vector<std::shared_ptr<Road>> claimable;
         for (const std::shared_ptr<Road> &road : roads)
@@ -189,31 +228,28 @@ namespace mapState
         return claimable;
     }
 
-    std::shared_ptr<boost::adjacency_list<>::edge_descriptor> Road::getEdge()
+    boost::adjacency_list<>::edge_descriptor Road::getEdge()
     {
         return this->edge;
     }
-    std::shared_ptr<boost::adjacency_list<>::vertex_descriptor> Road::getVertexA()
+    boost::adjacency_list<>::vertex_descriptor Road::getVertexA()
     {
         return this->stationA->getVertex();
     }
-    std::shared_ptr<boost::adjacency_list<>::vertex_descriptor> Road::getVertexB()
+    boost::adjacency_list<>::vertex_descriptor Road::getVertexB()
     {
         return this->stationB->getVertex();
     }
 
-    std::vector<std::shared_ptr<Road>> Road::getRoadsBetweenStations(std::vector<std::shared_ptr<Road>> roads, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB)
+    std::vector<std::shared_ptr<Road>> Road::getRoadsBetweenStations(const std::vector<std::shared_ptr<Road>> &roads, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB)
     {
         std::vector<std::shared_ptr<Road>> matchingRoads = {};
         if (!(!stationA || !stationB))
         {
             for (const std::shared_ptr<Road> &road : roads)
             {
-                bool stationAAMatch = (road->stationA->getName() == stationA->getName());
-                bool stationABMatch = (road->stationB->getName() == stationA->getName());
-                bool stationBAMatch = (road->stationA->getName() == stationB->getName());
-                bool stationBBMatch = (road->stationB->getName() == stationB->getName());
-                if ((stationAAMatch && stationBBMatch) || (stationABMatch && stationBAMatch))
+                if ((isSameStation(road->stationA, stationA) && isSameStation(road->stationB, stationB)) ||
+                    (isSameStation(road->stationB, stationA) && isSameStation(road->stationA, stationB)))
                 {
                     matchingRoads.push_back(road);
                 }
@@ -0,0 +1,92 @@
+// Generated by dia2code
+#ifndef MAPSTATE__ROAD__H
+#define MAPSTATE__ROAD__H
+
+#include <string>
+#include <unordered_map>
+#include <memory>
+#include <vector>
+#include <utility>
+#include <tuple>
+
+namespace mapState {
+  // Forward declaration
+  class Station;
+};
+namespace playersState {
+  // Forward declaration
+  class Player;
+};
+namespace mapState {
+  // Forward declaration
+  class Road;
+};
+namespace boost::graph {
+  // Forward declaration
+  template <  class EdgeListS ,   class GraphProperty ,   class EdgeProperty ,   class VertexProperty ,   class DirectedS ,   class VertexListS ,   class OutEdgeListS >
+  class adjacency_list;
+}
+
+#include "RoadColor.h"
+#include "Station.h"
+#include "playersState/Player.h"
+#include "RoadKind.h"
+#include <boost//graph/adjacency_list.hpp>
+
+namespace mapState {
+
+  /** Road
+   * Class - 
+   */
+  class Road {
+    // Attributes
+  public:
+    static RoadColor possibleColors[10];
+    static std::unordered_map<RoadColor, std::string> ColorsNames;
+    int id;
+    boost::adjacency_list<>::edge_descriptor edge;
+    std::shared_ptr<Station> stationA;
+    std::shared_ptr<Station> stationB;
+    RoadColor color;
+    int length;
+    std::shared_ptr<playersState::Player> owner;
+    // Operations
+  public:
+    Road ();
+    Road (int id, std::shared_ptr<playersState::Player> owner, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, RoadColor color, int length, boost::adjacency_list<>::edge_descriptor edge);
+    Road (int id, std::shared_ptr<playersState::Player> owner, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, RoadColor color, int length);
+    static Road Init (int id, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, RoadColor color, int length, std::shared_ptr<boost::adjacency_list<>> gameGraph);
+    static std::vector<std::shared_ptr<Road>> BatchConstructor (std::vector<std::pair<std::pair<std::shared_ptr<Station>,std::shared_ptr<Station>>,std::tuple<int, std::shared_ptr<playersState::Player>, RoadColor, int>>> roadsInfos, std::shared_ptr<boost::adjacency_list<>> gameGraph);
+    static std::pair<std::pair<std::shared_ptr<Station>,std::shared_ptr<Station>>,std::tuple<int, std::shared_ptr<playersState::Player>, RoadColor, int>> genData (std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, int id, std::shared_ptr<playersState::Player> owner, RoadColor color, int length);
+    static std::pair<std::pair<std::shared_ptr<Station>,std::shared_ptr<Station>>,std::tuple<int, std::shared_ptr<playersState::Player>, RoadColor, int>> genDataByName (std::vector<std::shared_ptr<Station>>  stations, const std::string& stationAName, const std::string& stationBName, int id, std::shared_ptr<playersState::Player> owner, RoadColor color, int length);
+    static std::pair<std::pair<std::shared_ptr<Station>,std::shared_ptr<Station>>,std::tuple<int, std::shared_ptr<playersState::Player>, RoadColor, int>> initData (std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, int id, RoadColor color, int length);
+    static std::pair<std::pair<std::shared_ptr<Station>,std::shared_ptr<Station>>,std::tuple<int, std::shared_ptr<playersState::Player>, RoadColor, int>> initDataByName (std::vector<std::shared_ptr<Station>> stations, const std::string& stationAName, const std::string& stationBName, int  id, RoadColor color, int length);
+    int getId ();
+    std::shared_ptr<Station> getStationA ();
+    std::shared_ptr<Station> getStationB ();
+    RoadColor getColor ();
+    int getLength ();
+    virtual RoadKind getKind ();
+    virtual int getLocomotives ();
+    boost::adjacency_list<>::edge_descriptor getEdge ();
+    boost::adjacency_list<>::vertex_descriptor getVertexA ();
+    boost::adjacency_list<>::vertex_descriptor getVertexB ();
+    std::shared_ptr<playersState::Player> getOwner ();
+    void setOwner (std::shared_ptr<playersState::Player> owner);
+    bool isClaimable (const std::vector<std::shared_ptr<Road>>& roads, int nbPlayers, std::shared_ptr<playersState::Player> player);
+    static std::vector<std::shared_ptr<Road>> getClaimableRoads (const std::vector<std::shared_ptr<Road>>& roads, int nbPLayers, std::shared_ptr<playersState::Player> player);
+    static std::vector<std::shared_ptr<Road>> getRoadsBetweenStations (const std::vector<std::shared_ptr<Road>>& roads, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB);
+    static std::vector<std::shared_ptr<Road>> getRoadsOwnedByPlayer (std::shared_ptr<playersState::Player> player, std::vector<std::shared_ptr<Road>> roads);
+    static std::vector<std::shared_ptr<Road>> getRoadsUsableByPlayer (std::shared_ptr<playersState::Player> player, std::vector<std::shared_ptr<Road>> roads);
+    void display (int indent = 0);
+    void _display (int indent = 0);
+    virtual ~Road ();
+    static bool isDestinationReached (std::vector<std::shared_ptr<Road>> playerRoads, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB);
+    bool isDestinationReached (std::shared_ptr<playersState::Player> player, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB);
+    bool isDestinationReached (std::shared_ptr<playersState::Player> player, std::shared_ptr<cardsState::DestinationCard> destinationCard);
+    // Setters and Getters
+  };
+
+};
+
+#endif
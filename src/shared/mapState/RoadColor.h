@@ -0,0 +1,26 @@
+// Generated by dia2code
+#ifndef MAPSTATE__ROADCOLOR__H
+#define MAPSTATE__ROADCOLOR__H
+
+
+namespace mapState {
+
+  /** RoadColor
+   * Enum - 
+   */
+  enum RoadColor {
+    UNKNOWN     = 404,
+    NONE     = 0,
+    RED     = 1,
+    BLUE      = 2,
+    GREEN     = 3,
+    BLACK     = 4,
+    YELLOW     = 5,
+    ORANGE     = 6,
+    PINK     = 7,
+    WHITE     = 8
+  };
+
+};
+
+#endif
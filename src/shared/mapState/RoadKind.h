@@ -0,0 +1,19 @@
+// Generated by dia2code
+#ifndef MAPSTATE__ROADKIND__H
+#define MAPSTATE__ROADKIND__H
+
+
+namespace mapState {
+
+  /** RoadKind
+   * Enum - 
+   */
+  enum RoadKind {
+    ROAD     = 0,
+    TUNNEL     = 1,
+    FERRY     = 2
+  };
+
+};
+
+#endif
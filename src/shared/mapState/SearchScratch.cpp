@@ -0,0 +1,19 @@
+#include "SearchScratch.h"
+
+namespace mapState
+{
+    // one set per thread; a query only pays for the stations it visits instead of clearing arrays the size of the map
+    SearchScratch &SearchScratch::acquire(std::size_t stationCount)
+    {
+        thread_local SearchScratch scratch;
+        if (scratch.stamps.size() != stationCount || ++scratch.stamp == 0)
+        {
+            scratch.stamps.assign(stationCount, 0);
+            scratch.distances.assign(stationCount, 0);
+            scratch.viaRoad.assign(stationCount, -1);
+            scratch.viaStart.assign(stationCount, -1);
+            scratch.stamp = 1;
+        }
+        return scratch;
+    }
+}
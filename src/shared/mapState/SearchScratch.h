@@ -0,0 +1,36 @@
+// Generated by dia2code
+#ifndef MAPSTATE__SEARCHSCRATCH__H
+#define MAPSTATE__SEARCHSCRATCH__H
+
+#include <vector>
+#include <cstdlib>
+
+namespace mapState {
+  // Forward declaration
+  class SearchScratch;
+}
+
+namespace mapState {
+
+  /** SearchScratch
+   * Class - 
+   * per-thread buffers of the landmark and contracted searches; entries older than the current stamp count as unset
+   */
+  class SearchScratch {
+    // Attributes
+  public:
+    std::vector<unsigned int> stamps;
+    std::vector<int> distances;
+    std::vector<int> viaRoad;
+    std::vector<int> viaStart;
+    std::vector<int> targetRow;
+    unsigned int stamp     = 0;
+    // Operations
+  public:
+    static SearchScratch& acquire (std::size_t stationCount);
+    // Setters and Getters
+  };
+
+};
+
+#endif
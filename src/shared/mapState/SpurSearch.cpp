@@ -0,0 +1,93 @@
+#include "SpurSearch.h"
+#include "MapTopology.h"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+
+namespace mapState
+{
+    namespace {
+
+        // same sentinel as the road weights MapState hands in
+        const int kUnreachable = std::numeric_limits<int>::max();
+    }
+
+    SpurSearch::SpurSearch(const MapTopology &topology, const std::vector<int> &roadWeights)
+        : topology(&topology), roadWeights(&roadWeights), distances(topology.stationNames.size()), viaRoad(topology.stationNames.size()),
+          reached(topology.stationNames.size(), 0), bannedStations(topology.stationNames.size(), 0), bannedRoads(roadWeights.size(), 0), stamp(0) {}
+
+    void SpurSearch::reset()
+    {
+        ++this->stamp;
+    }
+
+    void SpurSearch::banStation(int station)
+    {
+        this->bannedStations[static_cast<std::size_t>(station)] = this->stamp;
+    }
+
+    void SpurSearch::banRoad(int road)
+    {
+        this->bannedRoads[static_cast<std::size_t>(road)] = this->stamp;
+    }
+
+    // road slots of the cheapest route avoiding the banned roads and stations, appended to route;
+    // returns its cost or kUnreachable
+    int SpurSearch::run(int src, int dest, std::vector<int> &route)
+    {
+        const std::vector<int> &offsets = this->topology->adjacencyOffsets;
+        const std::vector<int> &weights = *this->roadWeights;
+        typedef std::pair<int, int> QueueEntry;
+        std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+        this->reached[static_cast<std::size_t>(src)] = this->stamp;
+        this->distances[static_cast<std::size_t>(src)] = 0;
+        queue.push(QueueEntry(0, src));
+        while (!queue.empty())
+        {
+            QueueEntry top = queue.top();
+            queue.pop();
+            int current = top.second;
+            if (top.first > this->distances[current])
+            {
+                continue;
+            }
+            if (current == dest)
+            {
+                break;
+            }
+            for (int e = offsets[current]; e < offsets[current + 1]; ++e)
+            {
+                int road = this->topology->adjacencyRoads[e];
+                int next = this->topology->adjacencyTargets[e];
+                int weight = weights[road];
+                if (weight == kUnreachable || this->bannedRoads[road] == this->stamp || this->bannedStations[next] == this->stamp)
+                {
+                    continue;
+                }
+                if (this->reached[next] != this->stamp || top.first + weight < this->distances[next])
+                {
+                    this->reached[next] = this->stamp;
+                    this->distances[next] = top.first + weight;
+                    this->viaRoad[next] = road;
+                    queue.push(QueueEntry(this->distances[next], next));
+                }
+            }
+        }
+        if (this->reached[static_cast<std::size_t>(dest)] != this->stamp)
+        {
+            return kUnreachable;
+        }
+        const std::vector<int> &endpointsA = this->topology->roadEndpointsA;
+        const std::vector<int> &endpointsB = this->topology->roadEndpointsB;
+        std::size_t first = route.size();
+        for (int current = dest; current != src;)
+        {
+            int road = this->viaRoad[current];
+            route.push_back(road);
+            current = endpointsA[road] == current ? endpointsB[road] : endpointsA[road];
+        }
+        std::reverse(route.begin() + static_cast<std::ptrdiff_t>(first), route.end());
+        return this->distances[static_cast<std::size_t>(dest)];
+    }
+}
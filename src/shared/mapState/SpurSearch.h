@@ -0,0 +1,42 @@
+// Generated by dia2code
+#ifndef MAPSTATE__SPURSEARCH__H
+#define MAPSTATE__SPURSEARCH__H
+
+#include <vector>
+
+namespace mapState {
+  // Forward declaration
+  class MapTopology;
+}
+
+namespace mapState {
+
+  /** SpurSearch
+   * Class - 
+   * Dijkstra buffers shared by every spur search of a k shortest paths query; entries are only trusted when their stamp matches the current search
+   */
+  class SpurSearch {
+    // Attributes
+  public:
+    const MapTopology* topology;
+    /// cost of each road slot, kUnreachable for the roads the search may not use
+    const std::vector<int>* roadWeights;
+    std::vector<int> distances;
+    std::vector<int> viaRoad;
+    std::vector<unsigned int> reached;
+    std::vector<unsigned int> bannedStations;
+    std::vector<unsigned int> bannedRoads;
+    unsigned int stamp;
+    // Operations
+  public:
+    SpurSearch (const MapTopology& topology, const std::vector<int>& roadWeights);
+    void reset ();
+    void banStation (int station);
+    void banRoad (int road);
+    int run (int src, int dest, std::vector<int>& route);
+    // Setters and Getters
+  };
+
+};
+
+#endif
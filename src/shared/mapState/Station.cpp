@@ -2,6 +2,7 @@
 #include <boost/graph/adjacency_list.hpp>
 #include <iostream>
 #include <stdexcept>
+#include <unordered_set>
 
 #define DEBUG_MODE false
 #if DEBUG_MODE == true
@@ -20,23 +21,29 @@ namespace mapState
 
     Station::Station()
     {
+        this->vertex = boost::graph_traits<boost::adjacency_list<>>::null_vertex();
+        this->id = -1;
     }
 
-    Station::Station(std::string name, std::shared_ptr<playersState::Player> owner, std::shared_ptr<boost::adjacency_list<>::vertex_descriptor> vertex)
+    Station::Station(std::string name, std::shared_ptr<playersState::Player> owner, boost::adjacency_list<>::vertex_descriptor vertex)
     {
         DEBUG_PRINT("Station creation started ...");
         this->owner = owner;
         this->name = name;
         this->vertex = vertex;
+        this->id = -1;
         DEBUG_PRINT("Station " << name << " created !");
     }
+    // station kept outside any graph
+    Station::Station(std::string name, std::shared_ptr<playersState::Player> owner)
+        : Station(name, owner, boost::graph_traits<boost::adjacency_list<>>::null_vertex())
+    {
+    }
     Station Station::Init(std::string name, std::shared_ptr<boost::adjacency_list<>> gameGraph)
     {
         DEBUG_PRINT("Station creation started ...");
         std::shared_ptr<playersState::Player> owner = nullptr;
-        std::shared_ptr<boost::adjacency_list<>::vertex_descriptor> vertex =
-            std::make_shared<boost::adjacency_list<>::vertex_descriptor>(
-                boost::add_vertex(*gameGraph));
+        boost::adjacency_list<>::vertex_descriptor vertex = boost::add_vertex(*gameGraph);
         DEBUG_PRINT("Station " << name << " created !");
         return Station(name, owner, vertex);
     }
@@ -44,6 +51,14 @@ namespace mapState
     {
         return this->name;
     }
+    int Station::getId()
+    {
+        return this->id;
+    }
+    void Station::setId(int id)
+    {
+        this->id = id;
+    }
     std::shared_ptr<playersState::Player> Station::getOwner()
     {
         return this->owner;
@@ -64,41 +79,32 @@ namespace mapState
         DEBUG_PRINT("Station " << this->name << " Destroyed !");
     }
 
-    std::shared_ptr<boost::adjacency_list<>::vertex_descriptor> Station::getVertex()
+    boost::adjacency_list<>::vertex_descriptor Station::getVertex()
     {
         return this->vertex;
     }
 
+    // distinct neighbours over a loose road list; maps answer this from their adjacency table instead
     std::vector<std::shared_ptr<Station>> Station::getAdjacentStations(std::vector<std::shared_ptr<Road>> roads)
     {
         std::vector<std::shared_ptr<Station>> adjacentStations = {};
-        std::string stationName = this->name;
-        std::vector<std::string> adjacentStationNames = {};
+        std::unordered_set<std::string> adjacentStationNames;
         for (const std::shared_ptr<Road> &road : roads)
         {
             std::shared_ptr<Station> stationA = road->getStationA();
             std::shared_ptr<Station> stationB = road->getStationB();
-            bool isAlreadyAdded = false;
-            for(const std::string& name : adjacentStationNames) {
-                if(stationA->getName() == name || stationB->getName() == name) {
-                    isAlreadyAdded = true;
-                    break;
-                }
-            }
-            if(isAlreadyAdded) {
-                continue;
+            std::shared_ptr<Station> other = nullptr;
+            if (stationA->getName() == this->name)
+            {
+                other = stationB;
             }
-            if (stationA->getName() == stationName)
+            else if (stationB->getName() == this->name)
             {
-                adjacentStations.push_back(stationB);
-                adjacentStationNames.push_back(stationB->getName());
-                continue;
+                other = stationA;
             }
-            else if (stationB->getName() == stationName)
+            if (other && adjacentStationNames.insert(other->getName()).second)
             {
-                adjacentStations.push_back(stationA);
-                adjacentStationNames.push_back(stationA->getName());
-                continue;
+                adjacentStations.push_back(other);
             }
         }
         return adjacentStations;
@@ -129,9 +135,7 @@ namespace mapState
         {
             std::shared_ptr<playersState::Player> owner = std::get<0>(info);
             std::string name = std::get<1>(info);
-            std::shared_ptr<boost::adjacency_list<>::vertex_descriptor> descriptor =
-                std::make_shared<boost::adjacency_list<>::vertex_descriptor>(
-                    boost::add_vertex(*gameGraph));
+            boost::adjacency_list<>::vertex_descriptor descriptor = boost::add_vertex(*gameGraph);
             stations.push_back(std::make_shared<Station>(name, owner, descriptor));
         }
         DEBUG_PRINT("Station BatchConstructor finished !");
@@ -0,0 +1,70 @@
+// Generated by dia2code
+#ifndef MAPSTATE__STATION__H
+#define MAPSTATE__STATION__H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <tuple>
+
+namespace playersState {
+  // Forward declaration
+  class Player;
+};
+namespace mapState {
+  // Forward declaration
+  class Station;
+  // Forward declaration
+  class Road;
+};
+namespace boost::graph {
+  // Forward declaration
+  template <  class EdgeListS ,   class GraphProperty ,   class EdgeProperty ,   class VertexProperty ,   class DirectedS ,   class VertexListS ,   class OutEdgeListS >
+  class adjacency_list;
+}
+
+#include "playersState/Player.h"
+#include "Road.h"
+#include <boost//graph/adjacency_list.hpp>
+
+namespace mapState {
+
+  /** Station
+   * Class - 
+   */
+  class Station {
+    // Associations
+    // Attributes
+  public:
+    std::shared_ptr<playersState::Player> owner;
+    std::string name;
+    boost::adjacency_list<>::vertex_descriptor vertex;
+    /// dense index of the station in its map, -1 until the map interns it
+    int id;
+    // Operations
+  public:
+    Station ();
+    Station (std::string name, std::shared_ptr<playersState::Player> owner, boost::adjacency_list<>::vertex_descriptor vertex);
+    Station (std::string name, std::shared_ptr<playersState::Player> owner);
+    static Station Init (std::string name, std::shared_ptr<boost::adjacency_list<>> gameGraph);
+    ~Station ();
+    void display (int indent = 0);
+    void _display (int indent = 0);
+    std::string getName ();
+    int getId ();
+    void setId (int id);
+    boost::adjacency_list<>::vertex_descriptor getVertex ();
+    std::shared_ptr<playersState::Player> getOwner ();
+    void setOwner (std::shared_ptr<playersState::Player> owner);
+    bool isClaimable ();
+    std::vector<std::shared_ptr<Station>> getAdjacentStations (std::vector<std::shared_ptr<Road>> roads);
+    static std::shared_ptr<Station> getStationByName (std::vector<std::shared_ptr<Station>> stations, const std::string& name);
+    static std::vector<std::shared_ptr<Station>> BatchConstructor (std::vector<std::tuple<std::shared_ptr<playersState::Player>,std::string>> stationInfos, std::shared_ptr<boost::adjacency_list<>> gameGraph);
+    static std::tuple<std::shared_ptr<playersState::Player>,std::string> genData (std::shared_ptr<playersState::Player> owner, std::string name);
+    static std::tuple<std::shared_ptr<playersState::Player>,std::string> initData (std::string name);
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,152 @@
+#include "StationBorrowing.h"
+#include <algorithm>
+#include <iostream>
+
+#define DEBUG_MODE false
+#if DEBUG_MODE == true
+#define DEBUG
+#define DEBUG_PRINT(x) std::cout << x << std::endl
+#else
+#define DEBUG_PRINT(x)
+#endif
+
+namespace mapState
+{
+    namespace {
+
+        int findRoot(std::vector<int> &parents, int station)
+        {
+            int root = station;
+            while (parents[static_cast<std::size_t>(root)] >= 0)
+            {
+                root = parents[static_cast<std::size_t>(root)];
+            }
+            while (parents[static_cast<std::size_t>(station)] >= 0)
+            {
+                int next = parents[static_cast<std::size_t>(station)];
+                parents[static_cast<std::size_t>(station)] = root;
+                station = next;
+            }
+            return root;
+        }
+
+        void unite(std::vector<int> &parents, int a, int b)
+        {
+            if (a < 0 || b < 0)
+            {
+                return;
+            }
+            int rootA = findRoot(parents, a);
+            int rootB = findRoot(parents, b);
+            if (rootA == rootB)
+            {
+                return;
+            }
+            if (parents[static_cast<std::size_t>(rootA)] > parents[static_cast<std::size_t>(rootB)])
+            {
+                std::swap(rootA, rootB);
+            }
+            parents[static_cast<std::size_t>(rootA)] += parents[static_cast<std::size_t>(rootB)];
+            parents[static_cast<std::size_t>(rootB)] = rootA;
+        }
+
+        struct Search
+        {
+            const StationBorrowing &problem;
+            std::vector<int> choice;
+            std::vector<int> bestChoice;
+            int best;
+
+            explicit Search(const StationBorrowing &problem) : problem(problem), best(-1) {}
+
+            int points(std::vector<int> &parents) const
+            {
+                int total = 0;
+                for (std::size_t t = 0; t < problem.ticketA.size(); ++t)
+                {
+                    if (findRoot(parents, problem.ticketA[t]) == findRoot(parents, problem.ticketB[t]))
+                    {
+                        total += problem.ticketPoints[t];
+                    }
+                }
+                return total;
+            }
+
+            // parents already holds the roads picked for the stations before index
+            void explore(std::size_t index, const std::vector<int> &parents, int borrowsLeft)
+            {
+                std::vector<int> current = parents;
+                int value = points(current);
+                if (value > best)
+                {
+                    best = value;
+                    bestChoice = choice;
+                }
+                if (index >= problem.candidateRoads.size() || borrowsLeft == 0)
+                {
+                    return;
+                }
+
+                // bound: even borrowing every remaining candidate at once cannot beat the best found
+                std::vector<int> relaxed = parents;
+                for (std::size_t s = index; s < problem.candidateRoads.size(); ++s)
+                {
+                    for (int road : problem.candidateRoads[s])
+                    {
+                        unite(relaxed, problem.roadEndpointsA[static_cast<std::size_t>(road)], problem.roadEndpointsB[static_cast<std::size_t>(road)]);
+                    }
+                }
+                if (points(relaxed) <= best)
+                {
+                    return;
+                }
+
+                // leaving the station unused is tried first, so a borrow only makes it into the best
+                // choice when it strictly adds points
+                explore(index + 1, parents, borrowsLeft);
+                for (int road : problem.candidateRoads[index])
+                {
+                    int a = problem.roadEndpointsA[static_cast<std::size_t>(road)];
+                    int b = problem.roadEndpointsB[static_cast<std::size_t>(road)];
+                    std::vector<int> next = parents;
+                    // a road inside the network joins nothing, the branch above already covers it
+                    if (a < 0 || b < 0 || findRoot(next, a) == findRoot(next, b))
+                    {
+                        continue;
+                    }
+                    unite(next, a, b);
+                    choice[index] = road;
+                    explore(index + 1, next, borrowsLeft - 1);
+                    choice[index] = -1;
+                }
+            }
+        };
+
+    }
+
+    // road picked for each placed station (-1 when the station is better left unused); every pick adds points
+    std::vector<int> StationBorrowing::solve() const
+    {
+        Search search(*this);
+        search.choice.assign(this->candidateRoads.size(), -1);
+        search.bestChoice = search.choice;
+        search.explore(0, this->baseParents, this->maxBorrows);
+        DEBUG_PRINT("StationBorrowing best: " << search.best << " points");
+        return search.bestChoice;
+    }
+
+    // completed ticket points once the chosen roads are borrowed
+    int StationBorrowing::evaluate(const std::vector<int> &choice) const
+    {
+        Search search(*this);
+        std::vector<int> parents = this->baseParents;
+        for (int road : choice)
+        {
+            if (road >= 0)
+            {
+                unite(parents, this->roadEndpointsA[static_cast<std::size_t>(road)], this->roadEndpointsB[static_cast<std::size_t>(road)]);
+            }
+        }
+        return search.points(parents);
+    }
+}
@@ -0,0 +1,35 @@
+// Generated by dia2code
+#ifndef MAPSTATE__STATIONBORROWING__H
+#define MAPSTATE__STATIONBORROWING__H
+
+#include <vector>
+
+namespace mapState {
+
+  /** StationBorrowing
+   * Class - 
+   * end-game choice of one opponent road per placed station, maximizing completed ticket points
+   */
+  class StationBorrowing {
+    // Attributes
+  public:
+    /// disjoint sets of the player network, roots hold their negated size
+    std::vector<int> baseParents;
+    /// opponent roads (map slots) reachable from each placed station
+    std::vector<std::vector<int>> candidateRoads;
+    std::vector<int> roadEndpointsA;
+    std::vector<int> roadEndpointsB;
+    std::vector<int> ticketA;
+    std::vector<int> ticketB;
+    std::vector<int> ticketPoints;
+    int maxBorrows;
+    // Operations
+  public:
+    std::vector<int> solve () const;
+    int evaluate (const std::vector<int>& choice) const;
+    // Setters and Getters
+  };
+
+};
+
+#endif
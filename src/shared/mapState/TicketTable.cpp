@@ -0,0 +1,213 @@
+#include "TicketTable.h"
+#include "MapImage.h"
+#include "MapTopology.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+#include <unistd.h>
+
+#define DEBUG_MODE false
+#if DEBUG_MODE == true
+#define DEBUG
+#define DEBUG_PRINT(x) std::cout << x << std::endl
+#else
+#define DEBUG_PRINT(x)
+#endif
+
+namespace mapState
+{
+    int TicketTable::formatVersion = 1;
+
+    namespace {
+
+        const char kMagic[8] = {'T', 'T', 'R', 'T', 'I', 'C', 'K', '\0'};
+        const std::uint32_t kByteOrderMark = 0x01020304u;
+
+        struct TableHeader
+        {
+            char magic[8];
+            std::uint32_t byteOrder;
+            std::uint32_t version;
+            std::uint64_t key;
+            std::uint32_t ticketCount;
+            std::uint32_t roadCount;
+            std::uint32_t shortestRoadCount;
+            std::uint32_t reserved;
+            std::uint64_t checksum;
+        };
+
+        static_assert(sizeof(TableHeader) == 48, "ticket table header layout changed");
+
+        void appendInt(std::string &buffer, std::int32_t value)
+        {
+            buffer.append(reinterpret_cast<const char *>(&value), sizeof(value));
+        }
+
+        void appendInts(std::string &buffer, const std::vector<int> &values)
+        {
+            for (int value : values)
+            {
+                appendInt(buffer, static_cast<std::int32_t>(value));
+            }
+        }
+
+        // reads count ints at offset, false when the body is too short
+        bool readInts(const std::string &body, std::size_t &offset, std::size_t count, std::vector<int> &values)
+        {
+            if (body.size() < offset + count * sizeof(std::int32_t))
+            {
+                return false;
+            }
+            values.resize(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                std::int32_t value;
+                std::memcpy(&value, body.data() + offset, sizeof(value));
+                values[i] = value;
+                offset += sizeof(value);
+            }
+            return true;
+        }
+
+    }
+
+    // checksum over what the table depends on: station names, road ends and lengths, and the tickets
+    std::uint64_t TicketTable::keyOf(const MapTopology &topology, const std::vector<std::pair<int, int>> &tickets)
+    {
+        std::string buffer;
+        appendInt(buffer, static_cast<std::int32_t>(topology.stationNames.size()));
+        for (const std::string &name : topology.stationNames)
+        {
+            appendInt(buffer, static_cast<std::int32_t>(name.size()));
+            buffer += name;
+        }
+        appendInt(buffer, static_cast<std::int32_t>(topology.roadLengths.size()));
+        appendInts(buffer, topology.roadEndpointsA);
+        appendInts(buffer, topology.roadEndpointsB);
+        appendInts(buffer, topology.roadLengths);
+        appendInt(buffer, static_cast<std::int32_t>(tickets.size()));
+        for (const std::pair<int, int> &ticket : tickets)
+        {
+            appendInt(buffer, ticket.first);
+            appendInt(buffer, ticket.second);
+        }
+        return MapImage::checksum(buffer.data(), buffer.size());
+    }
+
+    // row of the ticket between the two stations, in either order; -1 when the catalog has no such ticket
+    int TicketTable::findTicket(int stationA, int stationB) const
+    {
+        std::pair<int, int> wanted(std::min(stationA, stationB), std::max(stationA, stationB));
+        std::size_t low = 0;
+        std::size_t high = this->ticketA.size();
+        while (low < high)
+        {
+            std::size_t middle = (low + high) / 2;
+            if (std::make_pair(this->ticketA[middle], this->ticketB[middle]) < wanted)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        if (low < this->ticketA.size() && this->ticketA[low] == wanted.first && this->ticketB[low] == wanted.second)
+        {
+            return static_cast<int>(low);
+        }
+        return -1;
+    }
+
+    // written next to the final name then renamed, so a reader never sees half a file
+    bool TicketTable::save(const std::string &path) const
+    {
+        std::string body;
+        appendInts(body, this->ticketA);
+        appendInts(body, this->ticketB);
+        appendInts(body, this->minLengths);
+        appendInts(body, this->minHops);
+        appendInts(body, this->disjointRoutes);
+        appendInts(body, this->shortestRoadOffsets);
+        appendInts(body, this->shortestRoads);
+        appendInts(body, this->roadContention);
+
+        TableHeader header;
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.byteOrder = kByteOrderMark;
+        header.version = static_cast<std::uint32_t>(TicketTable::formatVersion);
+        header.key = this->key;
+        header.ticketCount = static_cast<std::uint32_t>(this->ticketA.size());
+        header.roadCount = static_cast<std::uint32_t>(this->roadContention.size());
+        header.shortestRoadCount = static_cast<std::uint32_t>(this->shortestRoads.size());
+        header.reserved = 0;
+        header.checksum = MapImage::checksum(body.data(), body.size());
+
+        std::ostringstream temporary;
+        temporary << path << ".tmp" << ::getpid() << "." << std::hash<std::thread::id>()(std::this_thread::get_id());
+        {
+            std::ofstream output(temporary.str().c_str(), std::ios::binary | std::ios::trunc);
+            output.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            output.write(body.data(), static_cast<std::streamsize>(body.size()));
+            if (!output)
+            {
+                std::remove(temporary.str().c_str());
+                return false;
+            }
+        }
+        if (std::rename(temporary.str().c_str(), path.c_str()) != 0)
+        {
+            std::remove(temporary.str().c_str());
+            return false;
+        }
+        DEBUG_PRINT("Ticket table saved to " << path);
+        return true;
+    }
+
+    // fills the table from a cache file; false, leaving the table as it was, unless the file is intact and
+    // was computed for expectedKey with the current layout
+    bool TicketTable::load(const std::string &path, std::uint64_t expectedKey)
+    {
+        std::ifstream input(path.c_str(), std::ios::binary);
+        if (!input)
+        {
+            return false;
+        }
+        TableHeader header;
+        if (!input.read(reinterpret_cast<char *>(&header), sizeof(header)) || std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0
+            || header.byteOrder != kByteOrderMark || header.version != static_cast<std::uint32_t>(TicketTable::formatVersion) || header.key != expectedKey)
+        {
+            return false;
+        }
+        std::ostringstream rest;
+        rest << input.rdbuf();
+        const std::string body = rest.str();
+        if (MapImage::checksum(body.data(), body.size()) != header.checksum)
+        {
+            std::cerr << "Error: ticket table " << path << " is corrupted" << std::endl;
+            return false;
+        }
+
+        TicketTable loaded;
+        std::size_t offset = 0;
+        const std::size_t tickets = header.ticketCount;
+        if (!readInts(body, offset, tickets, loaded.ticketA) || !readInts(body, offset, tickets, loaded.ticketB)
+            || !readInts(body, offset, tickets, loaded.minLengths) || !readInts(body, offset, tickets, loaded.minHops)
+            || !readInts(body, offset, tickets, loaded.disjointRoutes) || !readInts(body, offset, tickets + 1, loaded.shortestRoadOffsets)
+            || !readInts(body, offset, header.shortestRoadCount, loaded.shortestRoads) || !readInts(body, offset, header.roadCount, loaded.roadContention)
+            || offset != body.size())
+        {
+            return false;
+        }
+        loaded.key = header.key;
+        *this = loaded;
+        DEBUG_PRINT("Ticket table loaded from " << path << ": " << tickets << " tickets");
+        return true;
+    }
+}
@@ -0,0 +1,54 @@
+// Generated by dia2code
+#ifndef MAPSTATE__TICKETTABLE__H
+#define MAPSTATE__TICKETTABLE__H
+
+#include <cstdint>
+#include <vector>
+#include <utility>
+#include <string>
+
+namespace mapState {
+  // Forward declaration
+  class MapTopology;
+}
+
+namespace mapState {
+
+  /** TicketTable
+   * Class - 
+   * per-ticket difficulty of a destination catalog on one map, and how many tickets lean on each road; fixed for a whole game, so it is cached on disk by map and catalog
+   */
+  class TicketTable {
+    // Attributes
+  public:
+    /// bumped whenever the file layout changes, older cache files are recomputed
+    static int formatVersion;
+    /// checksum of the map tables and the catalog the table was computed for
+    std::uint64_t key;
+    /// ticket endpoints as station slots, smaller slot first, sorted and without duplicates
+    std::vector<int> ticketA;
+    std::vector<int> ticketB;
+    /// fewest wagons over the empty map, -1 when the stations are not connected
+    std::vector<int> minLengths;
+    /// fewest roads over the empty map, -1 when the stations are not connected
+    std::vector<int> minHops;
+    /// routes sharing no road, so how many claims it takes to cut the ticket
+    std::vector<int> disjointRoutes;
+    /// offsets of each ticket in shortestRoads
+    std::vector<int> shortestRoadOffsets;
+    /// road slots lying on at least one shortest route (by length) of each ticket
+    std::vector<int> shortestRoads;
+    /// tickets with the road on one of their shortest routes
+    std::vector<int> roadContention;
+    // Operations
+  public:
+    static std::uint64_t keyOf (const MapTopology& topology, const std::vector<std::pair<int, int>>& tickets);
+    int findTicket (int stationA, int stationB) const;
+    bool save (const std::string& path) const;
+    bool load (const std::string& path, std::uint64_t expectedKey);
+    // Setters and Getters
+  };
+
+};
+
+#endif
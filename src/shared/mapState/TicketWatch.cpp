@@ -0,0 +1,55 @@
+#include "TicketWatch.h"
+#include <algorithm>
+
+namespace mapState
+{
+    // replaces the witness route of a ticket and keeps the road -> tickets index in step
+    void TicketWatch::setWitness(int ticket, const std::vector<int> &roads)
+    {
+        std::vector<int> &previous = this->witnesses[static_cast<std::size_t>(ticket)];
+        for (int road : previous)
+        {
+            std::unordered_map<int, std::vector<int>>::iterator users = this->roadTickets.find(road);
+            if (users == this->roadTickets.end())
+            {
+                continue;
+            }
+            users->second.erase(std::remove(users->second.begin(), users->second.end(), ticket), users->second.end());
+            if (users->second.empty())
+            {
+                this->roadTickets.erase(users);
+            }
+        }
+        previous = roads;
+        for (int road : roads)
+        {
+            std::vector<int> &users = this->roadTickets[road];
+            if (std::find(users.begin(), users.end(), ticket) == users.end())
+            {
+                users.push_back(ticket);
+            }
+        }
+    }
+
+    // tickets whose witness goes through any of the roads, each listed once
+    std::vector<int> TicketWatch::ticketsUsing(const std::vector<int> &roads) const
+    {
+        std::vector<int> tickets;
+        for (int road : roads)
+        {
+            std::unordered_map<int, std::vector<int>>::const_iterator users = this->roadTickets.find(road);
+            if (users == this->roadTickets.end())
+            {
+                continue;
+            }
+            for (int ticket : users->second)
+            {
+                if (std::find(tickets.begin(), tickets.end(), ticket) == tickets.end())
+                {
+                    tickets.push_back(ticket);
+                }
+            }
+        }
+        return tickets;
+    }
+}
@@ -0,0 +1,39 @@
+// Generated by dia2code
+#ifndef MAPSTATE__TICKETWATCH__H
+#define MAPSTATE__TICKETWATCH__H
+
+#include <vector>
+#include <unordered_map>
+#include <cstdlib>
+
+namespace mapState {
+
+  /** TicketWatch
+   * Class - 
+   * feasibility of one player's tickets, kept with a witness route per ticket so a claim only rechecks the tickets whose route it cuts
+   */
+  class TicketWatch {
+    // Attributes
+  public:
+    std::vector<int> ticketA;
+    std::vector<int> ticketB;
+    std::vector<bool> feasible;
+    /// road slots of a route that still completes each ticket, empty when it cannot be completed
+    std::vector<std::vector<int>> witnesses;
+    /// tickets whose witness route uses each road slot
+    std::unordered_map<int, std::vector<int>> roadTickets;
+    /// opponent roads the player can still borrow with stations
+    int borrowBudget;
+    std::size_t borrowedCount;
+    /// tickets whose witness route lost a road since the last query
+    std::vector<int> staleTickets;
+    // Operations
+  public:
+    void setWitness (int ticket, const std::vector<int>& roads);
+    std::vector<int> ticketsUsing (const std::vector<int>& roads) const;
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -22,7 +22,7 @@ namespace mapState
     {
     }
 
-    Tunnel::Tunnel(int id, std::shared_ptr<playersState::Player> owner, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, RoadColor color, int lenght, std::shared_ptr<boost::adjacency_list<>::edge_descriptor> edge)
+    Tunnel::Tunnel(int id, std::shared_ptr<playersState::Player> owner, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, RoadColor color, int lenght, boost::adjacency_list<>::edge_descriptor edge)
         : Road(id, owner, stationA, stationB, color, lenght, edge)
     {
         DEBUG_PRINT("Parent constructor finished : Tunnel " << this->id << " created !");
@@ -32,8 +32,7 @@ namespace mapState
     {
         DEBUG_PRINT("Tunnel creation started ...");
         std::shared_ptr<playersState::Player> owner = nullptr;
-        std::shared_ptr<boost::adjacency_list<>::edge_descriptor> edge = std::make_shared<boost::adjacency_list<>::edge_descriptor>(
-            boost::add_edge(*(stationA->getVertex().get()), *(stationB->getVertex().get()), *gameGraph).first);
+        boost::adjacency_list<>::edge_descriptor edge = boost::add_edge(stationA->getVertex(), stationB->getVertex(), *gameGraph).first;
         return Tunnel(id, owner, stationA, stationB, color, length, edge);
         DEBUG_PRINT("Tunnel " << this->id << " created !");
     }
@@ -55,6 +54,10 @@ namespace mapState
     {
         Road::_display(indent);
     }
+    RoadKind Tunnel::getKind()
+    {
+        return RoadKind::TUNNEL;
+    }
     std::vector<std::shared_ptr<Tunnel>> Tunnel::BatchConstructor(std::vector<TunnelInfo> tunnelsInfos, std::shared_ptr<boost::adjacency_list<>> gameGraph)
     {
         DEBUG_PRINT("Tunnel BatchConstructor started ...");
@@ -73,9 +76,7 @@ namespace mapState
             std::shared_ptr<playersState::Player> owner = std::get<1>(detail);
             RoadColor color = std::get<2>(detail);
             int length = std::get<3>(detail);
-            std::shared_ptr<boost::adjacency_list<>::edge_descriptor> edgeDescriptor =
-                std::make_shared<boost::adjacency_list<>::edge_descriptor>(
-                    boost::add_edge(*(stationA->getVertex().get()), *(stationB->getVertex().get()), *gameGraph).first);
+            boost::adjacency_list<>::edge_descriptor edgeDescriptor = boost::add_edge(stationA->getVertex(), stationB->getVertex(), *gameGraph).first;
             tunnels.push_back(std::make_shared<Tunnel>(id, owner, stationA, stationB, color, length, edgeDescriptor));
         }
         DEBUG_PRINT("Tunnel BatchConstructor finished !");
@@ -0,0 +1,55 @@
+// Generated by dia2code
+#ifndef MAPSTATE__TUNNEL__H
+#define MAPSTATE__TUNNEL__H
+
+#include <memory>
+#include <vector>
+#include <utility>
+#include <tuple>
+#include <string>
+
+namespace playersState {
+  // Forward declaration
+  class Player;
+};
+namespace mapState {
+  // Forward declaration
+  class Station;
+  // Forward declaration
+  class Tunnel;
+  // Forward declaration
+  class Road;
+}
+
+#include "playersState/Player.h"
+#include "Station.h"
+#include "RoadColor.h"
+#include "RoadKind.h"
+#include "Road.h"
+
+namespace mapState {
+
+  /** Tunnel
+   * Class - 
+   */
+  class Tunnel : public mapState::Road {
+    // Operations
+  public:
+    Tunnel ();
+    Tunnel (int id, std::shared_ptr<playersState::Player> owner, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, RoadColor color, int length, boost::adjacency_list<>::edge_descriptor edge);
+    static Tunnel Init (int id, std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, RoadColor color, int length, std::shared_ptr<boost::adjacency_list<>> gameGraph);
+    ~Tunnel ();
+    void display (int indent = 0);
+    void _display (int indent = 0);
+    RoadKind getKind ();
+    static std::vector<std::shared_ptr<Tunnel>> BatchConstructor (std::vector<std::pair<std::pair<std::shared_ptr<Station>,std::shared_ptr<Station>>,std::tuple<int, std::shared_ptr<playersState::Player>, RoadColor, int>>> tunnelsInfos, std::shared_ptr<boost::adjacency_list<>> gameGraph);
+    static std::pair<std::pair<std::shared_ptr<Station>,std::shared_ptr<Station>>,std::tuple<int, std::shared_ptr<playersState::Player>, RoadColor, int>> genData (std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, int id, std::shared_ptr<playersState::Player> owner, RoadColor color, int length);
+    static std::pair<std::pair<std::shared_ptr<Station>,std::shared_ptr<Station>>,std::tuple<int, std::shared_ptr<playersState::Player>, RoadColor, int>> initData (std::shared_ptr<Station> stationA, std::shared_ptr<Station> stationB, int id, RoadColor color, int length);
+    static std::pair<std::pair<std::shared_ptr<Station>,std::shared_ptr<Station>>,std::tuple<int, std::shared_ptr<playersState::Player>, RoadColor, int>> genDataByName (std::vector<std::shared_ptr<Station>> stations, const std::string& stationAName, const std::string& stationBName, int id, std::shared_ptr<playersState::Player> owner, RoadColor color, int length);
+    static std::pair<std::pair<std::shared_ptr<Station>,std::shared_ptr<Station>>,std::tuple<int, std::shared_ptr<playersState::Player>, RoadColor, int>> initDataByName (std::vector<std::shared_ptr<Station>> stations, const std::string& stationAName, const std::string& stationBName, int id, RoadColor color, int length);
+    // Setters and Getters
+  };
+
+};
+
+#endif
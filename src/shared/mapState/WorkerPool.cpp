@@ -0,0 +1,183 @@
+#include "WorkerPool.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#define DEBUG_MODE false
+#if DEBUG_MODE == true
+#define DEBUG
+#define DEBUG_PRINT(x) std::cout << x << std::endl
+#else
+#define DEBUG_PRINT(x)
+#endif
+
+namespace mapState
+{
+    namespace {
+
+        // process-wide workers for the map queries that split their work (path batches, ticket tables,
+        // longest routes, station borrows). They are started once, so a query only pays for waking them
+        class Workers
+        {
+        public:
+            static Workers &instance()
+            {
+                static Workers pool;
+                return pool;
+            }
+
+            // several games can run batches at once, and a task may start a batch of its own
+            void run(std::size_t count, const std::function<void(std::size_t)> &task)
+            {
+                if (count <= 1 || this->workers.empty())
+                {
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        task(i);
+                    }
+                    return;
+                }
+                std::shared_ptr<Batch> batch = std::make_shared<Batch>(task, count);
+                {
+                    std::lock_guard<std::mutex> lock(this->mutex);
+                    this->batches.push_back(batch);
+                }
+                if (count - 1 >= this->workers.size())
+                {
+                    this->wake.notify_all();
+                }
+                else
+                {
+                    for (std::size_t i = 1; i < count; ++i)
+                    {
+                        this->wake.notify_one();
+                    }
+                }
+                batch->work();
+                {
+                    std::unique_lock<std::mutex> lock(this->mutex);
+                    std::deque<std::shared_ptr<Batch>>::iterator queued = std::find(this->batches.begin(), this->batches.end(), batch);
+                    if (queued != this->batches.end())
+                    {
+                        this->batches.erase(queued);
+                    }
+                }
+                std::unique_lock<std::mutex> lock(batch->mutex);
+                batch->finished.wait(lock, [&]() { return batch->done == batch->count; });
+            }
+
+        private:
+            struct Batch
+            {
+                const std::function<void(std::size_t)> &task;
+                const std::size_t count;
+                std::atomic<std::size_t> next;
+                std::size_t done;
+                std::mutex mutex;
+                std::condition_variable finished;
+
+                Batch(const std::function<void(std::size_t)> &task, std::size_t count) : task(task), count(count), next(0), done(0) {}
+
+                bool exhausted() const
+                {
+                    return this->next.load() >= this->count;
+                }
+
+                void work()
+                {
+                    std::size_t ran = 0;
+                    for (std::size_t i = this->next++; i < this->count; i = this->next++)
+                    {
+                        this->task(i);
+                        ++ran;
+                    }
+                    if (ran == 0)
+                    {
+                        return;
+                    }
+                    std::lock_guard<std::mutex> lock(this->mutex);
+                    this->done += ran;
+                    if (this->done == this->count)
+                    {
+                        this->finished.notify_all();
+                    }
+                }
+            };
+
+            std::mutex mutex;
+            std::condition_variable wake;
+            std::deque<std::shared_ptr<Batch>> batches;
+            std::vector<std::thread> workers;
+            bool stopping;
+
+            // one worker per core besides the calling thread
+            Workers() : stopping(false)
+            {
+                const unsigned int cores = std::max(1u, std::thread::hardware_concurrency());
+                for (unsigned int w = 1; w < cores; ++w)
+                {
+                    this->workers.emplace_back([this]() { this->loop(); });
+                }
+            }
+
+            ~Workers()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(this->mutex);
+                    this->stopping = true;
+                }
+                this->wake.notify_all();
+                for (std::thread &worker : this->workers)
+                {
+                    worker.join();
+                }
+            }
+
+            void loop()
+            {
+                while (true)
+                {
+                    std::shared_ptr<Batch> batch;
+                    {
+                        std::unique_lock<std::mutex> lock(this->mutex);
+                        this->wake.wait(lock, [&]() {
+                            while (!this->batches.empty() && this->batches.front()->exhausted())
+                            {
+                                this->batches.pop_front();
+                            }
+                            return this->stopping || !this->batches.empty();
+                        });
+                        if (this->batches.empty())
+                        {
+                            return;
+                        }
+                        batch = this->batches.front();
+                    }
+                    batch->work();
+                }
+            }
+        };
+
+    } // namespace
+
+    // runs task(0..count-1) on the workers and the calling thread, returns once every index is done;
+    // batches smaller than minimum stay on the calling thread
+    void WorkerPool::run(std::size_t count, const std::function<void(std::size_t)> &task, std::size_t minimum)
+    {
+        if (count < minimum)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                task(i);
+            }
+            return;
+        }
+        Workers::instance().run(count, task);
+    }
+}
@@ -0,0 +1,23 @@
+// Generated by dia2code
+#ifndef MAPSTATE__WORKERPOOL__H
+#define MAPSTATE__WORKERPOOL__H
+
+#include <cstdlib>
+#include <functional>
+
+namespace mapState {
+
+  /** WorkerPool
+   * Class - 
+   * process-wide worker threads shared by the map queries that split their work (path batches, ticket tables, longest routes, station borrows)
+   */
+  class WorkerPool {
+    // Operations
+  public:
+    static void run (std::size_t count, const std::function<void(std::size_t)>& task, std::size_t minimum = 2);
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,10 @@
+// Generated by dia2code
+#ifndef __PARSER__H
+#define __PARSER__H
+
+#include "parser/MessageBase.h"
+#include "parser/CommandMessage.h"
+#include "parser/EventMessage.h"
+#include "parser/ResultMessage.h"
+#include "parser/JSONParser.h"
+#endif
@@ -0,0 +1,30 @@
+// Generated by dia2code
+#ifndef PARSER__COMMANDMESSAGE__H
+#define PARSER__COMMANDMESSAGE__H
+
+#include <string>
+#include <json/json.h>
+
+namespace parser {
+  // Forward declaration
+  class MessageBase;
+}
+
+#include "MessageBase.h"
+
+namespace parser {
+
+  /** CommandMessage
+   * Class - 
+   */
+  class CommandMessage : public parser::MessageBase {
+    // Attributes
+  public:
+    std::string name;
+    Json::Value payload;
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,31 @@
+// Generated by dia2code
+#ifndef PARSER__EVENTMESSAGE__H
+#define PARSER__EVENTMESSAGE__H
+
+#include <string>
+#include <json/json.h>
+
+namespace parser {
+  // Forward declaration
+  class MessageBase;
+}
+
+#include "MessageBase.h"
+
+namespace parser {
+
+  /** EventMessage
+   * Class - 
+   */
+  class EventMessage : public parser::MessageBase {
+    // Attributes
+  public:
+    std::string type;
+    std::string message;
+    Json::Value payload;
+    // Setters and Getters
+  };
+
+};
+
+#endif
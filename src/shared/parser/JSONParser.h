@@ -0,0 +1,38 @@
+// Generated by dia2code
+#ifndef PARSER__JSONPARSER__H
+#define PARSER__JSONPARSER__H
+
+#include <string>
+
+namespace parser {
+  // Forward declaration
+  class CommandMessage;
+  // Forward declaration
+  class ResultMessage;
+  // Forward declaration
+  class EventMessage;
+}
+
+#include "ResultMessage.h"
+#include "EventMessage.h"
+#include "CommandMessage.h"
+
+namespace parser {
+
+  /** JSONParser
+   * Class - 
+   */
+  class JSONParser {
+    // Operations
+  public:
+    bool parseCommand (const std::string& json, CommandMessage& out, std::string& error);
+    bool parseResult (const std::string& json, ResultMessage& out, std::string& error);
+    std::string serializeCommand (const CommandMessage& in);
+    std::string serializeResult (const ResultMessage& in);
+    std::string serializeEvent (const EventMessage& in);
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,26 @@
+// Generated by dia2code
+#ifndef PARSER__MESSAGEBASE__H
+#define PARSER__MESSAGEBASE__H
+
+#include <string>
+
+namespace parser {
+
+  /** MessageBase
+   * Class - 
+   */
+  class MessageBase {
+    // Attributes
+  public:
+    std::string kind;
+    std::string origin;
+    int version;
+    std::string requestID;
+    int playerID;
+    int turn;
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,36 @@
+// Generated by dia2code
+#ifndef PARSER__RESULTMESSAGE__H
+#define PARSER__RESULTMESSAGE__H
+
+#include <string>
+#include <json/json.h>
+#include <vector>
+
+namespace parser {
+  // Forward declaration
+  class EventMessage;
+  // Forward declaration
+  class MessageBase;
+}
+
+#include "EventMessage.h"
+#include "MessageBase.h"
+
+namespace parser {
+
+  /** ResultMessage
+   * Class - 
+   */
+  class ResultMessage : public parser::MessageBase {
+    // Attributes
+  public:
+    bool ok;
+    std::string error;
+    Json::Value payload;
+    std::vector<EventMessage> events;
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,8 @@
+// Generated by dia2code
+#ifndef __PLAYERSSTATE__H
+#define __PLAYERSSTATE__H
+
+#include "playersState/PlayerColor.h"
+#include "playersState/Player.h"
+#include "playersState/PlayersState.h"
+#endif
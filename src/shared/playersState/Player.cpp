@@ -243,11 +243,9 @@ namespace playersState
 
       if (!stationA || !stationB) return false;
 
-      return map->isDestinationReached(
-          std::make_shared<Player>(*this),
-          stationA,
-          stationB
-      );
+      // non-owning handle on this player, the map only reads it during the call
+      std::shared_ptr<Player> self(std::shared_ptr<Player>(), this);
+      return map->isDestinationReached(self, stationA, stationB);
    }
 
    bool Player::isRoadBuildable(std::shared_ptr<mapState::MapState> map, std::shared_ptr<mapState::Road> road)
@@ -257,9 +255,8 @@ namespace playersState
          DEBUG_PRINT("Road is not claimable.\n");
          return false;
       }
-      if (typeid(*road) == typeid(mapState::Tunnel))
+      if (road->getKind() == mapState::RoadKind::TUNNEL)
       {
-         std::shared_ptr<mapState::Tunnel> tunnel = std::dynamic_pointer_cast<mapState::Tunnel>(road);
          // FIXME : implement Tunnel specific logic here BUT first implement the cards functions to make it possible
          return true;
       }
@@ -342,10 +339,9 @@ namespace playersState
                                                       << ". Needed: " << length << ", you have: " << cardsCorrectColor.size() << "\n");
             return false;
          }
-         if (typeid(*road) == typeid(mapState::Ferry))
+         if (road->getKind() == mapState::RoadKind::FERRY)
          {
-            std::shared_ptr<mapState::Ferry> ferry = std::dynamic_pointer_cast<mapState::Ferry>(road);
-            int requiredLocomotives = ferry->getLocomotives();
+            int requiredLocomotives = road->getLocomotives();
             std::vector<std::shared_ptr<cardsState::WagonCard>> remainingLocomotiveCards;
             for (std::shared_ptr<cardsState::WagonCard> card : handCardsCopy)
             {
@@ -0,0 +1,198 @@
+// Generated by dia2code
+#ifndef PLAYERSSTATE__PLAYER__H
+#define PLAYERSSTATE__PLAYER__H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <tuple>
+
+namespace cardsState {
+  // Forward declaration
+  class PlayerCards;
+};
+namespace playersState {
+  // Forward declaration
+  class Player;
+};
+namespace mapState {
+  // Forward declaration
+  class MapState;
+};
+namespace cardsState {
+  // Forward declaration
+  class CardsState;
+  // Forward declaration
+  class DestinationCard;
+  // Forward declaration
+  template <  class CardType>
+  class Deck;
+  // Forward declaration
+  template <  class CardType>
+  class SharedDeck;
+  // Forward declaration
+  class WagonCard;
+}
+
+#include "PlayerColor.h"
+#include "cardsState/PlayerCards.h"
+#include "mapState/MapState.h"
+#include "cardsState/CardsState.h"
+#include "cardsState/DestinationCard.h"
+#include "cardsState/Deck.h"
+#include "cardsState/SharedDeck.h"
+#include "cardsState/WagonCard.h"
+
+namespace playersState {
+
+  /** Player
+   * Class - 
+   * class Player
+   * @property id [private] int Player identifier
+   * @property name [private]  std::string Player name
+   * @property color  [private] cardsState::ColorCard  Player  color card
+   * @property score [private] int  Player score
+   * @property numTrains [private] int Player  number of trains 
+   * @property nbStations [private] int Player number of stations
+   * @property nbRoads [private] int Player number of roads 
+   * @property hand [private] cardsState::PlayerCards* Player hand of cards 
+   */
+  class Player {
+    // Associations
+    // Attributes
+  public:
+    static int startNbWagons;
+    static int startNbStations;
+    static int startScore;
+    static PlayerColor possibleColors[6];
+    static std::unordered_map<playersState::PlayerColor, std::string> ColorsNames;
+    std::string name;
+    PlayerColor color;
+    int score;
+    int nbWagons;
+    int nbStations;
+    std::vector<std::shared_ptr<mapState::Road>> borrowedRoads;
+    std::shared_ptr<cardsState::PlayerCards> hand;
+    std::vector<std::shared_ptr<cardsState::DestinationCard>>  completedDestinations;
+    static std::unordered_map<int,int> PointsByRoadLength;
+    // Operations
+  public:
+    Player ();
+    /// Player
+    /** Public Method - 
+     * Player
+     * constructor
+     * @param id int  
+     * @param name std::string 
+     * @param clor cardsState::ColorCard
+     * @param score int 
+     * @param numTrains int
+     * @param nbStations int 
+     * @param nbRoads int
+     * @param hand cardsState::PlayerCards*   
+     */
+    Player (std::string name, PlayerColor color, int score, int nbWagons, int nbStations, std::vector<std::shared_ptr<mapState::Road>> BorrowedRoads, std::shared_ptr<cardsState::PlayerCards> hand);
+    static Player Init (std::string name, PlayerColor color, std::shared_ptr<cardsState::PlayerCards> hand);
+    /// display
+    /** Public Method - 
+     *  display
+     * Method - display  the informations of  a  player 
+     */
+    void display (int indent = 0);
+    /// getName
+    /** Public Method - 
+     * getName
+     * Method - getter name
+     * @return std::string return the  name  of a player 
+     */
+    std::string getName ();
+    int getScore ();
+    /// getNbWagons
+    /** Public Method - 
+     * getNumTrains
+     * Method - getter numTrains
+     * @return int return the number of trains of a  player
+     */
+    int getNbWagons ();
+    /// getNbStations
+    /** Public Method - 
+     * getNbStations
+     * Method - getter nbStations 
+     * @return int return number of stations  of  a player 
+     */
+    int getNbStations ();
+    /// getBorrowedRoads
+    /** Public Method - 
+     * getNbRoads
+     * Method - getter nbRoads 
+     * @return int return number of  roads  of a player 
+     */
+    std::vector<std::shared_ptr<mapState::Road>> getBorrowedRoads ();
+    PlayerColor getColor ();
+    std::shared_ptr<cardsState::PlayerCards> getHand ();
+    void setScore (int score);
+    /// setNbWagons
+    /** Public Method - 
+     * setNumTrains
+     * Method - setter numTrains
+     * @param numTrains int 
+     */
+    void setNbWagons (int nbWagons);
+    /// setNbStations
+    /** Public Method - 
+     * setNbStations
+     * Method - setter nbStations 
+     * @param nbStations int 
+     */
+    void setNbStations (int nbStations);
+    void setHand (std::shared_ptr<cardsState::PlayerCards> hand );
+    /// addScore
+    /** Public Method - 
+     * addToScore
+     * Method - calculate the  score  of a player
+     * @param points int 
+     */
+    void addScore (int points);
+    /// removeTrain
+    /** Public Method - 
+     * placeTrains
+     * Method - mark the trains 
+     * @param num int 
+     * @return bool 
+     */
+    void removeTrain (int num);
+    void removeStation (int num);
+    /// calculateDestinationPoints
+    /** Public Method - 
+     * calculateDestinationPoints
+     * Method - calculate player destinations points 
+     * @return int destinations points  
+     */
+    int calculateDestinationPoints ();
+    bool isRoadBuildable (std::shared_ptr<mapState::MapState> map, std::shared_ptr<mapState::Road> road);
+    void getCompletedDestinations (std::shared_ptr<mapState::MapState> map);
+    std::vector<std::shared_ptr<mapState::Road>> getClaimableRoads (std::shared_ptr<mapState::MapState> map);
+    /// displayHand
+    /** Public Method - 
+     * displayHand
+     * Method - display the cards in of  a player
+     */
+    void displayHand ();
+    template<class CardType> void drawCard (std::shared_ptr<cardsState::CardsState> cardsState, std::shared_ptr<CardType> card = nullptr, int number = 0);
+    void fillFromInfos (std::tuple<std::string, PlayerColor, int, int,int,std::vector<std::shared_ptr<mapState::Road>>, std::shared_ptr<cardsState::PlayerCards>> info);
+    void fillFromInitInfos (std::tuple<std::string, PlayerColor, std::shared_ptr<cardsState::PlayerCards>> info);
+    static Player PlayerFromInfos (std::tuple<std::string, PlayerColor, int, int, int, std::vector<std::shared_ptr<mapState::Road>>, std::shared_ptr<cardsState::PlayerCards>> info);
+    static Player PlayerFromInitInfos (std::tuple<std::string, PlayerColor, std::shared_ptr<cardsState::PlayerCards>> info);
+    static std::vector<std::shared_ptr<Player>> BatchFromInfos (std::vector<std::tuple<std::string, PlayerColor, int, int, int, std::vector<std::shared_ptr<mapState::Road>>, std::shared_ptr<cardsState::PlayerCards>>> infos);
+    static std::vector<std::shared_ptr<Player>> BatchFromInitInfos (std::vector<std::tuple<std::string, PlayerColor, std::shared_ptr<cardsState::PlayerCards>>> infos);
+    int calculateWagonPoints ();
+    int calculatePoints ();
+    bool isDestinationReached (std::shared_ptr<mapState::MapState> map, std::shared_ptr<cardsState::DestinationCard> destinationCard);
+    std::shared_ptr<Player> getPlayerByName (std::string name);
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,22 @@
+// Generated by dia2code
+#ifndef PLAYERSSTATE__PLAYERCOLOR__H
+#define PLAYERSSTATE__PLAYERCOLOR__H
+
+
+namespace playersState {
+
+  /** PlayerColor
+   * Enum - 
+   */
+  enum PlayerColor {
+    UNKNOWN     = 404,
+    RED     = 1,
+    BLUE     = 2,
+    GREEN     = 3,
+    BLACK     = 4,
+    YELLOW     = 5
+  };
+
+};
+
+#endif
@@ -331,8 +331,8 @@ std::shared_ptr<mapState::Road> resolveRoadSpec(
     for (std::size_t i = 0; i < candidates.size(); ++i)
     {
         std::shared_ptr<mapState::Road> road = candidates[i];
-        bool isTunnel = (std::dynamic_pointer_cast<mapState::Tunnel>(road) != nullptr);
-        bool isFerry = (std::dynamic_pointer_cast<mapState::Ferry>(road) != nullptr);
+        bool isTunnel = road->getKind() == mapState::RoadKind::TUNNEL;
+        bool isFerry = road->getKind() == mapState::RoadKind::FERRY;
 
         if (type == "TUNNEL" && !isTunnel)
         {
@@ -354,8 +354,7 @@ std::shared_ptr<mapState::Road> resolveRoadSpec(
 
         if (type == "FERRY")
         {
-            std::shared_ptr<mapState::Ferry> ferry = std::dynamic_pointer_cast<mapState::Ferry>(road);
-            if (ferry && locomotives >= 0 && ferry->getLocomotives() != locomotives)
+            if (locomotives >= 0 && road->getLocomotives() != locomotives)
             {
                 continue;
             }
@@ -0,0 +1,78 @@
+// Generated by dia2code
+#ifndef PLAYERSSTATE__PLAYERSSTATE__H
+#define PLAYERSSTATE__PLAYERSSTATE__H
+
+#include <vector>
+#include <memory>
+#include <string>
+#include <tuple>
+
+namespace playersState {
+  // Forward declaration
+  class Player;
+};
+namespace mapState {
+  // Forward declaration
+  class MapState;
+};
+namespace playersState {
+  // Forward declaration
+  class PlayersState;
+};
+namespace cardsState {
+  // Forward declaration
+  class PlayerCards;
+  // Forward declaration
+  class CardsState;
+}
+
+#include "Player.h"
+#include "mapState/MapState.h"
+#include "cardsState/PlayerCards.h"
+#include "cardsState/CardsState.h"
+
+namespace playersState {
+
+  /** PlayersState
+   * Class - 
+   * class PlayersState
+   * @property players [private] std::vector<Player*>  vector  of players 
+   */
+  class PlayersState {
+    // Associations
+    // Attributes
+  public:
+    static int nbPlayers;
+    std::vector<std::shared_ptr<Player>> players;
+    // Operations
+  public:
+    /// PlayersState
+    /** Public Method - 
+     * PlayersState
+     * constructor
+     */
+    PlayersState ();
+    PlayersState (std::vector<std::shared_ptr<Player>> players);
+    PlayersState (std::vector<std::tuple<std::string, PlayerColor, int, int, int,std::vector<std::shared_ptr<mapState::Road>>, std::shared_ptr<cardsState::PlayerCards>>> infos);
+    std::vector<std::shared_ptr<Player>> getPlayers ();
+    void setPlayers (std::vector<std::shared_ptr<Player>> players);
+    /// display
+    /** Public Method - 
+     * printPLayersState 
+     * Method - print the players state 
+     */
+    void display (int indent = 0);
+    static bool isRoadClaimable (std::shared_ptr<mapState::MapState> map, std::shared_ptr<mapState::Road> road, std::shared_ptr<Player> player);
+    static std::vector<std::shared_ptr<mapState::Road>> getClaimableRoads (std::shared_ptr<mapState::MapState> map, std::shared_ptr<Player> player);
+    static PlayersState InitFromInfos (std::vector<std::tuple<std::string, PlayerColor, std::shared_ptr<cardsState::PlayerCards>>> infos);
+    static PlayersState InitFromJSON (std::string json);
+    void setupPlayersHand (std::vector<std::shared_ptr<cardsState::PlayerCards>> hands);
+    PlayersState (std::vector<std::tuple<std::string, playersState::PlayerColor, std::shared_ptr<cardsState::PlayerCards>>> infos, std::vector<std::shared_ptr<cardsState::PlayerCards>> hands);
+    std::shared_ptr<Player> getPlayerByName (std::string name);
+    void setupFromJSON (std::string json, std::shared_ptr<mapState::MapState> mapState, std::shared_ptr<cardsState::CardsState> cardState);
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,6 @@
+// Generated by dia2code
+#ifndef __RENDER__H
+#define __RENDER__H
+
+#include "render/RenderState.h"
+#endif
@@ -0,0 +1,57 @@
+// Generated by dia2code
+#ifndef RENDER__RENDERSTATE__H
+#define RENDER__RENDERSTATE__H
+
+
+namespace cardsState {
+  // Forward declaration
+  class PlayerCards;
+  // Forward declaration
+  class CardsState;
+};
+namespace playersState {
+  // Forward declaration
+  class PlayersState;
+};
+namespace state {
+  // Forward declaration
+  class State;
+};
+namespace mapState {
+  // Forward declaration
+  class MapState;
+};
+namespace tui {
+  // Forward declaration
+  class Terminal;
+  // Forward declaration
+  class TUIManager;
+}
+
+#include "cardsState/PlayerCards.h"
+#include "cardsState/CardsState.h"
+#include "playersState/PlayerColor.h"
+#include "playersState/PlayersState.h"
+#include "state/State.h"
+#include "mapState/MapState.h"
+#include "tui/Terminal.h"
+#include "tui/TUIManager.h"
+
+namespace render {
+
+  /** RenderState
+   * Class - 
+   */
+  class RenderState {
+    // Attributes
+  public:
+    int playerCount;
+    // Operations
+  public:
+    int renderStateLoop (int playerCount);
+    // Setters and Getters
+  };
+
+};
+
+#endif
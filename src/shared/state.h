@@ -0,0 +1,6 @@
+// Generated by dia2code
+#ifndef __STATE__H
+#define __STATE__H
+
+#include "state/State.h"
+#endif
@@ -0,0 +1,55 @@
+// Generated by dia2code
+#ifndef STATE__STATE__H
+#define STATE__STATE__H
+
+#include <string>
+#include <vector>
+#include <tuple>
+#include <memory>
+
+namespace mapState {
+  // Forward declaration
+  class MapState;
+};
+namespace cardsState {
+  // Forward declaration
+  class CardsState;
+};
+namespace playersState {
+  // Forward declaration
+  class PlayersState;
+};
+namespace state {
+  // Forward declaration
+  class State;
+}
+
+#include "mapState/MapState.h"
+#include "cardsState/CardsState.h"
+#include "playersState/PlayersState.h"
+
+namespace state {
+
+  /** State
+   * Class - 
+   */
+  class State {
+    // Associations
+    // Attributes
+  public:
+    mapState::MapState map;
+    cardsState::CardsState cards;
+    playersState::PlayersState players;
+    // Operations
+  public:
+    State ();
+    State (std::string mapName, std::vector<std::tuple<std::string, playersState::PlayerColor, std::shared_ptr<cardsState::PlayerCards>>> playersInfos);
+    State (std::string pathToFile);
+    State Europe ();
+    void display (int indent = 0);
+    // Setters and Getters
+  };
+
+};
+
+#endif
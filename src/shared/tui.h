@@ -0,0 +1,18 @@
+// Generated by dia2code
+#ifndef __TUI__H
+#define __TUI__H
+
+#include "tui/Color.h"
+#include "tui/Terminal.h"
+#include "tui/BaseView.h"
+#include "tui/StatusBar.h"
+#include "tui/ViewMode.h"
+#include "tui/StationLayout.h"
+#include "tui/GameView.h"
+#include "tui/InfoPanel.h"
+#include "tui/CommandInput.h"
+#include "tui/Focus.h"
+#include "tui/TUIManager.h"
+#include "tui/ParseResult.h"
+#include "tui/CommandParser.h"
+#endif
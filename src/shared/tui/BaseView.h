@@ -0,0 +1,80 @@
+// Generated by dia2code
+#ifndef TUI__BASEVIEW__H
+#define TUI__BASEVIEW__H
+
+#include <string>
+
+namespace tui {
+  // Forward declaration
+  class Terminal;
+}
+
+#include "Color.h"
+
+namespace tui {
+
+  /** BaseView
+   * Class - 
+   */
+  class BaseView {
+    // Attributes
+  protected:
+    int x;
+    int y;
+    int width;
+    int height;
+    std::string title;
+    bool needsRedraw;
+    Color bgColor;
+    Color fgColor;
+    bool focused;
+    // Operations
+  public:
+    BaseView (int x, int y, int width, int height, const std::string& title = "");
+    virtual ~BaseView ();
+    void setPosition (int newX, int newY);
+    void setSize (int newWidth, int newHeight);
+    void setTitle (const std::string& newTitle);
+    void setColors (Color fg, Color bg);
+    void setFocused (bool focused);
+    const std::string& getTitle () const;
+    void requestRedraw ();
+    bool isRedrawNeeded () const;
+    void clear ( Terminal& term);
+    void draw ( Terminal& term);
+    void refresh (Terminal& term);
+    virtual void handleEvent (const std::string& event);
+  protected:
+    virtual void drawFrame (Terminal& term);
+    virtual void drawHeader (Terminal& term);
+    virtual void drawContent (Terminal& term);
+    // Setters and Getters
+//getX / setX
+    int getX() const;
+    void setX(int x);
+//getY / setY
+    int getY() const;
+    void setY(int y);
+//getWidth / setWidth
+    int getWidth() const;
+    void setWidth(int width);
+//getHeight / setHeight
+    int getHeight() const;
+    void setHeight(int height);
+//getTitle / setTitle
+//getNeedsRedraw / setNeedsRedraw
+    bool getNeedsRedraw() const;
+    void setNeedsRedraw(bool needsRedraw);
+//getBgColor / setBgColor
+    Color getBgColor() const;
+    void setBgColor(Color bgColor);
+//getFgColor / setFgColor
+    Color getFgColor() const;
+    void setFgColor(Color fgColor);
+//getFocused / setFocused
+    bool getFocused() const;
+  };
+
+};
+
+#endif
@@ -0,0 +1,35 @@
+// Generated by dia2code
+#ifndef TUI__COLOR__H
+#define TUI__COLOR__H
+
+
+namespace tui {
+
+  /** Color
+   * Enum - 
+   */
+  enum Color {
+    Black,
+    Red,
+    Green,
+    Yellow,
+    Orange,
+    Blue,
+    Magenta,
+    Cyan,
+    White,
+    BrightBlack,
+    BrightRed,
+    BrightGreen,
+    BrightYellow,
+    BrightOrange,
+    BrightBlue,
+    BrightMagenta,
+    BrightCyan,
+    BrightWhite,
+    Default
+  };
+
+};
+
+#endif
@@ -0,0 +1,39 @@
+// Generated by dia2code
+#ifndef TUI__COMMANDINPUT__H
+#define TUI__COMMANDINPUT__H
+
+#include <string>
+
+namespace tui {
+  // Forward declaration
+  class Terminal;
+  // Forward declaration
+  class BaseView;
+}
+
+#include "BaseView.h"
+
+namespace tui {
+
+  /** CommandInput
+   * Class - 
+   */
+  class CommandInput : public tui::BaseView {
+    // Attributes
+  private:
+    std::string currentInput;
+    // Operations
+  public:
+    CommandInput (int x, int y, int width, int height);
+    const std::string& getInput () const;
+    void setInput (const std::string& text);
+    void clearInput ();
+    void parseCommand (std::string& out);
+  protected:
+    virtual void drawContent (Terminal&  term);
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,45 @@
+// Generated by dia2code
+#ifndef TUI__COMMANDPARSER__H
+#define TUI__COMMANDPARSER__H
+
+#include <string>
+
+namespace parser {
+  // Forward declaration
+  class JSONParser;
+};
+namespace tui {
+  // Forward declaration
+  class ParseResult;
+};
+namespace parser {
+  // Forward declaration
+  class CommandMessage;
+}
+
+#include "parser/JSONParser.h"
+#include "ParseResult.h"
+#include "parser/CommandMessage.h"
+
+namespace tui {
+
+  /** CommandParser
+   * Class - 
+   */
+  class CommandParser {
+    // Attributes
+  private:
+    parser::JSONParser jsonparser;
+    // Operations
+  public:
+    ParseResult parse (const std::string& input);
+  private:
+    std::string trim (const std::string& input);
+    std::string toLower (const std::string& input);
+    std::string escapeJson (const std::string& input);
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,19 @@
+// Generated by dia2code
+#ifndef TUI__FOCUS__H
+#define TUI__FOCUS__H
+
+
+namespace tui {
+
+  /** Focus
+   * Enum - 
+   */
+  enum Focus {
+    COMMAND_FOCUS     = 0,
+    MAP_FOCUS     = 1,
+    INFO_FOCUS     = 2
+  };
+
+};
+
+#endif
@@ -17,6 +17,7 @@
 #include "cardsState/PlayerCards.h"
 #include "cardsState/WagonCard.h"
 #include "mapState/Ferry.h"
+#include "mapState/MapImage.h"
 #include "mapState/MapState.h"
 #include "mapState/Road.h"
 #include "mapState/RoadColor.h"
@@ -123,26 +124,19 @@ std::string roadTypeToken(const std::shared_ptr<mapState::Road>& road) {
   if (!road) {
     return "R";
   }
-  if (std::dynamic_pointer_cast<mapState::Tunnel>(road)) {
-    return "T";
+  switch (road->getKind()) {
+    case mapState::RoadKind::TUNNEL: return "T";
+    case mapState::RoadKind::FERRY: return "F";
+    default: return "R";
   }
-  if (std::dynamic_pointer_cast<mapState::Ferry>(road)) {
-    return "F";
-  }
-  return "R";
 }
 
-std::string roadTypeName(const std::shared_ptr<mapState::Road>& road) {
-  if (!road) {
-    return "Road";
-  }
-  if (std::dynamic_pointer_cast<mapState::Tunnel>(road)) {
-    return "Tunnel";
+std::string roadTypeName(mapState::RoadKind kind) {
+  switch (kind) {
+    case mapState::RoadKind::TUNNEL: return "Tunnel";
+    case mapState::RoadKind::FERRY: return "Ferry";
+    default: return "Road";
   }
-  if (std::dynamic_pointer_cast<mapState::Ferry>(road)) {
-    return "Ferry";
-  }
-  return "Road";
 }
 
 Color wagonColorToAnsi(cardsState::ColorCard color) {
@@ -821,6 +815,22 @@ void GameView::drawContent(Terminal& term) {
       }
     }
 
+    // longest routes are cached by the map and only re-solved for the component a claim touched
+    std::vector<int> longestRoutes;
+    std::vector<int> displayLongest(displayPlayers.size(), 0);
+    int longestRoute = 0;
+    if (mapState) {
+      longestRoutes = mapState->getLongestRoutes(playersRef);
+      for (std::size_t p = 0; p < playersRef.size(); ++p) {
+        longestRoute = std::max(longestRoute, longestRoutes[p]);
+        for (std::size_t d = 0; d < displayPlayers.size(); ++d) {
+          if (displayPlayers[d] == playersRef[p]) {
+            displayLongest[d] = longestRoutes[p];
+          }
+        }
+      }
+    }
+
     for (int i = 0; i < static_cast<int>(displayPlayers.size()); ++i) {
       std::shared_ptr<playersState::Player> player = displayPlayers[static_cast<std::size_t>(i)];
       int col = x + kFrameOffset + i * (columnWidth + kPlayerColumnGap);
@@ -883,6 +893,17 @@ void GameView::drawContent(Terminal& term) {
       writeClampedLine(term, currentRow, col, columnWidth, stationsLine.str());
       ++currentRow;
 
+      if (mapState && currentRow < playerEndRow) {
+        const int length = displayLongest[static_cast<std::size_t>(i)];
+        std::ostringstream routeLine;
+        routeLine << "Longest: " << length;
+        if (longestRoute > 0 && length == longestRoute) {
+          routeLine << " (lead)";
+        }
+        writeClampedLine(term, currentRow, col, columnWidth, routeLine.str());
+        ++currentRow;
+      }
+
       if (!showFullDetails || currentRow >= playerEndRow) {
         continue;
       }
@@ -1397,27 +1418,32 @@ void GameView::drawContent(Terminal& term) {
       ++detailsRow;
     }
 
+    // sweep the map's road columns; only the matching rows touch the road objects
     const std::vector<std::shared_ptr<mapState::Road>> roads = mapState->getRoads();
-    for (std::size_t i = 0; i < roads.size() && detailsRow < endRow; ++i) {
-      const std::shared_ptr<mapState::Road>& road = roads[i];
-      if (!road || !road->getStationA() || !road->getStationB()) {
-        continue;
-      }
-      const std::string a = road->getStationA()->getName();
-      const std::string b = road->getStationB()->getName();
-      if (a != selected.name && b != selected.name) {
+    const std::vector<int>& endpointsA = mapState->getRoadEndpointsA();
+    const std::vector<int>& endpointsB = mapState->getRoadEndpointsB();
+    const std::vector<int>& lengths = mapState->getRoadLengths();
+    const std::vector<mapState::RoadColor>& colors = mapState->getRoadColors();
+    const std::vector<mapState::RoadKind>& kinds = mapState->getRoadKinds();
+    const std::vector<int>& locomotives = mapState->getRoadLocomotives();
+    const std::vector<int>& ownerSlots = mapState->getRoadOwnerSlots();
+    const std::vector<std::shared_ptr<playersState::Player>>& owners = mapState->getRoadOwnerTable();
+    const int selectedId = mapState->getStationId(selected.name);
+    for (std::size_t i = 0; selectedId >= 0 && i < roads.size() && detailsRow < endRow; ++i) {
+      if (endpointsA[i] != selectedId && endpointsB[i] != selectedId) {
         continue;
       }
 
-      std::string otherName = (a == selected.name) ? b : a;
+      const int otherId = (endpointsA[i] == selectedId) ? endpointsB[i] : endpointsA[i];
+      std::string otherName = stations[static_cast<std::size_t>(otherId)]->getName();
       int layoutIndex = findLayoutIndexByName(otherName);
       std::string otherLabel = (layoutIndex >= 0)
           ? layoutEntries[static_cast<std::size_t>(layoutIndex)].label
           : toUpperShort(otherName);
 
       std::string ownerTag = "X";
-      if (road->getOwner() != nullptr && players != nullptr) {
-        int ownerIndex = findPlayerIndex(*players, road->getOwner());
+      if (ownerSlots[i] >= 0 && players != nullptr) {
+        int ownerIndex = findPlayerIndex(*players, owners[static_cast<std::size_t>(ownerSlots[i])]);
         if (ownerIndex >= 0) {
           ownerTag = playerShortLabel(ownerIndex);
         } else {
@@ -1425,26 +1451,22 @@ void GameView::drawContent(Terminal& term) {
         }
       }
       std::string locsText = "NONE";
-      if (std::dynamic_pointer_cast<mapState::Ferry>(road)) {
-        std::shared_ptr<mapState::Ferry> ferry =
-            std::dynamic_pointer_cast<mapState::Ferry>(road);
-        if (ferry) {
-          locsText = std::to_string(ferry->getLocomotives());
-        }
+      if (kinds[i] == mapState::RoadKind::FERRY) {
+        locsText = std::to_string(locomotives[i]);
       }
 
       const std::string endpointText = selected.label + "<->" + otherLabel;
-      const std::string lengthText = std::to_string(road->getLength());
+      const std::string lengthText = std::to_string(lengths[i]);
       std::vector<std::string> rowCells;
-      rowCells.push_back(std::to_string(road->getId()));
-      rowCells.push_back(roadTypeName(road));
+      rowCells.push_back(std::to_string(roads[i]->getId()));
+      rowCells.push_back(roadTypeName(kinds[i]));
       rowCells.push_back(endpointText);
       rowCells.push_back(lengthText);
-      rowCells.push_back(colorCardToString(road->getColor()));
+      rowCells.push_back(colorCardToString(colors[i]));
       rowCells.push_back(ownerTag);
       rowCells.push_back(locsText);
 
-      term.setFg(roadColorToAnsi(road->getColor()));
+      term.setFg(roadColorToAnsi(colors[i]));
       writeClampedLine(term, detailsRow, detailsX, detailsWidth,
                        buildTableRow(rowCells, columnWidths));
       term.setFg(fgColor);
@@ -1541,6 +1563,38 @@ bool GameView::loadLayout(const std::string& path) {
     return false;
   }
 
+  // a compiled map image carries the layout of its stations
+  mapState::MapImage image;
+  if (image.open(path)) {
+    for (int s = 0; s < image.getStationCount(); ++s) {
+      if (image.getStationRow(s) < 0 || image.getStationColumn(s) < 0) {
+        continue;
+      }
+      StationLayout entry;
+      entry.name = image.getStationName(s);
+      entry.label = image.getStationNickname(s);
+      if (entry.label.empty()) {
+        entry.label = toUpperShort(entry.name);
+      }
+      entry.row = image.getStationRow(s);
+      entry.col = image.getStationColumn(s);
+      layoutEntries.push_back(entry);
+      if (layoutEntries.size() == 1) {
+        layoutMinRow = entry.row;
+        layoutMaxRow = entry.row;
+        layoutMinCol = entry.col;
+        layoutMaxCol = entry.col;
+      } else {
+        layoutMinRow = std::min(layoutMinRow, entry.row);
+        layoutMaxRow = std::max(layoutMaxRow, entry.row);
+        layoutMinCol = std::min(layoutMinCol, entry.col);
+        layoutMaxCol = std::max(layoutMaxCol, entry.col);
+      }
+    }
+    layoutLoaded = !layoutEntries.empty();
+    return layoutLoaded;
+  }
+
   std::stringstream buffer;
   buffer << file.rdbuf();
   std::string content = buffer.str();
@@ -0,0 +1,95 @@
+// Generated by dia2code
+#ifndef TUI__GAMEVIEW__H
+#define TUI__GAMEVIEW__H
+
+#include <string>
+#include <vector>
+
+namespace mapState {
+  // Forward declaration
+  class MapState;
+};
+namespace playersState {
+  // Forward declaration
+  class PlayersState;
+};
+namespace cardsState {
+  // Forward declaration
+  class CardsState;
+};
+namespace tui {
+  // Forward declaration
+  class StationLayout;
+  // Forward declaration
+  class Terminal;
+  // Forward declaration
+  class BaseView;
+}
+
+#include "ViewMode.h"
+#include "StationLayout.h"
+#include "BaseView.h"
+#include "mapState/MapState.h"
+
+namespace tui {
+
+  /** GameView
+   * Class - 
+   */
+  class GameView : public tui::BaseView {
+    // Attributes
+  public:
+    bool compactOtherPlayers;
+    bool showLocalPlayerMarker;
+  private:
+    mapState::MapState* mapState;
+    playersState::PlayersState* playerState;
+    cardsState::CardsState* cardState;
+    ViewMode mode;
+    bool highlightCurrentPlayer;
+    int highlightNodeId;
+    int scrollX;
+    int scrollY;
+    bool layoutLoaded;
+    int layoutMinRow;
+    int layoutMaxRow;
+    int layoutMinCol;
+    int layoutMaxCol;
+    std::string layoutPath;
+    std::vector<StationLayout> layoutEntries;
+    std::string searchQuery;
+    int playerScrollIndex;
+    int localPlayerIndex;
+    // Operations
+  public:
+    GameView (int x, int y, int width, int height);
+    void setMapState (mapState::MapState* state);
+    void setPlayerState (playersState::PlayersState* state);
+    void setCardsState (cardsState::CardsState* state);
+    void setMode (ViewMode mode);
+    ViewMode getMode () const;
+    void moveSelection (int deltaRow, int deltaCol);
+    void setSearchQuery (const std::string& query);
+    void appendSearchChar (char ch);
+    void backspaceSearch ();
+    void clearSearchQuery ();
+    void setHighlightActivePlayer (bool enable);
+    void setHighlightNode (int nodeID);
+    void refreshOwnerships ();
+  private:
+    std::string colorCardToString (mapState::RoadColor color);
+    int findUniqueMatchIndex (const std::string& query);
+    void writeClampedLine (Terminal& term, int row, int col, int width, const std::string& text);
+    bool loadLayout (const std::string& path);
+    int findLayoutIndexByName (const std::string& name);
+    void setLocalPlayerIndex (int index);
+    void setCompactOtherPlayers (bool enabled);
+    void setShowLocalPlayerMarker (bool enabled);
+  protected:
+    virtual void drawContent (Terminal& term);
+    // Setters and Getters
+  };
+
+};
+
+#endif
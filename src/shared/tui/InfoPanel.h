@@ -0,0 +1,40 @@
+// Generated by dia2code
+#ifndef TUI__INFOPANEL__H
+#define TUI__INFOPANEL__H
+
+#include <string>
+#include <vector>
+
+namespace tui {
+  // Forward declaration
+  class BaseView;
+}
+
+#include "BaseView.h"
+
+namespace tui {
+
+  /** InfoPanel
+   * Class - 
+   */
+  class InfoPanel : public tui::BaseView {
+    // Attributes
+  private:
+    std::vector<std::string> messages;
+    int scrollOffset;
+    int maxMessages;
+    // Operations
+  public:
+    InfoPanel (int x, int y, int width, int height, int maxMessages);
+    void addMessage (const std::string& message);
+    void clearMessages ();
+    void scroll (int delta);
+    int getVisibleLineCount () const;
+  protected:
+    virtual void drawContent ( Terminal& term);
+    // Setters and Getters
+  };
+
+};
+
+#endif
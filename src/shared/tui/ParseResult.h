@@ -0,0 +1,17 @@
+// Generated by dia2code
+#ifndef TUI__PARSERESULT__H
+#define TUI__PARSERESULT__H
+
+#include <string>
+
+namespace tui {
+
+  struct ParseResult {
+    bool ok;
+    std::string json;
+    std::string error;
+  };
+
+};
+
+#endif
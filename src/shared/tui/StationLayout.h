@@ -0,0 +1,18 @@
+// Generated by dia2code
+#ifndef TUI__STATIONLAYOUT__H
+#define TUI__STATIONLAYOUT__H
+
+#include <string>
+
+namespace tui {
+
+  struct StationLayout {
+    std::string name;
+    std::string label;
+    int row;
+    int col;
+  };
+
+};
+
+#endif
@@ -0,0 +1,44 @@
+// Generated by dia2code
+#ifndef TUI__STATUSBAR__H
+#define TUI__STATUSBAR__H
+
+#include <string>
+
+namespace tui {
+  // Forward declaration
+  class Terminal;
+  // Forward declaration
+  class BaseView;
+}
+
+#include "BaseView.h"
+
+namespace tui {
+
+  /** StatusBar
+   * Class - 
+   */
+  class StatusBar : public tui::BaseView {
+    // Attributes
+  private:
+    std::string gameName;
+    std::string version;
+    int currentTurn;
+    playersState::Player* currentPlayer;
+    bool debugRender;
+    // Operations
+  public:
+    StatusBar (int x, int y, int width, int height);
+    void setGameInfo (const std::string& name, const std::string& version);
+    void setTurn (int turn);
+    void setCurrentPlayer (playersState::Player* player);
+    void setDebugRender (bool enabled);
+  protected:
+    virtual void drawFrame (Terminal& term);
+    virtual void drawHeader (Terminal& term);
+    // Setters and Getters
+  };
+
+};
+
+#endif
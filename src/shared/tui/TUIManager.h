@@ -0,0 +1,117 @@
+// Generated by dia2code
+#ifndef TUI__TUIMANAGER__H
+#define TUI__TUIMANAGER__H
+
+#include <memory>
+#include <string>
+
+namespace tui {
+  // Forward declaration
+  class Terminal;
+  // Forward declaration
+  class StatusBar;
+  // Forward declaration
+  class GameView;
+  // Forward declaration
+  class InfoPanel;
+  // Forward declaration
+  class CommandInput;
+};
+namespace mapState {
+  // Forward declaration
+  class MapState;
+};
+namespace playersState {
+  // Forward declaration
+  class PlayersState;
+};
+namespace cardsState {
+  // Forward declaration
+  class CardsState;
+};
+namespace engine {
+  // Forward declaration
+  class Engine;
+  // Forward declaration
+  class CommandParser;
+};
+namespace tui {
+  // Forward declaration
+  class CommandParser;
+};
+namespace parser {
+  // Forward declaration
+  class JSONParser;
+  // Forward declaration
+  class EventMessage;
+  // Forward declaration
+  class ResultMessage;
+}
+
+#include "Focus.h"
+#include "engine/Engine.h"
+#include "engine/CommandParser.h"
+#include "CommandParser.h"
+#include "parser/JSONParser.h"
+#include "parser/EventMessage.h"
+#include "parser/ResultMessage.h"
+#include "cardsState/CardsState.h"
+#include "playersState/PlayersState.h"
+#include "mapState/MapState.h"
+#include "Terminal.h"
+#include "CommandInput.h"
+#include "InfoPanel.h"
+#include "GameView.h"
+#include "StatusBar.h"
+
+namespace tui {
+
+  /** TUIManager
+   * Class - 
+   */
+  class TUIManager {
+    // Associations
+    // Attributes
+  public:
+    int cols;
+    int rows;
+  private:
+    Terminal* term;
+    StatusBar* statusbar;
+    GameView* gameview;
+    InfoPanel* infopanel;
+    CommandInput* commandinput;
+    bool running;
+    bool debugRender;
+    Focus focus;
+    mapState::MapState* mapstate;
+    playersState::PlayersState* playerstate;
+    cardsState::CardsState* cardstate;
+    std::shared_ptr<engine::Engine> engine;
+    engine::CommandParser engineParser;
+    bool ownsMapState;
+    bool ownsPlayerState;
+    bool ownsCardState;
+    tui::CommandParser parser;
+    // Operations
+  public:
+    TUIManager (Terminal* terminal, int cols, int rows);
+    TUIManager (Terminal* terminal, int cols, int rows, mapState::MapState* mapState, playersState::PlayersState* playerState, cardsState::CardsState* cardState);
+    void init ();
+    void updateLayout (int cols, int rows);
+    void setFocus (Focus focus);
+    void focusNext ();
+    void focusPrev ();
+    void drawAll ();
+    void handleInput (const std::string& input);
+    void tick ();
+    void shutdown ();
+    void runMainLoop ();
+    void setDebugRender (bool enabled);
+    void setEngine (std::shared_ptr<engine::Engine> engine);
+    // Setters and Getters
+  };
+
+};
+
+#endif
@@ -0,0 +1,41 @@
+// Generated by dia2code
+#ifndef TUI__TERMINAL__H
+#define TUI__TERMINAL__H
+
+#include <string>
+
+#include "Color.h"
+
+namespace tui {
+
+  /** Terminal
+   * Class - 
+   */
+  class Terminal {
+    // Attributes
+  private:
+    std::string out;
+    bool cursorHidden;
+    // Operations
+  public:
+    Terminal (std::string outputStream = "");
+    void moveTo (int row, int col);
+    void setFg (Color color);
+    /// setBg
+    /** Public Method - 
+     * 				
+     */
+    void setBg (Color color);
+    void resetStyles ();
+    void clearRegion (int row, int col, int width, int height);
+    void write (const std::string& text);
+    void writeRepeat (char ch, int count);
+    void hideCursor ();
+    void showCursor ();
+    void flush ();
+    // Setters and Getters
+  };
+
+};
+
+#endif
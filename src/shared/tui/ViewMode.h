@@ -0,0 +1,19 @@
+// Generated by dia2code
+#ifndef TUI__VIEWMODE__H
+#define TUI__VIEWMODE__H
+
+
+namespace tui {
+
+  /** ViewMode
+   * Enum - 
+   */
+  enum ViewMode {
+    MAP     = 0,
+    PLAYER     = 1,
+    CARDS     = 2
+  };
+
+};
+
+#endif
@@ -65,11 +65,9 @@ TEST(BatchConstructor)
     std::shared_ptr<boost::adjacency_list<>> graph =
         std::make_shared<boost::adjacency_list<>>();
 
-    std::shared_ptr<boost::adjacency_list<>::vertex_descriptor> vertexA = std::make_shared<boost::adjacency_list<>::vertex_descriptor>(
-        boost::add_vertex(*graph));
+    boost::adjacency_list<>::vertex_descriptor vertexA = boost::add_vertex(*graph);
 
-    std::shared_ptr<boost::adjacency_list<>::vertex_descriptor> vertexB = std::make_shared<boost::adjacency_list<>::vertex_descriptor>(
-        boost::add_vertex(*graph));
+    boost::adjacency_list<>::vertex_descriptor vertexB = boost::add_vertex(*graph);
 
     std::shared_ptr<Station> stationA =
         std::make_shared<Station>("StationA", test_owner, vertexA);
@@ -97,11 +95,9 @@ TEST(BatchConstructorByName)
     std::shared_ptr<boost::adjacency_list<>> graph =
         std::make_shared<boost::adjacency_list<>>();
 
-    std::shared_ptr<boost::adjacency_list<>::vertex_descriptor> vertexA = std::make_shared<boost::adjacency_list<>::vertex_descriptor>(
-        boost::add_vertex(*graph));
+    boost::adjacency_list<>::vertex_descriptor vertexA = boost::add_vertex(*graph);
 
-    std::shared_ptr<boost::adjacency_list<>::vertex_descriptor> vertexB = std::make_shared<boost::adjacency_list<>::vertex_descriptor>(
-        boost::add_vertex(*graph));
+    boost::adjacency_list<>::vertex_descriptor vertexB = boost::add_vertex(*graph);
 
     std::shared_ptr<Station> stationA =
         std::make_shared<Station>("StationA", test_owner, vertexA);
@@ -148,11 +144,9 @@ std::shared_ptr<playersState::Player> test_owner =
 std::shared_ptr<boost::adjacency_list<>> graph =
     std::make_shared<boost::adjacency_list<>>();
 
-std::shared_ptr<boost::adjacency_list<>::vertex_descriptor> vertexA = std::make_shared<boost::adjacency_list<>::vertex_descriptor>(
-    boost::add_vertex(*graph));
+boost::adjacency_list<>::vertex_descriptor vertexA = boost::add_vertex(*graph);
 
-std::shared_ptr<boost::adjacency_list<>::vertex_descriptor> vertexB = std::make_shared<boost::adjacency_list<>::vertex_descriptor>(
-    boost::add_vertex(*graph));
+boost::adjacency_list<>::vertex_descriptor vertexB = boost::add_vertex(*graph);
 
 std::shared_ptr<Station> stationA =
     std::make_shared<Station>(test_stationA_name, test_owner, vertexA);
@@ -216,9 +210,9 @@ TEST(Display)
     std::streambuf *old = std::cout.rdbuf(buffer.rdbuf());
 
     std::shared_ptr<Station> stationA =
-        std::make_shared<Station>("StationA", nullptr, nullptr);
+        std::make_shared<Station>("StationA", nullptr);
     std::shared_ptr<Station> stationB =
-        std::make_shared<Station>("StationB", nullptr, nullptr);
+        std::make_shared<Station>("StationB", nullptr);
     int test_points = 10;
     DestinationCard card(stationA, stationB, test_points, false);
     card.display();
@@ -233,9 +227,9 @@ TEST(_Display)
 {
     ANN_START("_display");
     std::shared_ptr<Station> stationA =
-        std::make_shared<Station>("StationA", nullptr, nullptr);
+        std::make_shared<Station>("StationA", nullptr);
     std::shared_ptr<Station> stationB =
-        std::make_shared<Station>("StationB", nullptr, nullptr);
+        std::make_shared<Station>("StationB", nullptr);
     int test_points = 10;
     DestinationCard card(stationA, stationB, test_points, false);
 
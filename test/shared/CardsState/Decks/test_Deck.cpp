@@ -151,10 +151,8 @@ TEST(BatchDeck)
         // ---- Graph ----
         auto graph = std::make_shared<boost::adjacency_list<>>();
 
-        auto v1 = std::make_shared<boost::adjacency_list<>::vertex_descriptor>(
-            boost::add_vertex(*graph));
-        auto v2 = std::make_shared<boost::adjacency_list<>::vertex_descriptor>(
-            boost::add_vertex(*graph));
+        auto v1 = boost::add_vertex(*graph);
+        auto v2 = boost::add_vertex(*graph);
 
         // ---- Owner ----
         auto owner = std::make_shared<playersState::Player>("TestPlayer", playersState::PlayerColor::RED, 0, 45, 3, borrowedRoads, nullptr);
@@ -5,9 +5,11 @@
 #include <string>
 
 #include "../../src/shared/engine/CommandParser.h"
+#include "../../src/shared/engine/EndGameState.h"
 #include "../../src/shared/engine/Engine.h"
 #include "../../src/shared/engine/EngineResult.h"
 #include "../../src/shared/engine/Phase.h"
+#include "../../src/shared/state/State.h"
 
 #include <json/json.h>
 
@@ -72,4 +74,65 @@ BOOST_AUTO_TEST_CASE(EngineJsonTestsDisabled)
   BOOST_CHECK(true);
 }
 
+namespace
+{
+  // final score announced for this player in the engine's pending events, -1 when there is none
+  int finalScore(const std::vector<engine::EngineEvent>& events, const std::string& name)
+  {
+    const std::string prefix = name + " final score: ";
+    int score = -1;
+    for (const engine::EngineEvent& event : events)
+    {
+      if (event.message.compare(0, prefix.size(), prefix) == 0)
+      {
+        score = std::stoi(event.message.substr(prefix.size()));
+      }
+    }
+    return score;
+  }
+}
+
+// Tickets still in hand score once their stations are joined, through the player's own roads or a road
+// borrowed with a station, and entering the end game again gives the same scores.
+BOOST_AUTO_TEST_CASE(EndGameScoresHandTicketsOnce)
+{
+  std::vector<std::shared_ptr<mapState::Road>> noRoads;
+  std::shared_ptr<playersState::Player> red = std::make_shared<playersState::Player>("Red", playersState::PlayerColor::RED, 0, 40, 2, noRoads, nullptr);
+  std::shared_ptr<playersState::Player> blue = std::make_shared<playersState::Player>("Blue", playersState::PlayerColor::BLUE, 0, 40, 3, noRoads, nullptr);
+
+  std::shared_ptr<state::State> state = std::make_shared<state::State>();
+  std::vector<std::tuple<std::shared_ptr<playersState::Player>, std::string>> stationsInfos = {
+      mapState::Station::initData("A"), mapState::Station::initData("B"), mapState::Station::genData(red, "C"), mapState::Station::initData("D")};
+  std::vector<std::shared_ptr<mapState::Station>> stations = mapState::Station::BatchConstructor(stationsInfos, state->map.gameGraph);
+  state->map.fillMapWithInfos(stationsInfos,
+                              {mapState::Road::genDataByName(stations, "A", "B", 1, red, mapState::RoadColor::RED, 3),
+                               mapState::Road::genDataByName(stations, "B", "C", 2, blue, mapState::RoadColor::BLUE, 2),
+                               mapState::Road::initDataByName(stations, "C", "D", 3, mapState::RoadColor::GREEN, 2)},
+                              {}, {}, state->map.gameGraph);
+  stations = state->map.getStations();
+  std::vector<std::shared_ptr<cardsState::DestinationCard>> tickets = {
+      std::make_shared<cardsState::DestinationCard>(stations[0], stations[1], 10, false),
+      std::make_shared<cardsState::DestinationCard>(stations[0], stations[2], 7, false),
+      std::make_shared<cardsState::DestinationCard>(stations[0], stations[3], 20, false)};
+  red->hand = std::make_shared<cardsState::PlayerCards>(tickets, std::vector<std::shared_ptr<cardsState::WagonCard>>());
+  state->players = playersState::PlayersState({red, blue});
+
+  std::shared_ptr<engine::Engine> enginePtr = std::make_shared<engine::Engine>(state);
+  engine::EndGameState endGame;
+  enginePtr->pendingEvents.clear();
+  endGame.onEnter(enginePtr);
+  // A-B on Red's own road, A-C through Blue's B-C borrowed with the station on C, A-D out of reach,
+  // plus the longest route bonus
+  BOOST_CHECK_EQUAL(finalScore(enginePtr->pendingEvents, "Red"), 27);
+  BOOST_CHECK_EQUAL(finalScore(enginePtr->pendingEvents, "Blue"), 0);
+  BOOST_CHECK(red->getBorrowedRoads().empty());
+  BOOST_CHECK(red->completedDestinations.empty());
+
+  enginePtr->pendingEvents.clear();
+  endGame.onEnter(enginePtr);
+  BOOST_CHECK_EQUAL(finalScore(enginePtr->pendingEvents, "Red"), 27);
+  BOOST_CHECK_EQUAL(finalScore(enginePtr->pendingEvents, "Blue"), 0);
+  BOOST_CHECK(red->getBorrowedRoads().empty());
+}
+
 /* vim: set sw=2 sts=2 et : */
@@ -41,13 +41,12 @@ TEST(TestStaticAssert)
 std::vector<std::shared_ptr<Road>> borrowedRoads;
 
 std::shared_ptr<boost::adjacency_list<>> test_graph = std::make_shared<boost::adjacency_list<>>();
-std::shared_ptr<mapState::Station> test_stationA = std::make_shared<mapState::Station>("StationA", std::make_shared<playersState::Player>("OwnerA", playersState::PlayerColor::RED, 0, 30, 2, borrowedRoads, nullptr), std::make_shared<boost::adjacency_list<>::vertex_descriptor>(boost::add_vertex(*test_graph)));
-std::shared_ptr<mapState::Station> test_stationB = std::make_shared<mapState::Station>("StationB", std::make_shared<playersState::Player>("OwnerB", playersState::PlayerColor::BLUE, 0, 45, 3, borrowedRoads, nullptr), std::make_shared<boost::adjacency_list<>::vertex_descriptor>(boost::add_vertex(*test_graph)));
+std::shared_ptr<mapState::Station> test_stationA = std::make_shared<mapState::Station>("StationA", std::make_shared<playersState::Player>("OwnerA", playersState::PlayerColor::RED, 0, 30, 2, borrowedRoads, nullptr), boost::add_vertex(*test_graph));
+std::shared_ptr<mapState::Station> test_stationB = std::make_shared<mapState::Station>("StationB", std::make_shared<playersState::Player>("OwnerB", playersState::PlayerColor::BLUE, 0, 45, 3, borrowedRoads, nullptr), boost::add_vertex(*test_graph));
 int test_ferry_id = 101;
 int test_length = 5;
 std::shared_ptr<playersState::Player> test_owner = std::make_shared<playersState::Player>("TestOwner", playersState::PlayerColor::YELLOW, 0, 40, 4, borrowedRoads, nullptr);
-std::shared_ptr<boost::adjacency_list<>::edge_descriptor> test_edge = std::make_shared<boost::adjacency_list<>::edge_descriptor>(
-    boost::add_edge(*(test_stationA->getVertex().get()), *(test_stationB->getVertex().get()), *test_graph).first);
+boost::adjacency_list<>::edge_descriptor test_edge = boost::add_edge(test_stationA->getVertex(), test_stationB->getVertex(), *test_graph).first;
 int test_locomotives = 2;
 
 SUITE_START(Constructors)
@@ -62,7 +61,7 @@ TEST(Basic)
   CHECK_EQ(test_ferry.stationB, test_stationB);
   CHECK_EQ(test_ferry.color, RoadColor::NONE);
   CHECK_EQ(test_ferry.length, test_length);
-  CHECK_EQ(*test_ferry.edge, *test_edge);
+  CHECK_EQ(test_ferry.edge, test_edge);
   CHECK_EQ(test_ferry.locomotives, test_locomotives);
   ANN_END("Basic Constructor")
 }
@@ -78,7 +77,7 @@ TEST(Default)
   CHECK_EQ(ferry.stationB, nullptr);
   CHECK_EQ(ferry.color, RoadColor::UNKNOWN);
   CHECK_EQ(ferry.length, -1);
-  CHECK_EQ(ferry.edge, nullptr);
+  CHECK(ferry.edge.get_property() == nullptr);
   CHECK_EQ(ferry.locomotives, -1);
   ANN_END("Default Constructor")
 }
@@ -94,7 +93,7 @@ TEST(Init)
   CHECK_EQ(test_ferry.stationB, test_stationB);
   CHECK_EQ(test_ferry.color, RoadColor::NONE);
   CHECK_EQ(test_ferry.length, test_length);
-  CHECK(test_ferry.edge != nullptr);
+  CHECK(test_ferry.edge.get_property() != nullptr);
   CHECK_EQ(test_ferry.locomotives, test_locomotives);
   ANN_END("Init Constructor")
 }
@@ -110,9 +109,9 @@ TEST(BatchConstructor)
     std::shared_ptr<playersState::Player> stationA_owner = std::make_shared<playersState::Player>("BatchOwnerStationA", playersState::PlayerColor::RED, 0, 30, 2, borrowedRoads, nullptr);
     std::shared_ptr<playersState::Player> stationB_owner = std::make_shared<playersState::Player>("BatchOwnerStationB", playersState::PlayerColor::BLUE, 0, 45, 3, borrowedRoads, nullptr);
     std::shared_ptr<playersState::Player> stationC_owner = std::make_shared<playersState::Player>("BatchOwnerStationC", playersState::PlayerColor::GREEN, 0, 50, 4, borrowedRoads, nullptr);
-    std::shared_ptr<mapState::Station> batch_stationA = std::make_shared<mapState::Station>(stationA_name, stationA_owner, std::make_shared<boost::adjacency_list<>::vertex_descriptor>(boost::add_vertex(*test_graph)));
-    std::shared_ptr<mapState::Station> batch_stationB = std::make_shared<mapState::Station>(stationB_name, stationB_owner, std::make_shared<boost::adjacency_list<>::vertex_descriptor>(boost::add_vertex(*test_graph)));
-    std::shared_ptr<mapState::Station> batch_stationC = std::make_shared<mapState::Station>(stationC_name, stationC_owner, std::make_shared<boost::adjacency_list<>::vertex_descriptor>(boost::add_vertex(*test_graph)));
+    std::shared_ptr<mapState::Station> batch_stationA = std::make_shared<mapState::Station>(stationA_name, stationA_owner, boost::add_vertex(*test_graph));
+    std::shared_ptr<mapState::Station> batch_stationB = std::make_shared<mapState::Station>(stationB_name, stationB_owner, boost::add_vertex(*test_graph));
+    std::shared_ptr<mapState::Station> batch_stationC = std::make_shared<mapState::Station>(stationC_name, stationC_owner, boost::add_vertex(*test_graph));
     std::shared_ptr<playersState::Player> batch_owner1 = std::make_shared<playersState::Player>("BatchOwnerFerry1", playersState::PlayerColor::RED, 0, 50, 5, borrowedRoads, nullptr);
     std::shared_ptr<playersState::Player> batch_owner2 = std::make_shared<playersState::Player>("BatchOwnerFerry2", playersState::PlayerColor::BLACK, 0, 55, 6, borrowedRoads, nullptr);
     std::shared_ptr<playersState::Player> batch_owner3 = std::make_shared<playersState::Player>("BatchOwnerFerry3", playersState::PlayerColor::YELLOW, 0, 60, 7, borrowedRoads, nullptr);
@@ -248,7 +247,7 @@ TEST(getEdge)
 {
   ANN_START("getEdge")
 
-  CHECK_EQ(*test_ferry_getters_and_setters.getEdge(), *test_edge);
+  CHECK_EQ(test_ferry_getters_and_setters.getEdge(), test_edge);
   ANN_END("getEdge")
 }
 
@@ -272,7 +271,7 @@ TEST(getVertexA)
 {
   ANN_START("getVertexA")
 
-  CHECK_EQ(*test_ferry_getters_and_setters.getVertexA(), *(test_stationA->vertex));
+  CHECK_EQ(test_ferry_getters_and_setters.getVertexA(), test_stationA->vertex);
   ANN_END("getVertexA")
 }
 
@@ -280,7 +279,7 @@ TEST(getVertexB)
 {
   ANN_START("getVertexB")
 
-  CHECK_EQ(*test_ferry_getters_and_setters.getVertexB(), *(test_stationB->vertex));
+  CHECK_EQ(test_ferry_getters_and_setters.getVertexB(), test_stationB->vertex);
   ANN_END("getVertexB")
 }
 
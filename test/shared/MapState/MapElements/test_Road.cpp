@@ -39,14 +39,13 @@ TEST(TestStaticAssert)
 }
 std::vector<std::shared_ptr<Road>> borrowedRoads;
 std::shared_ptr<boost::adjacency_list<>> test_graph = std::make_shared<boost::adjacency_list<>>();
-std::shared_ptr<mapState::Station> test_stationA = std::make_shared<mapState::Station>("StationA", std::make_shared<playersState::Player>("OwnerA", playersState::PlayerColor::RED, 0, 30, 2, borrowedRoads, nullptr), std::make_shared<boost::adjacency_list<>::vertex_descriptor>(boost::add_vertex(*test_graph)));
-std::shared_ptr<mapState::Station> test_stationB = std::make_shared<mapState::Station>("StationB", std::make_shared<playersState::Player>("OwnerB", playersState::PlayerColor::BLUE, 0, 45, 3, borrowedRoads, nullptr), std::make_shared<boost::adjacency_list<>::vertex_descriptor>(boost::add_vertex(*test_graph)));
+std::shared_ptr<mapState::Station> test_stationA = std::make_shared<mapState::Station>("StationA", std::make_shared<playersState::Player>("OwnerA", playersState::PlayerColor::RED, 0, 30, 2, borrowedRoads, nullptr), boost::add_vertex(*test_graph));
+std::shared_ptr<mapState::Station> test_stationB = std::make_shared<mapState::Station>("StationB", std::make_shared<playersState::Player>("OwnerB", playersState::PlayerColor::BLUE, 0, 45, 3, borrowedRoads, nullptr), boost::add_vertex(*test_graph));
 int test_road_id = 101;
 RoadColor test_color = RoadColor::GREEN;
 int test_length = 5;
 std::shared_ptr<playersState::Player> test_owner = std::make_shared<playersState::Player>("TestOwner", playersState::PlayerColor::YELLOW, 0, 40, 4, borrowedRoads, nullptr);
-std::shared_ptr<boost::adjacency_list<>::edge_descriptor> test_edge = std::make_shared<boost::adjacency_list<>::edge_descriptor>(
-    boost::add_edge(*(test_stationA->getVertex().get()), *(test_stationB->getVertex().get()), *test_graph).first);
+boost::adjacency_list<>::edge_descriptor test_edge = boost::add_edge(test_stationA->getVertex(), test_stationB->getVertex(), *test_graph).first;
 
 SUITE_START(Constructors)
 
@@ -61,7 +60,7 @@ TEST(Default)
   CHECK_EQ(road.stationB, nullptr);
   CHECK_EQ(road.color, RoadColor::UNKNOWN);
   CHECK_EQ(road.length, -1);
-  CHECK_EQ(road.edge, nullptr);
+  CHECK(road.edge.get_property() == nullptr);
   ANN_END("Default Constructor")
 }
 
@@ -75,7 +74,7 @@ TEST(Basic)
   CHECK_EQ(test_road.stationB, test_stationB);
   CHECK_EQ(test_road.color, test_color);
   CHECK_EQ(test_road.length, test_length);
-  CHECK_EQ(*test_road.edge, *test_edge);
+  CHECK_EQ(test_road.edge, test_edge);
 }
 
 TEST(Init)
@@ -88,7 +87,7 @@ TEST(Init)
   CHECK_EQ(test_road.stationB, test_stationB);
   CHECK_EQ(test_road.color, test_color);
   CHECK_EQ(test_road.length, test_length);
-  CHECK(test_road.edge != nullptr);
+  CHECK(test_road.edge.get_property() != nullptr);
   ANN_END("Init Constructor")
 }
 
@@ -103,9 +102,9 @@ TEST(BatchConstructor)
     std::shared_ptr<playersState::Player> stationA_owner = std::make_shared<playersState::Player>("BatchOwnerStationA", playersState::PlayerColor::RED, 0, 30, 2, borrowedRoads, nullptr);
     std::shared_ptr<playersState::Player> stationB_owner = std::make_shared<playersState::Player>("BatchOwnerStationB", playersState::PlayerColor::BLUE, 0, 45, 3, borrowedRoads, nullptr);
     std::shared_ptr<playersState::Player> stationC_owner = std::make_shared<playersState::Player>("BatchOwnerStationC", playersState::PlayerColor::GREEN, 0, 50, 4, borrowedRoads, nullptr);
-    std::shared_ptr<mapState::Station> batch_stationA = std::make_shared<mapState::Station>(stationA_name, stationA_owner, std::make_shared<boost::adjacency_list<>::vertex_descriptor>(boost::add_vertex(*test_graph)));
-    std::shared_ptr<mapState::Station> batch_stationB = std::make_shared<mapState::Station>(stationB_name, stationB_owner, std::make_shared<boost::adjacency_list<>::vertex_descriptor>(boost::add_vertex(*test_graph)));
-    std::shared_ptr<mapState::Station> batch_stationC = std::make_shared<mapState::Station>(stationC_name, stationC_owner, std::make_shared<boost::adjacency_list<>::vertex_descriptor>(boost::add_vertex(*test_graph)));
+    std::shared_ptr<mapState::Station> batch_stationA = std::make_shared<mapState::Station>(stationA_name, stationA_owner, boost::add_vertex(*test_graph));
+    std::shared_ptr<mapState::Station> batch_stationB = std::make_shared<mapState::Station>(stationB_name, stationB_owner, boost::add_vertex(*test_graph));
+    std::shared_ptr<mapState::Station> batch_stationC = std::make_shared<mapState::Station>(stationC_name, stationC_owner, boost::add_vertex(*test_graph));
     std::shared_ptr<playersState::Player> batch_owner1 = std::make_shared<playersState::Player>("BatchOwnerRoad1", playersState::PlayerColor::RED, 0, 50, 5, borrowedRoads, nullptr);
     std::shared_ptr<playersState::Player> batch_owner2 = std::make_shared<playersState::Player>("BatchOwnerRoad2", playersState::PlayerColor::BLACK, 0, 55, 6, borrowedRoads, nullptr);
     std::shared_ptr<playersState::Player> batch_owner3 = std::make_shared<playersState::Player>("BatchOwnerRoad3", playersState::PlayerColor::YELLOW, 0, 60, 7, borrowedRoads, nullptr);
@@ -247,7 +246,7 @@ TEST(getLength)
 TEST(getEdge)
 {
   ANN_START("getEdge")
-  CHECK_EQ(*test_road_getters_and_setters.getEdge(), *test_edge);
+  CHECK_EQ(test_road_getters_and_setters.getEdge(), test_edge);
   ANN_END("getEdge")
 }
 
@@ -268,14 +267,14 @@ TEST(getOwner)
 TEST(getVertexA)
 {
   ANN_START("getVertexA")
-  CHECK_EQ(*test_road_getters_and_setters.getVertexA(), *(test_stationA->vertex));
+  CHECK_EQ(test_road_getters_and_setters.getVertexA(), test_stationA->vertex);
   ANN_END("getVertexA")
 }
 
 TEST(getVertexB)
 {
   ANN_START("getVertexB")
-  CHECK_EQ(*test_road_getters_and_setters.getVertexB(), *(test_stationB->vertex));
+  CHECK_EQ(test_road_getters_and_setters.getVertexB(), test_stationB->vertex);
   ANN_END("getVertexB")
 }
 
@@ -38,7 +38,7 @@ std::vector<std::shared_ptr<Road>> borrowedRoads;
 std::string test_station_name = "TestStation";
 std::shared_ptr<playersState::Player> test_owner = std::make_shared<playersState::Player>("TestPlayer", playersState::PlayerColor::RED, 0, 45, 3, borrowedRoads, nullptr);
 std::shared_ptr<boost::adjacency_list<>> test_graph = std::make_shared<boost::adjacency_list<>>();
-std::shared_ptr<boost::adjacency_list<>::vertex_descriptor> test_vertex = std::make_shared<boost::adjacency_list<>::vertex_descriptor>(boost::add_vertex(*test_graph));
+boost::adjacency_list<>::vertex_descriptor test_vertex = boost::add_vertex(*test_graph);
 
 SUITE_START(Constructors)
 
@@ -48,7 +48,7 @@ TEST(Default)
   Station station = Station();
   CHECK(station.name.empty());
   CHECK_EQ(station.owner, nullptr);
-  CHECK_EQ(station.vertex, nullptr);
+  CHECK_EQ(station.vertex, boost::graph_traits<boost::adjacency_list<>>::null_vertex());
   ANN_END("Default")
 }
 
@@ -58,7 +58,7 @@ TEST(Basic)
   Station station(test_station_name, test_owner, test_vertex);
   CHECK_EQ(station.owner->name, test_owner->name);
   CHECK_EQ(station.name, test_station_name);
-  CHECK_EQ(*station.vertex, *test_vertex);
+  CHECK_EQ(station.vertex, test_vertex);
   ANN_END("Basic")
 }
 
@@ -148,7 +148,7 @@ using FerryInfo = std::pair<StationPair, FerryDetail>;
 TEST(getVertex)
 {
   ANN_START("getVertex")
-  CHECK_EQ(*station.getVertex(), *test_vertex);
+  CHECK_EQ(station.getVertex(), test_vertex);
   ANN_END("getVertex")
 }
 
@@ -182,8 +182,8 @@ TEST(getAdjacentStations)
   std::shared_ptr<Station> stationA = std::make_shared<Station>("StationA", nullptr, test_vertex);
   std::shared_ptr<Station> stationB = std::make_shared<Station>("StationB", nullptr, test_vertex);
   std::shared_ptr<Station> stationC = std::make_shared<Station>("StationC", nullptr, test_vertex);
-  std::shared_ptr<Road> roadAB = std::make_shared<Road>(101, nullptr, stationA, stationB, RoadColor::RED, 3, nullptr);
-  std::shared_ptr<Road> roadAC = std::make_shared<Road>(102, nullptr, stationA, stationC, RoadColor::BLUE, 4, nullptr);
+  std::shared_ptr<Road> roadAB = std::make_shared<Road>(101, nullptr, stationA, stationB, RoadColor::RED, 3);
+  std::shared_ptr<Road> roadAC = std::make_shared<Road>(102, nullptr, stationA, stationC, RoadColor::BLUE, 4);
   std::vector<std::shared_ptr<Road>> roads = {roadAB, roadAC};
   {
     ANN_START("adjacent stations to A case")
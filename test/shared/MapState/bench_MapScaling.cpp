@@ -0,0 +1,134 @@
+// MapState scaling benchmark over generated maps: load, path queries (Dijkstra, landmark A*, contracted
+// chains), claimability and ticket checks.
+// Not part of ctest; run as  bench_MapScaling [maxStations] [seed]  from the build tree.
+
+#include "../../src/shared/mapState/MapGenerator.h"
+#include "../../src/shared/mapState/MapImage.h"
+#include "../../src/shared/mapState/MapState.h"
+#include "../../src/shared/mapState/Station.h"
+#include "../../src/shared/mapState/Road.h"
+#include "../../src/shared/playersState/Player.h"
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace ::mapState;
+
+namespace
+{
+
+const int kQueries = 200;
+
+typedef std::chrono::steady_clock Clock;
+
+double microseconds(Clock::time_point start, Clock::time_point end, int rounds)
+{
+  return static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()) / rounds;
+}
+
+void runSize(int stationCount, unsigned int seed)
+{
+  std::string json = MapGenerator::generate(stationCount, seed);
+  std::string imagePath = (std::filesystem::temp_directory_path() / ("bench_map_" + std::to_string(stationCount) + ".bin")).string();
+  std::string image;
+  MapImage::compile(json, "", image);
+  {
+    std::ofstream file(imagePath.c_str(), std::ios::binary | std::ios::trunc);
+    file.write(image.data(), static_cast<std::streamsize>(image.size()));
+  }
+
+  Clock::time_point start = Clock::now();
+  mapState::MapState map = mapState::MapState::ParseFromJSON(json, nullptr);
+  Clock::time_point parsed = Clock::now();
+  mapState::MapState loaded = mapState::MapState::FromImage(imagePath, nullptr);
+  Clock::time_point imaged = Clock::now();
+  (void)loaded;
+
+  std::vector<std::shared_ptr<Station>> stations = map.getStations();
+  std::vector<std::shared_ptr<Road>> roads = map.getRoads();
+  std::vector<std::shared_ptr<mapState::Road>> noRoads;
+  std::shared_ptr<playersState::Player> player = std::make_shared<playersState::Player>("Red", playersState::PlayerColor::RED, 0, 45, 3, noRoads, nullptr);
+  std::shared_ptr<playersState::Player> rival = std::make_shared<playersState::Player>("Blue", playersState::PlayerColor::BLUE, 0, 45, 3, noRoads, nullptr);
+  for (std::size_t r = 0; r < roads.size(); r += 5)
+  {
+    roads[r]->setOwner(r % 2 ? rival : player);
+  }
+
+  std::mt19937 random(seed);
+  std::vector<std::pair<std::shared_ptr<Station>, std::shared_ptr<Station>>> pairs;
+  for (int q = 0; q < kQueries; ++q)
+  {
+    pairs.emplace_back(stations[random() % stations.size()], stations[random() % stations.size()]);
+  }
+
+  // first query builds the routing graph, keep it out of the per-query figures
+  map.getShortestPath(pairs[0].first, pairs[0].second, std::vector<bool>());
+  Clock::time_point pathStart = Clock::now();
+  int found = 0;
+  for (const auto &pair : pairs)
+  {
+    found += map.getShortestPath(pair.first, pair.second, std::vector<bool>()).TOTALLENGTH >= 0 ? 1 : 0;
+  }
+  Clock::time_point pathEnd = Clock::now();
+  for (const auto &pair : pairs)
+  {
+    map.getLandmarkPath(pair.first, pair.second, std::vector<bool>());
+  }
+  Clock::time_point altEnd = Clock::now();
+  for (const auto &pair : pairs)
+  {
+    map.getContractedPath(pair.first, pair.second, std::vector<bool>(), false);
+  }
+  Clock::time_point chainEnd = Clock::now();
+  int distanceQueries = stationCount > 2048 ? kQueries / 10 : kQueries;
+  for (int q = 0; q < distanceQueries; ++q)
+  {
+    map.getStationDistance(player, pairs[static_cast<std::size_t>(q)].first, pairs[static_cast<std::size_t>(q)].second, true);
+  }
+  Clock::time_point distanceEnd = Clock::now();
+  std::size_t claimable = map.getClaimableRoadsView(2, player).size();
+  Clock::time_point claimEnd = Clock::now();
+  int reached = 0;
+  for (const auto &pair : pairs)
+  {
+    reached += map.isDestinationReached(player, pair.first, pair.second) ? 1 : 0;
+  }
+  Clock::time_point ticketEnd = Clock::now();
+
+  std::cout << std::setw(8) << stationCount << std::setw(9) << roads.size()
+            << std::fixed << std::setprecision(1)
+            << std::setw(12) << microseconds(start, parsed, 1) / 1000.0
+            << std::setw(12) << microseconds(parsed, imaged, 1) / 1000.0
+            << std::setw(12) << microseconds(pathStart, pathEnd, kQueries)
+            << std::setw(12) << microseconds(pathEnd, altEnd, kQueries)
+            << std::setw(12) << microseconds(altEnd, chainEnd, kQueries)
+            << std::setw(12) << microseconds(chainEnd, distanceEnd, distanceQueries)
+            << std::setw(12) << microseconds(distanceEnd, claimEnd, 1)
+            << std::setw(12) << microseconds(claimEnd, ticketEnd, kQueries)
+            << "   (" << found << " paths, " << claimable << " claimable, " << reached << " reached)" << std::endl;
+  std::filesystem::remove(imagePath);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+  int maxStations = argc > 1 ? std::atoi(argv[1]) : 100000;
+  unsigned int seed = argc > 2 ? static_cast<unsigned int>(std::atoi(argv[2])) : 1u;
+  std::cout << "stations    roads   json(ms)   image(ms)    path(us)     alt(us)   chain(us)    dist(us)   claim(us)  ticket(us)" << std::endl;
+  for (int stations = 1000; stations <= maxStations; stations *= 10)
+  {
+    runSize(stations, seed);
+    if (stations * 3 <= maxStations)
+    {
+      runSize(stations * 3, seed);
+    }
+  }
+  return EXIT_SUCCESS;
+}
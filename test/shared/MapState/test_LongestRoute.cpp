@@ -0,0 +1,254 @@
+#include <boost/test/unit_test.hpp>
+
+#include "../../src/shared/mapState/LongestRoute.h"
+#include "../../src/shared/mapState/MapState.h"
+#include "../../src/shared/mapState/Station.h"
+#include "../../src/shared/mapState/Road.h"
+#include "../../src/shared/playersState/Player.h"
+#include "../../src/shared/state/State.h"
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <unordered_set>
+
+#define DEBUG_MODE true
+#if DEBUG_MODE == true
+#define DEBUG
+#define DEBUG_PRINT(x) std::cout << x << std::endl
+#else
+#define DEBUG_PRINT(x)
+#endif
+
+#define TEST(x) BOOST_AUTO_TEST_CASE(x)
+#define SUITE_START(x) BOOST_AUTO_TEST_SUITE(x)
+#define SUITE_END() BOOST_AUTO_TEST_SUITE_END()
+#define ANN_START(x) std::cout << "Starting " << x << " test..." << std::endl;
+#define ANN_END(x) std::cout << x << " test finished!" << std::endl;
+#define CHECK_EQ(a, b) BOOST_CHECK_EQUAL(a, b)
+#define CHECK_NE(a, b) BOOST_CHECK_NE(a, b)
+#define CHECK_NTHROW(...) BOOST_CHECK_NO_THROW(__VA_ARGS__)
+#define CHECK_THROW(...) BOOST_CHECK_THROW(__VA_ARGS__)
+#define REQUIRE(...) BOOST_REQUIRE(__VA_ARGS__)
+#define CHECK(x) BOOST_CHECK(x)
+
+using namespace ::mapState;
+
+namespace
+{
+
+// plain exhaustive search from every station, reference for the solver
+int bruteForce(int vertex, std::vector<char> &used, const std::vector<int> &a, const std::vector<int> &b, const std::vector<int> &lengths)
+{
+  int best = 0;
+  for (std::size_t e = 0; e < a.size(); ++e)
+  {
+    if (used[e] || (a[e] != vertex && b[e] != vertex))
+    {
+      continue;
+    }
+    used[e] = 1;
+    int next = a[e] == vertex ? b[e] : a[e];
+    best = std::max(best, lengths[e] + bruteForce(next, used, a, b, lengths));
+    used[e] = 0;
+  }
+  return best;
+}
+
+int bruteForceLongest(const std::vector<int> &a, const std::vector<int> &b, const std::vector<int> &lengths)
+{
+  int best = 0;
+  std::vector<char> used(a.size(), 0);
+  for (std::size_t e = 0; e < a.size(); ++e)
+  {
+    best = std::max(best, bruteForce(a[e], used, a, b, lengths));
+    best = std::max(best, bruteForce(b[e], used, a, b, lengths));
+  }
+  return best;
+}
+
+// longest route of a player computed from scratch over the roads they own
+int solveOwned(mapState::MapState &map, const std::shared_ptr<playersState::Player> &player)
+{
+  std::vector<int> a;
+  std::vector<int> b;
+  std::vector<int> lengths;
+  for (const std::shared_ptr<Road> &road : map.getRoads())
+  {
+    if (road->getOwner() && road->getOwner()->getName() == player->getName())
+    {
+      a.push_back(road->getStationA()->getId());
+      b.push_back(road->getStationB()->getId());
+      lengths.push_back(road->getLength());
+    }
+  }
+  return LongestRoute::solve(a, b, lengths);
+}
+
+} // namespace
+
+TEST(TestStaticAssert)
+{
+  BOOST_CHECK(1);
+}
+
+SUITE_START(Solver)
+
+TEST(EulerShortcut)
+{
+  ANN_START("EulerShortcut")
+  // open chain and closed triangle both use every road
+  CHECK_EQ(LongestRoute::solve({0, 1, 2}, {1, 2, 3}, {1, 2, 3}), 6);
+  CHECK_EQ(LongestRoute::solve({0, 1, 2}, {1, 2, 0}, {4, 4, 4}), 12);
+  CHECK_EQ(LongestRoute::solve({}, {}, {}), 0);
+  ANN_END("EulerShortcut")
+}
+
+TEST(Branches)
+{
+  ANN_START("Branches")
+  // star with three arms: only the two longest arms can be chained
+  CHECK_EQ(LongestRoute::solve({0, 0, 0}, {1, 2, 3}, {1, 2, 3}), 5);
+  // triangle with two tails: take the long way round the loop between them
+  CHECK_EQ(LongestRoute::solve({0, 1, 2, 0, 1}, {1, 2, 0, 3, 4}, {1, 1, 1, 5, 6}), 13);
+  // separate networks do not add up
+  CHECK_EQ(LongestRoute::solve({0, 0, 0, 5}, {1, 2, 3, 6}, {1, 2, 3, 8}), 8);
+  ANN_END("Branches")
+}
+
+TEST(RandomAgainstBruteForce)
+{
+  ANN_START("RandomAgainstBruteForce")
+  std::mt19937 random(42);
+  for (int round = 0; round < 200; ++round)
+  {
+    int vertices = 3 + static_cast<int>(random() % 6);
+    int edges = 1 + static_cast<int>(random() % 10);
+    std::vector<int> a;
+    std::vector<int> b;
+    std::vector<int> lengths;
+    for (int e = 0; e < edges; ++e)
+    {
+      a.push_back(static_cast<int>(random() % vertices));
+      b.push_back(static_cast<int>(random() % vertices));
+      lengths.push_back(1 + static_cast<int>(random() % 6));
+    }
+    CHECK_EQ(LongestRoute::solve(a, b, lengths), bruteForceLongest(a, b, lengths));
+  }
+  ANN_END("RandomAgainstBruteForce")
+}
+
+SUITE_END() // Solver
+
+SUITE_START(MapQueries)
+
+TEST(IncrementalClaims)
+{
+  ANN_START("IncrementalClaims")
+  mapState::MapState map_state = mapState::MapState::Europe();
+  std::vector<std::shared_ptr<Road>> mapRoads = map_state.getRoads();
+  std::vector<std::shared_ptr<mapState::Road>> noRoads;
+  std::vector<std::shared_ptr<playersState::Player>> players = {
+      std::make_shared<playersState::Player>("Red", playersState::PlayerColor::RED, 0, 45, 3, noRoads, nullptr),
+      std::make_shared<playersState::Player>("Blue", playersState::PlayerColor::BLUE, 0, 45, 3, noRoads, nullptr),
+  };
+
+  std::vector<int> initial = map_state.getLongestRoutes(players);
+  CHECK_EQ(initial[0], 0);
+  CHECK_EQ(initial[1], 0);
+
+  // hand out roads one at a time and compare with a solve from scratch after each claim
+  for (std::size_t r = 0; r < mapRoads.size() && r < 40; ++r)
+  {
+    const std::shared_ptr<playersState::Player> &player = players[r % 2];
+    mapRoads[r]->setOwner(player);
+    CHECK_EQ(map_state.getLongestRoute(player), solveOwned(map_state, player));
+  }
+  std::vector<int> routes = map_state.getLongestRoutes(players);
+  CHECK_EQ(routes[0], solveOwned(map_state, players[0]));
+  CHECK_EQ(routes[1], solveOwned(map_state, players[1]));
+
+  // releasing a road splits a network again
+  mapRoads[0]->setOwner(nullptr);
+  CHECK_EQ(map_state.getLongestRoute(players[0]), solveOwned(map_state, players[0]));
+
+  for (const std::shared_ptr<Road> &road : mapRoads)
+  {
+    road->setOwner(nullptr);
+  }
+  CHECK_EQ(map_state.getLongestRoute(players[0]), 0);
+  ANN_END("IncrementalClaims")
+}
+
+// late game benchmark: the many-cards state with every player's network grown to about 40 wagons
+TEST(ManyCardsBenchmark)
+{
+  ANN_START("ManyCardsBenchmark")
+  state::State state("static/europe_state_1_manycards.json");
+  std::vector<std::shared_ptr<playersState::Player>> players = state.players.getPlayers();
+  std::vector<std::shared_ptr<Road>> mapRoads = state.map.getRoads();
+  REQUIRE(!players.empty());
+  REQUIRE(!mapRoads.empty());
+
+  std::vector<int> spent(players.size(), 0);
+  std::vector<std::unordered_set<int>> touched(players.size());
+  bool claimed = true;
+  while (claimed)
+  {
+    claimed = false;
+    for (std::size_t p = 0; p < players.size(); ++p)
+    {
+      std::shared_ptr<Road> pick = nullptr;
+      for (const std::shared_ptr<Road> &road : mapRoads)
+      {
+        if (road->getOwner() || spent[p] + road->getLength() > 40)
+        {
+          continue;
+        }
+        if (touched[p].empty() || touched[p].count(road->getStationA()->getId()) || touched[p].count(road->getStationB()->getId()))
+        {
+          pick = road;
+          break;
+        }
+      }
+      if (!pick)
+      {
+        continue;
+      }
+      pick->setOwner(players[p]);
+      spent[p] += pick->getLength();
+      touched[p].insert(pick->getStationA()->getId());
+      touched[p].insert(pick->getStationB()->getId());
+      claimed = true;
+    }
+  }
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  std::vector<int> routes = state.map.getLongestRoutes(players);
+  std::chrono::steady_clock::time_point solved = std::chrono::steady_clock::now();
+  std::vector<int> cached = state.map.getLongestRoutes(players);
+  std::chrono::steady_clock::time_point reread = std::chrono::steady_clock::now();
+  DEBUG_PRINT("Longest routes for " << players.size() << " players solved in "
+              << std::chrono::duration_cast<std::chrono::microseconds>(solved - start).count() << " us, cached read in "
+              << std::chrono::duration_cast<std::chrono::microseconds>(reread - solved).count() << " us");
+
+  for (std::size_t p = 0; p < players.size(); ++p)
+  {
+    DEBUG_PRINT(players[p]->getName() << " longest route: " << routes[p]);
+    CHECK_EQ(routes[p], cached[p]);
+    int owned = 0;
+    for (const std::shared_ptr<Road> &road : mapRoads)
+    {
+      if (road->getOwner() && road->getOwner()->getName() == players[p]->getName())
+      {
+        owned += road->getLength();
+      }
+    }
+    CHECK(routes[p] > 0);
+    CHECK(routes[p] <= owned);
+    CHECK_EQ(routes[p], solveOwned(state.map, players[p]));
+  }
+  ANN_END("ManyCardsBenchmark")
+}
+
+SUITE_END() // MapQueries
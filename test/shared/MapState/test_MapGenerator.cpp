@@ -0,0 +1,173 @@
+#include <boost/test/unit_test.hpp>
+
+#include "../../src/shared/mapState/MapGenerator.h"
+#include "../../src/shared/mapState/MapImage.h"
+#include "../../src/shared/mapState/MapTopology.h"
+#include "../../src/shared/mapState/MapState.h"
+#include "../../src/shared/mapState/IdSpan.h"
+#include "../../src/shared/mapState/RoadKind.h"
+#include "../../src/shared/mapState/Station.h"
+#include "../../src/shared/mapState/Road.h"
+#include "../../src/shared/mapState/Path.h"
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#define DEBUG_MODE true
+#if DEBUG_MODE == true
+#define DEBUG
+#define DEBUG_PRINT(x) std::cout << x << std::endl
+#else
+#define DEBUG_PRINT(x)
+#endif
+
+#define TEST(x) BOOST_AUTO_TEST_CASE(x)
+#define SUITE_START(x) BOOST_AUTO_TEST_SUITE(x)
+#define SUITE_END() BOOST_AUTO_TEST_SUITE_END()
+#define ANN_START(x) std::cout << "Starting " << x << " test..." << std::endl;
+#define ANN_END(x) std::cout << x << " test finished!" << std::endl;
+#define CHECK_EQ(a, b) BOOST_CHECK_EQUAL(a, b)
+#define CHECK_NE(a, b) BOOST_CHECK_NE(a, b)
+#define CHECK_NTHROW(...) BOOST_CHECK_NO_THROW(__VA_ARGS__)
+#define CHECK_THROW(...) BOOST_CHECK_THROW(__VA_ARGS__)
+#define REQUIRE(...) BOOST_REQUIRE(__VA_ARGS__)
+#define CHECK(x) BOOST_CHECK(x)
+
+using namespace ::mapState;
+
+namespace
+{
+
+// stations reached from station 0 over the whole map
+std::size_t reachable(mapState::MapState &map)
+{
+  std::vector<char> seen(map.getStations().size(), 0);
+  std::vector<int> queue = {0};
+  seen[0] = 1;
+  for (std::size_t head = 0; head < queue.size(); ++head)
+  {
+    for (int next : map.getNeighborIds(queue[head]))
+    {
+      if (!seen[static_cast<std::size_t>(next)])
+      {
+        seen[static_cast<std::size_t>(next)] = 1;
+        queue.push_back(next);
+      }
+    }
+  }
+  return queue.size();
+}
+
+} // namespace
+
+TEST(TestStaticAssert)
+{
+  BOOST_CHECK(1);
+}
+
+SUITE_START(Generate)
+
+TEST(ValidConnectedMap)
+{
+  ANN_START("ValidConnectedMap")
+  mapState::MapState map = mapState::MapState::ParseFromJSON(MapGenerator::generate(1000, 7), nullptr);
+  REQUIRE(map.getStations().size() == 1000u);
+  REQUIRE(!map.getRoads().empty());
+  CHECK_EQ(reachable(map), 1000u);
+
+  const std::vector<RoadKind> &kinds = map.getRoadKinds();
+  const std::vector<int> &lengths = map.getRoadLengths();
+  const std::vector<int> &locomotives = map.getRoadLocomotives();
+  std::size_t tunnels = 0;
+  std::size_t ferries = 0;
+  for (std::size_t r = 0; r < kinds.size(); ++r)
+  {
+    CHECK(lengths[r] >= 1 && lengths[r] <= 8);
+    if (kinds[r] == RoadKind::TUNNEL)
+    {
+      ++tunnels;
+    }
+    if (kinds[r] == RoadKind::FERRY)
+    {
+      ++ferries;
+      CHECK(locomotives[r] >= 1 && locomotives[r] <= lengths[r]);
+    }
+  }
+  double roadsPerStation = static_cast<double>(kinds.size()) / 1000.0;
+  DEBUG_PRINT("Generated " << kinds.size() << " roads, " << tunnels << " tunnels, " << ferries << " ferries");
+  CHECK(roadsPerStation > 1.2 && roadsPerStation < 2.5);
+  CHECK(tunnels > kinds.size() / 20 && tunnels < kinds.size() / 5);
+  CHECK(ferries > kinds.size() / 50 && ferries < kinds.size() / 10);
+  ANN_END("ValidConnectedMap")
+}
+
+TEST(SameSeedSameMap)
+{
+  ANN_START("SameSeedSameMap")
+  CHECK_EQ(MapGenerator::generate(500, 3), MapGenerator::generate(500, 3));
+  CHECK_NE(MapGenerator::generate(500, 3), MapGenerator::generate(500, 4));
+  // tiny requests still give a playable map
+  mapState::MapState tiny = mapState::MapState::ParseFromJSON(MapGenerator::generate(1, 1), nullptr);
+  CHECK_EQ(tiny.getStations().size(), 2u);
+  CHECK_EQ(reachable(tiny), 2u);
+  ANN_END("SameSeedSameMap")
+}
+
+TEST(CompilesToImage)
+{
+  ANN_START("CompilesToImage")
+  std::string json = MapGenerator::generate(2000, 11);
+  std::string image;
+  REQUIRE(MapImage::compile(json, "", image));
+  CHECK(!image.empty());
+  ANN_END("CompilesToImage")
+}
+
+TEST(LandmarkPathsMatchDijkstra)
+{
+  ANN_START("LandmarkPathsMatchDijkstra")
+  mapState::MapState map = mapState::MapState::ParseFromJSON(MapGenerator::generate(3000, 5), nullptr);
+  std::vector<std::shared_ptr<Station>> stations = map.getStations();
+  std::vector<bool> roadMask(map.getRoads().size(), true);
+  for (std::size_t r = 0; r < roadMask.size(); r += 4)
+  {
+    roadMask[r] = false;
+  }
+  for (std::size_t q = 0; q < 300; ++q)
+  {
+    std::shared_ptr<Station> src = stations[(q * 97) % stations.size()];
+    std::shared_ptr<Station> dest = stations[(q * 389 + 11) % stations.size()];
+    const std::vector<bool> &mask = q % 2 ? roadMask : std::vector<bool>();
+    CHECK_EQ(map.getLandmarkPath(src, dest, mask).TOTALLENGTH, map.getMostEfficientPath(src, dest, mask).TOTALLENGTH);
+  }
+  ANN_END("LandmarkPathsMatchDijkstra")
+}
+
+TEST(ContractedPathsMatchDijkstra)
+{
+  ANN_START("ContractedPathsMatchDijkstra")
+  mapState::MapState map = mapState::MapState::ParseFromJSON(MapGenerator::generate(3000, 9), nullptr);
+  std::vector<std::shared_ptr<Station>> stations = map.getStations();
+  const std::vector<int> &chainOf = map.getTopology()->stationChain;
+  std::size_t passThrough = static_cast<std::size_t>(std::count_if(chainOf.begin(), chainOf.end(), [](int chain) { return chain >= 0; }));
+  DEBUG_PRINT("Pass-through stations: " << passThrough << " of " << stations.size());
+  CHECK(passThrough > stations.size() / 10);
+  std::vector<bool> roadMask(map.getRoads().size(), true);
+  for (std::size_t r = 0; r < roadMask.size(); r += 6)
+  {
+    roadMask[r] = false;
+  }
+  for (std::size_t q = 0; q < 300; ++q)
+  {
+    std::shared_ptr<Station> src = stations[(q * 131) % stations.size()];
+    std::shared_ptr<Station> dest = stations[(q * 577 + 3) % stations.size()];
+    const std::vector<bool> &mask = q % 2 ? roadMask : std::vector<bool>();
+    Path contracted = map.getContractedPath(src, dest, mask, q % 3 != 0);
+    Path expected = q % 3 != 0 ? map.getMostEfficientPath(src, dest, mask) : map.getShortestPath(src, dest, mask);
+    CHECK_EQ(contracted.TOTALLENGTH, expected.TOTALLENGTH);
+    CHECK_EQ(contracted.STATIONS.size(), contracted.ROADS.size() + (contracted.STATIONS.empty() ? 0 : 1));
+  }
+  ANN_END("ContractedPathsMatchDijkstra")
+}
+
+SUITE_END() // Generate
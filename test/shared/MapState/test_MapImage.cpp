@@ -0,0 +1,245 @@
+#include <boost/test/unit_test.hpp>
+
+#include "../../src/shared/mapState/MapImage.h"
+#include "../../src/shared/mapState/MapState.h"
+#include "../../src/shared/mapState/Station.h"
+#include "../../src/shared/mapState/Road.h"
+#include "../../src/shared/mapState/Tunnel.h"
+#include "../../src/shared/mapState/Ferry.h"
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <typeinfo>
+
+#define DEBUG_MODE true
+#if DEBUG_MODE == true
+#define DEBUG
+#define DEBUG_PRINT(x) std::cout << x << std::endl
+#else
+#define DEBUG_PRINT(x)
+#endif
+
+#define TEST(x) BOOST_AUTO_TEST_CASE(x)
+#define SUITE_START(x) BOOST_AUTO_TEST_SUITE(x)
+#define SUITE_END() BOOST_AUTO_TEST_SUITE_END()
+#define ANN_START(x) std::cout << "Starting " << x << " test..." << std::endl;
+#define ANN_END(x) std::cout << x << " test finished!" << std::endl;
+#define CHECK_EQ(a, b) BOOST_CHECK_EQUAL(a, b)
+#define CHECK_NE(a, b) BOOST_CHECK_NE(a, b)
+#define CHECK_NTHROW(...) BOOST_CHECK_NO_THROW(__VA_ARGS__)
+#define CHECK_THROW(...) BOOST_CHECK_THROW(__VA_ARGS__)
+#define REQUIRE(...) BOOST_REQUIRE(__VA_ARGS__)
+#define CHECK(x) BOOST_CHECK(x)
+
+using namespace ::mapState;
+
+namespace
+{
+
+const char kMapPath[] = "static/europe_map.json";
+
+std::string readFile(const std::string &path)
+{
+  std::ifstream file(path.c_str(), std::ios::binary);
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  return buffer.str();
+}
+
+void writeFile(const std::string &path, const std::string &content)
+{
+  std::ofstream file(path.c_str(), std::ios::binary | std::ios::trunc);
+  file.write(content.data(), static_cast<std::streamsize>(content.size()));
+}
+
+std::string imagePath(const char *name)
+{
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
+} // namespace
+
+TEST(TestStaticAssert)
+{
+  BOOST_CHECK(1);
+}
+
+SUITE_START(Compile)
+
+TEST(SameMapAsJSON)
+{
+  ANN_START("SameMapAsJSON")
+  std::string path = imagePath("europe_map_test.bin");
+  REQUIRE(MapImage::compileFile(kMapPath, "", path));
+
+  mapState::MapState parsed = mapState::MapState::ParseFromJSON(readFile(kMapPath), nullptr);
+  mapState::MapState loaded = mapState::MapState::FromImage(path, nullptr);
+  std::vector<std::shared_ptr<Station>> parsedStations = parsed.getStations();
+  std::vector<std::shared_ptr<Station>> loadedStations = loaded.getStations();
+  std::vector<std::shared_ptr<Road>> parsedRoads = parsed.getRoads();
+  std::vector<std::shared_ptr<Road>> loadedRoads = loaded.getRoads();
+  REQUIRE(parsedStations.size() == loadedStations.size());
+  REQUIRE(parsedRoads.size() == loadedRoads.size());
+  REQUIRE(!loadedRoads.empty());
+
+  for (std::size_t s = 0; s < parsedStations.size(); ++s)
+  {
+    CHECK_EQ(parsedStations[s]->getName(), loadedStations[s]->getName());
+  }
+  for (std::size_t r = 0; r < parsedRoads.size(); ++r)
+  {
+    const std::shared_ptr<Road> &expected = parsedRoads[r];
+    const std::shared_ptr<Road> &road = loadedRoads[r];
+    CHECK_EQ(expected->getId(), road->getId());
+    CHECK_EQ(expected->getLength(), road->getLength());
+    CHECK_EQ(expected->getColor(), road->getColor());
+    CHECK_EQ(expected->getStationA()->getName(), road->getStationA()->getName());
+    CHECK_EQ(expected->getStationB()->getName(), road->getStationB()->getName());
+    CHECK(typeid(*expected) == typeid(*road));
+    if (typeid(*road) == typeid(Ferry))
+    {
+      CHECK_EQ(std::dynamic_pointer_cast<Ferry>(expected)->getLocomotives(), std::dynamic_pointer_cast<Ferry>(road)->getLocomotives());
+    }
+  }
+
+  std::shared_ptr<Station> lisboa = loaded.getStationByName("lisboa");
+  std::shared_ptr<Station> moskva = loaded.getStationByName("moskva");
+  REQUIRE(lisboa != nullptr);
+  REQUIRE(moskva != nullptr);
+  CHECK_EQ(loaded.getStationDistance(nullptr, lisboa, moskva, true),
+           parsed.getStationDistance(nullptr, parsed.getStationByName("lisboa"), parsed.getStationByName("moskva"), true));
+  ANN_END("SameMapAsJSON")
+}
+
+TEST(Layout)
+{
+  ANN_START("Layout")
+  std::string path = imagePath("europe_layout_test.bin");
+  REQUIRE(MapImage::compileFile(kMapPath, kMapPath, path));
+  MapImage image;
+  REQUIRE(image.open(path));
+  CHECK(image.isOpen());
+  REQUIRE(image.getStationCount() > 0);
+  CHECK_EQ(image.getStationName(0), "amsterdam");
+  CHECK_EQ(image.getStationRow(0), 3);
+  CHECK_EQ(image.getStationColumn(0), 24);
+  CHECK_EQ(image.getStationNickname(0), "AMS");
+  CHECK_EQ(image.getRoadOwner(0), "Player2");
+
+  // copies share the mapping
+  MapImage copy = image;
+  image.close();
+  CHECK(!image.isOpen());
+  CHECK_EQ(copy.getStationName(0), "amsterdam");
+  ANN_END("Layout")
+}
+
+TEST(RejectsBadImages)
+{
+  ANN_START("RejectsBadImages")
+  std::string path = imagePath("europe_bad_test.bin");
+  std::string image;
+  REQUIRE(MapImage::compile(readFile(kMapPath), "", image));
+  MapImage opened;
+
+  std::string corrupted = image;
+  corrupted[corrupted.size() / 2] ^= 0x5a;
+  writeFile(path, corrupted);
+  CHECK(!opened.open(path));
+  CHECK(mapState::MapState::FromImage(path, nullptr).getStations().empty());
+
+  writeFile(path, image.substr(0, image.size() - 3));
+  CHECK(!opened.open(path));
+
+  writeFile(path, image);
+  CHECK(opened.open(path));
+  MapImage::formatVersion += 1;
+  CHECK(!opened.open(path));
+  MapImage::formatVersion -= 1;
+
+  CHECK(!opened.open(imagePath("no_such_map_image.bin")));
+  CHECK(!MapImage::compile("{\"stations\": [\"a\", \"b\"], \"roads\": []}", "", image));
+  CHECK(!MapImage::compile("not json", "", image));
+  ANN_END("RejectsBadImages")
+}
+
+TEST(RejectsRecordsOutsideTheImage)
+{
+  ANN_START("RejectsRecordsOutsideTheImage")
+  std::string path = imagePath("europe_records_test.bin");
+  std::string image;
+  REQUIRE(MapImage::compile(readFile(kMapPath), "", image));
+  std::uint32_t stationCount = 0;
+  std::memcpy(&stationCount, image.data() + 16, sizeof(stationCount));
+  // 40 byte header, 32 byte stations, 36 byte roads
+  const std::size_t firstRoad = 40 + stationCount * 32;
+  const std::size_t firstStation = 40;
+
+  // patches one field and signs the image again, so only the record checks can catch it
+  auto patched = [&](std::size_t offset, std::uint32_t value) {
+    std::string copy = image;
+    std::memcpy(&copy[offset], &value, sizeof(value));
+    std::uint64_t sum = MapImage::checksum(copy.data() + 40, copy.size() - 40);
+    std::memcpy(&copy[32], &sum, sizeof(sum));
+    return copy;
+  };
+  MapImage opened;
+  writeFile(path, patched(firstRoad + 4, 0));
+  CHECK(opened.open(path));
+
+  writeFile(path, patched(firstRoad + 8, stationCount));
+  CHECK(!opened.open(path));
+  CHECK(mapState::MapState::FromImage(path, nullptr).getStations().empty());
+  writeFile(path, patched(firstRoad + 20, 3));
+  CHECK(!opened.open(path));
+  writeFile(path, patched(firstRoad + 32, 0xffffffffu));
+  CHECK(!opened.open(path));
+  writeFile(path, patched(firstStation, 0xfffffff0u));
+  CHECK(!opened.open(path));
+  writeFile(path, patched(firstStation + 4, 0x7fffffffu));
+  CHECK(!opened.open(path));
+  ANN_END("RejectsRecordsOutsideTheImage")
+}
+
+TEST(NamedMapStateLoadsImages)
+{
+  ANN_START("NamedMapStateLoadsImages")
+  std::string path = imagePath("europe_named_test.bin");
+  REQUIRE(MapImage::compileFile(kMapPath, "", path));
+  mapState::MapState loaded = mapState::MapState::NamedMapState(path);
+  CHECK_EQ(loaded.getStations().size(), mapState::MapState::FromImage(path, nullptr).getStations().size());
+  CHECK(loaded.getStationByName("lisboa") != nullptr);
+  CHECK(mapState::MapState::NamedMapState(kMapPath).getStations().empty());
+  ANN_END("NamedMapStateLoadsImages")
+}
+
+TEST(LoadBenchmark)
+{
+  ANN_START("LoadBenchmark")
+  std::string path = imagePath("europe_bench_test.bin");
+  REQUIRE(MapImage::compileFile(kMapPath, "", path));
+  std::string json = readFile(kMapPath);
+  const int rounds = 50;
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; ++i)
+  {
+    mapState::MapState parsed = mapState::MapState::ParseFromJSON(json, nullptr);
+    CHECK(!parsed.getStations().empty());
+  }
+  std::chrono::steady_clock::time_point parsedEnd = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; ++i)
+  {
+    mapState::MapState loaded = mapState::MapState::FromImage(path, nullptr);
+    CHECK(!loaded.getStations().empty());
+  }
+  std::chrono::steady_clock::time_point loadedEnd = std::chrono::steady_clock::now();
+  DEBUG_PRINT("Europe map: JSON " << std::chrono::duration_cast<std::chrono::microseconds>(parsedEnd - start).count() / rounds
+              << " us, image " << std::chrono::duration_cast<std::chrono::microseconds>(loadedEnd - parsedEnd).count() / rounds << " us per load");
+  ANN_END("LoadBenchmark")
+}
+
+SUITE_END() // Compile
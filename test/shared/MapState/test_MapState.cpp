@@ -7,11 +7,21 @@
 #include "../../src/shared/playersState/PlayersState.h"
 #include "../../src/shared/mapState/Tunnel.h"
 #include "../../src/shared/mapState/Ferry.h"
+#include "../../src/shared/mapState/IdSpan.h"
+#include "../../src/shared/mapState/MapTopology.h"
+#include "../../src/shared/mapState/MapFork.h"
+#include "../../src/shared/mapState/NetworkDistances.h"
 #include "../../src/shared/cardsState/DestinationCard.h"
+#include "../../src/shared/cardsState/PlayerCards.h"
+#include "../../src/shared/cardsState/WagonCard.h"
 #include <boost/graph/adjacency_list.hpp>
+#include <algorithm>
 #include <memory>
 #include <json/json.h>
 #include <cstdlib>
+#include <sstream>
+#include <set>
+#include <thread>
 
 #define DEBUG_MODE true
 #if DEBUG_MODE == true
@@ -74,8 +84,8 @@ TEST(Wrapper)
       Station::genData(nullptr, "Station1"),
       Station::genData(nullptr, "Station2"),
   };
-  auto station1 = std::make_shared<Station>("Station1", nullptr, std::make_shared<boost::adjacency_list<>::vertex_descriptor>(boost::add_vertex(test_graph)));
-  auto station2 = std::make_shared<Station>("Station2", nullptr, std::make_shared<boost::adjacency_list<>::vertex_descriptor>(boost::add_vertex(test_graph)));
+  auto station1 = std::make_shared<Station>("Station1", nullptr, boost::add_vertex(test_graph));
+  auto station2 = std::make_shared<Station>("Station2", nullptr, boost::add_vertex(test_graph));
   std::vector<RoadInfo> roadsInfos = {
       Road::genData(station1, station2, 1, nullptr, RoadColor::RED, 3),
   };
@@ -114,9 +124,9 @@ TEST(Parameterized)
       Station::genData(nullptr, "StationB"),
       Station::genData(nullptr, "StationC"),
   };
-  auto stationA = std::make_shared<Station>("StationA", nullptr, std::make_shared<boost::adjacency_list<>::vertex_descriptor>(boost::add_vertex(test_graph)));
-  auto stationB = std::make_shared<Station>("StationB", nullptr, std::make_shared<boost::adjacency_list<>::vertex_descriptor>(boost::add_vertex(test_graph)));
-  auto stationC = std::make_shared<Station>("StationC", nullptr, std::make_shared<boost::adjacency_list<>::vertex_descriptor>(boost::add_vertex(test_graph)));
+  auto stationA = std::make_shared<Station>("StationA", nullptr, boost::add_vertex(test_graph));
+  auto stationB = std::make_shared<Station>("StationB", nullptr, boost::add_vertex(test_graph));
+  auto stationC = std::make_shared<Station>("StationC", nullptr, boost::add_vertex(test_graph));
   std::vector<RoadInfo> roadsInfos = {
       Road::genData(stationA, stationB, 1, nullptr, RoadColor::RED, 3),
       Road::genData(stationB, stationC, 2, nullptr, RoadColor::BLUE, 4),
@@ -153,9 +163,13 @@ TEST(NamedMapState)
     CHECK_EQ(mapState.roads.size(), 0);
   }
   {
+    std::stringstream buffer;
+    std::streambuf *old = std::cerr.rdbuf(buffer.rdbuf());
     MapState mapState = MapState::NamedMapState("nonexistent_map");
+    std::cerr.rdbuf(old);
     CHECK_EQ(mapState.stations.size(), 0);
     CHECK_EQ(mapState.roads.size(), 0);
+    CHECK(buffer.str().find("unknown map 'nonexistent_map'") != std::string::npos);
   }
   ANN_END("NamedMapState Constructor")
 }
@@ -417,6 +431,26 @@ TEST(getStationByName)
   ANN_END("getStationByName")
 }
 
+TEST(getStationId)
+{
+  ANN_START("getStationId")
+  mapState::MapState map_state = mapState::MapState::Europe();
+  std::vector<std::shared_ptr<Station>> mapStations = map_state.getStations();
+  for (std::size_t i = 0; i < mapStations.size(); ++i)
+  {
+    CHECK_EQ(mapStations[i]->getId(), static_cast<int>(i));
+    CHECK_EQ(map_state.getStationId(mapStations[i]->getName()), static_cast<int>(i));
+    CHECK_EQ(map_state.getStationById(static_cast<int>(i)), mapStations[i]);
+  }
+  std::shared_ptr<Station> paris = map_state.getStationByName("paris");
+  REQUIRE(paris != nullptr);
+  CHECK_EQ(map_state.getStationByName(" Paris "), paris);
+  CHECK_EQ(map_state.getStationId("nonexistent"), -1);
+  CHECK(map_state.getStationById(-1) == nullptr);
+  CHECK(map_state.getStationById(static_cast<int>(mapStations.size())) == nullptr);
+  ANN_END("getStationId")
+}
+
 SUITE_END() // Getters
 
 SUITE_START(Setters)
@@ -470,11 +504,57 @@ TEST(getAdjacentStations)
     ANN_START("undefined case")
     std::shared_ptr<mapState::Station> station = test_map_state.getStationByName("lol");
     std::vector<std::shared_ptr<mapState::Station>> adjacentStations = test_map_state.getAdjacentStations(station);
-    // CHECK_EQ(adjacentStations.size(), 0); // lol does not exist = no adjacent stations
+    CHECK_EQ(adjacentStations.size(), 0); // lol does not exist = no adjacent stations
     ANN_END("undefined case")
   }
   ANN_END("getAdjacentStations")
 }
+
+TEST(getIncidentRoads)
+{
+  ANN_START("getIncidentRoads")
+  mapState::MapState map_state = mapState::MapState::Europe();
+  std::vector<std::shared_ptr<Station>> mapStations = map_state.getStations();
+  std::vector<std::shared_ptr<Road>> mapRoads = map_state.getRoads();
+  std::size_t totalDegree = 0;
+  for (std::size_t s = 0; s < mapStations.size(); ++s)
+  {
+    int id = static_cast<int>(s);
+    IdSpan roads = map_state.getIncidentRoads(id);
+    IdSpan neighbors = map_state.getNeighborIds(id);
+    REQUIRE(roads.size() == neighbors.size());
+    totalDegree += roads.size();
+
+    // same roads, in the same order, as a scan over the whole map
+    std::vector<int> expected;
+    for (std::size_t r = 0; r < mapRoads.size(); ++r)
+    {
+      if (mapRoads[r]->getStationA()->getId() == id || mapRoads[r]->getStationB()->getId() == id)
+      {
+        expected.push_back(static_cast<int>(r));
+      }
+    }
+    CHECK(std::vector<int>(roads.begin(), roads.end()) == expected);
+    for (std::size_t i = 0; i < roads.size(); ++i)
+    {
+      const std::shared_ptr<Road> &road = mapRoads[static_cast<std::size_t>(roads[i])];
+      int other = road->getStationA()->getId() == id ? road->getStationB()->getId() : road->getStationA()->getId();
+      CHECK_EQ(neighbors[i], other);
+    }
+
+    std::vector<std::shared_ptr<Station>> adjacent = map_state.getAdjacentStations(mapStations[s]);
+    std::vector<std::shared_ptr<Station>> scanned = mapStations[s]->getAdjacentStations(mapRoads);
+    REQUIRE(adjacent.size() == scanned.size());
+    for (std::size_t i = 0; i < adjacent.size(); ++i)
+    {
+      CHECK_EQ(adjacent[i]->getName(), scanned[i]->getName());
+    }
+  }
+  CHECK_EQ(totalDegree, 2 * mapRoads.size());
+  CHECK(map_state.getIncidentRoads(-1).empty());
+  CHECK(map_state.getNeighborIds(static_cast<int>(mapStations.size())).empty());
+  ANN_END("getIncidentRoads")
+}
 // check shortest path function in a small synthetic map
 TEST(getShortestPath)
 {
@@ -551,6 +631,523 @@ TEST(getMostEfficientPath)
   CHECK_EQ(bestPath.TOTALLENGTH, 10);
   ANN_END("getMostEfficientPath")
 }
+// check path queries restricted by a road mask on the cached routing graph
+TEST(getMostEfficientPathWithMask)
+{
+  ANN_START("getMostEfficientPathWithMask")
+  std::shared_ptr<boost::adjacency_list<>> gameGraph =
+      std::make_shared<boost::adjacency_list<>>();
+  mapState::MapState test_map_state;
+
+  std::vector<StationInfo> stationsInfos = {
+      Station::initData("A"),
+      Station::initData("B"),
+      Station::initData("C"),
+  };
+
+  std::vector<std::shared_ptr<Station>> stations =
+      Station::BatchConstructor(stationsInfos, gameGraph);
+
+  std::vector<RoadInfo> roadsInfos = {
+      Road::initDataByName(stations, "A", "B", 1, RoadColor::NONE, 5),
+      Road::initDataByName(stations, "B", "C", 2, RoadColor::NONE, 5),
+      Road::initDataByName(stations, "A", "C", 3, RoadColor::NONE, 20),
+  };
+
+  test_map_state.fillMapWithInfos(stationsInfos, roadsInfos, {}, {}, gameGraph);
+
+  std::shared_ptr<mapState::Station> src = test_map_state.getStationByName("A");
+  std::shared_ptr<mapState::Station> dest = test_map_state.getStationByName("C");
+  std::vector<std::shared_ptr<Road>> mapRoads = test_map_state.getRoads();
+
+  Path fullPath = test_map_state.getMostEfficientPath(src, dest, test_map_state.getRoadMask(mapRoads));
+  CHECK_EQ(fullPath.STATIONS.front(), src);
+  CHECK_EQ(fullPath.STATIONS.back(), dest);
+  CHECK_EQ(fullPath.TOTALLENGTH, 10);
+  CHECK_EQ(fullPath.ROADS.size(), 2);
+
+  std::vector<bool> mask = test_map_state.getRoadMask({mapRoads[0], mapRoads[2]});
+  Path detour = test_map_state.getMostEfficientPath(src, dest, mask);
+  CHECK_EQ(detour.NUMEDGES, 1);
+  CHECK_EQ(detour.TOTALLENGTH, 20);
+  REQUIRE(detour.ROADS.size() == 1);
+  CHECK_EQ(detour.ROADS.front()->getId(), 3);
+
+  Path blocked = test_map_state.getShortestPath(src, dest, test_map_state.getRoadMask({mapRoads[0]}));
+  CHECK(blocked.STATIONS.empty());
+
+  // a mask shorter than the road list is rejected instead of read past its end
+  std::vector<bool> shortMask(mapRoads.size() - 1, true);
+  CHECK(test_map_state.getShortestPath(src, dest, shortMask).STATIONS.empty());
+  CHECK(test_map_state.getMostEfficientPath(src, dest, shortMask).STATIONS.empty());
+  CHECK(test_map_state.getLandmarkPath(src, dest, shortMask).STATIONS.empty());
+  CHECK(test_map_state.getContractedPath(src, dest, shortMask, true).STATIONS.empty());
+  CHECK(test_map_state.getKShortestPaths(src, dest, 2, shortMask, true).empty());
+  std::vector<Path> batch = test_map_state.getPaths({{src, dest}}, shortMask, true);
+  REQUIRE(batch.size() == 1);
+  CHECK(batch[0].STATIONS.empty());
+  CHECK_EQ(test_map_state.getMostEfficientPath(src, dest, std::vector<bool>()).TOTALLENGTH, 10);
+  ANN_END("getMostEfficientPathWithMask")
+}
+
+// check cached distances follow road claims
+TEST(getStationDistance)
+{
+  ANN_START("getStationDistance")
+  std::shared_ptr<boost::adjacency_list<>> gameGraph =
+      std::make_shared<boost::adjacency_list<>>();
+  mapState::MapState test_map_state;
+
+  std::vector<StationInfo> stationsInfos = {
+      Station::initData("A"),
+      Station::initData("B"),
+      Station::initData("C"),
+  };
+
+  std::vector<std::shared_ptr<Station>> stations =
+      Station::BatchConstructor(stationsInfos, gameGraph);
+
+  std::vector<RoadInfo> roadsInfos = {
+      Road::initDataByName(stations, "A", "B", 1, RoadColor::NONE, 5),
+      Road::initDataByName(stations, "B", "C", 2, RoadColor::NONE, 5),
+      Road::initDataByName(stations, "A", "C", 3, RoadColor::NONE, 20),
+  };
+
+  test_map_state.fillMapWithInfos(stationsInfos, roadsInfos, {}, {}, gameGraph);
+
+  std::shared_ptr<mapState::Station> a = test_map_state.getStationByName("A");
+  std::shared_ptr<mapState::Station> c = test_map_state.getStationByName("C");
+  std::vector<std::shared_ptr<Road>> mapRoads = test_map_state.getRoads();
+  std::shared_ptr<playersState::Player> tester =
+      std::make_shared<playersState::Player>("Tester", playersState::PlayerColor::RED, 0, 0, 0, borrowedRoads, nullptr);
+  std::shared_ptr<playersState::Player> rival =
+      std::make_shared<playersState::Player>("Rival", playersState::PlayerColor::BLUE, 0, 0, 0, borrowedRoads, nullptr);
+
+  CHECK_EQ(test_map_state.getStationDistance(nullptr, a, c, true), 10);
+  CHECK_EQ(test_map_state.getStationDistance(tester, a, c, true), 10);
+  CHECK_EQ(test_map_state.getStationDistance(tester, a, c, false), 1);
+
+  mapRoads[1]->setOwner(rival);
+  CHECK_EQ(test_map_state.getStationDistance(tester, a, c, true), 20);
+  CHECK_EQ(test_map_state.getStationDistance(tester, a, c, false), 1);
+  CHECK_EQ(test_map_state.getStationDistance(rival, a, c, true), 5);
+
+  mapRoads[2]->setOwner(tester);
+  CHECK_EQ(test_map_state.getStationDistance(tester, a, c, true), 0);
+  CHECK_EQ(test_map_state.getStationDistance(rival, a, c, true), 5);
+
+  mapRoads[0]->setOwner(tester);
+  CHECK_EQ(test_map_state.getStationDistance(rival, a, c, true), -1);
+
+  mapRoads[0]->setOwner(nullptr);
+  mapRoads[2]->setOwner(nullptr);
+  CHECK_EQ(test_map_state.getStationDistance(rival, a, c, true), 5);
+  CHECK_EQ(test_map_state.getStationDistance(tester, a, c, true), 20);
+  CHECK_EQ(test_map_state.getStationDistance(nullptr, a, c, true), 10);
+
+  // an owner written straight into the road is picked up as well
+  mapRoads[1]->owner = rival;
+  CHECK_EQ(test_map_state.getStationDistance(tester, a, c, true), 20);
+  mapRoads[1]->owner = nullptr;
+  CHECK_EQ(test_map_state.getStationDistance(tester, a, c, true), 10);
+  ANN_END("getStationDistance")
+}
+
+// games on different threads claim roads at the same time; each one's caches only follow its own claims
+TEST(getStationDistanceSeparateGames)
+{
+  ANN_START("getStationDistanceSeparateGames")
+  const int games = 4;
+  std::vector<int> mismatches(games, 0);
+  std::vector<std::thread> threads;
+  for (int g = 0; g < games; ++g)
+  {
+    threads.emplace_back([&, g]() {
+      mapState::MapState game = mapState::MapState::Test();
+      std::shared_ptr<Station> a = game.getStationByName("A");
+      std::shared_ptr<Station> d = game.getStationByName("D");
+      std::vector<std::shared_ptr<Road>> gameRoads = game.getRoads();
+      std::shared_ptr<playersState::Player> tester =
+          std::make_shared<playersState::Player>("Tester", playersState::PlayerColor::RED, 0, 0, 0, borrowedRoads, nullptr);
+      const int free = game.getStationDistance(tester, a, d, true);
+      for (int round = 0; round < 200; ++round)
+      {
+        // A-B (blue) then B-D (black): A to D costs nothing once both are claimed
+        gameRoads[1]->setOwner(tester);
+        gameRoads[4]->setOwner(tester);
+        mismatches[static_cast<std::size_t>(g)] += game.getStationDistance(tester, a, d, true) != 0;
+        gameRoads[1]->setOwner(nullptr);
+        gameRoads[4]->setOwner(nullptr);
+        mismatches[static_cast<std::size_t>(g)] += game.getStationDistance(tester, a, d, true) != free;
+      }
+    });
+  }
+  for (std::thread &thread : threads)
+  {
+    thread.join();
+  }
+  for (int g = 0; g < games; ++g)
+  {
+    CHECK_EQ(mismatches[static_cast<std::size_t>(g)], 0);
+  }
+  ANN_END("getStationDistanceSeparateGames")
+}
+
+// check the ticket network joins several tickets at once and follows claims
+TEST(getTicketNetwork)
+{
+  ANN_START("getTicketNetwork")
+  std::shared_ptr<boost::adjacency_list<>> gameGraph =
+      std::make_shared<boost::adjacency_list<>>();
+  mapState::MapState test_map_state;
+
+  std::vector<StationInfo> stationsInfos = {
+      Station::initData("A"),
+      Station::initData("B"),
+      Station::initData("C"),
+      Station::initData("D"),
+  };
+
+  std::vector<std::shared_ptr<Station>> stations =
+      Station::BatchConstructor(stationsInfos, gameGraph);
+
+  std::vector<RoadInfo> roadsInfos = {
+      Road::initDataByName(stations, "A", "B", 1, RoadColor::NONE, 2),
+      Road::initDataByName(stations, "B", "C", 2, RoadColor::NONE, 2),
+      Road::initDataByName(stations, "B", "D", 3, RoadColor::NONE, 2),
+      Road::initDataByName(stations, "A", "C", 4, RoadColor::NONE, 5),
+      Road::initDataByName(stations, "C", "D", 5, RoadColor::NONE, 5),
+  };
+
+  test_map_state.fillMapWithInfos(stationsInfos, roadsInfos, {}, {}, gameGraph);
+
+  std::shared_ptr<mapState::Station> a = test_map_state.getStationByName("A");
+  std::shared_ptr<mapState::Station> c = test_map_state.getStationByName("C");
+  std::shared_ptr<mapState::Station> d = test_map_state.getStationByName("D");
+  std::vector<std::shared_ptr<Road>> mapRoads = test_map_state.getRoads();
+  std::shared_ptr<playersState::Player> tester =
+      std::make_shared<playersState::Player>("Tester", playersState::PlayerColor::RED, 0, 0, 0, borrowedRoads, nullptr);
+  std::shared_ptr<playersState::Player> rival =
+      std::make_shared<playersState::Player>("Rival", playersState::PlayerColor::BLUE, 0, 0, 0, borrowedRoads, nullptr);
+  std::vector<std::shared_ptr<cardsState::DestinationCard>> tickets = {
+      std::make_shared<cardsState::DestinationCard>(a, c, 4, false),
+      std::make_shared<cardsState::DestinationCard>(a, d, 4, false),
+  };
+
+  // both tickets share the A-B road instead of paying for it twice
+  Path network = test_map_state.getTicketNetwork(tester, tickets);
+  CHECK_EQ(network.TOTALLENGTH, 6);
+  CHECK_EQ(network.NUMEDGES, 3);
+  CHECK_EQ(network.STATIONS.size(), 4);
+  CHECK_EQ(test_map_state.getTicketNetwork(tester, {}).TOTALLENGTH, 0);
+
+  mapRoads[1]->setOwner(tester);
+  network = test_map_state.getTicketNetwork(tester, tickets);
+  CHECK_EQ(network.TOTALLENGTH, 4);
+  CHECK_EQ(network.NUMEDGES, 2);
+
+  // cut off from B, the own B-C road is reached through A-C
+  mapRoads[0]->setOwner(rival);
+  network = test_map_state.getTicketNetwork(tester, tickets);
+  CHECK_EQ(network.TOTALLENGTH, 7);
+  REQUIRE(network.ROADS.size() == 2);
+  CHECK(network.ROADS[0]->getId() == 4 || network.ROADS[1]->getId() == 4);
+
+  mapRoads[2]->setOwner(rival);
+  CHECK_EQ(test_map_state.getTicketNetwork(tester, tickets).TOTALLENGTH, 10);
+
+  mapRoads[3]->setOwner(rival);
+  network = test_map_state.getTicketNetwork(tester, tickets);
+  CHECK_EQ(network.TOTALLENGTH, -1);
+  CHECK(network.ROADS.empty());
+
+  for (const std::shared_ptr<Road> &road : mapRoads)
+  {
+    road->setOwner(nullptr);
+  }
+  ANN_END("getTicketNetwork")
+}
+
+// the network never costs more than a spanning tree over the endpoints, nor less than the dearest ticket
+TEST(getTicketNetworkEurope)
+{
+  ANN_START("getTicketNetworkEurope")
+  mapState::MapState map_state = mapState::MapState::Europe();
+  std::vector<std::shared_ptr<Station>> mapStations = map_state.getStations();
+  std::shared_ptr<playersState::Player> tester =
+      std::make_shared<playersState::Player>("Tester", playersState::PlayerColor::RED, 0, 0, 0, borrowedRoads, nullptr);
+
+  std::srand(7);
+  for (int round = 0; round < 50; ++round)
+  {
+    std::vector<std::shared_ptr<cardsState::DestinationCard>> tickets;
+    std::vector<std::shared_ptr<Station>> ends;
+    int dearest = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+      std::shared_ptr<Station> from = mapStations[static_cast<std::size_t>(std::rand()) % mapStations.size()];
+      std::shared_ptr<Station> to = mapStations[static_cast<std::size_t>(std::rand()) % mapStations.size()];
+      tickets.push_back(std::make_shared<cardsState::DestinationCard>(from, to, 5, false));
+      ends.push_back(from);
+      ends.push_back(to);
+      dearest = std::max(dearest, map_state.getStationDistance(tester, from, to, true));
+    }
+
+    // Prim over the endpoint distances
+    int spanning = 0;
+    std::vector<bool> joined(ends.size(), false);
+    joined[0] = true;
+    for (std::size_t step = 1; step < ends.size(); ++step)
+    {
+      int best = -1;
+      std::size_t pick = 0;
+      for (std::size_t i = 0; i < ends.size(); ++i)
+      {
+        for (std::size_t j = 0; j < ends.size(); ++j)
+        {
+          if (!joined[i] || joined[j])
+          {
+            continue;
+          }
+          int distance = map_state.getStationDistance(tester, ends[i], ends[j], true);
+          if (best < 0 || distance < best)
+          {
+            best = distance;
+            pick = j;
+          }
+        }
+      }
+      if (best >= 0)
+      {
+        spanning += best;
+        joined[pick] = true;
+      }
+    }
+
+    Path network = map_state.getTicketNetwork(tester, tickets);
+    CHECK(network.TOTALLENGTH <= spanning);
+    CHECK(network.TOTALLENGTH >= dearest);
+    int wagons = 0;
+    for (const std::shared_ptr<Road> &road : network.ROADS)
+    {
+      wagons += road->getLength();
+    }
+    CHECK_EQ(wagons, network.TOTALLENGTH);
+  }
+  ANN_END("getTicketNetworkEurope")
+}
+
+// check alternative routes come out ranked and without loops
+TEST(getKShortestPaths)
+{
+  ANN_START("getKShortestPaths")
+  std::shared_ptr<boost::adjacency_list<>> gameGraph =
+      std::make_shared<boost::adjacency_list<>>();
+  mapState::MapState test_map_state;
+
+  std::vector<StationInfo> stationsInfos = {
+      Station::initData("A"),
+      Station::initData("B"),
+      Station::initData("C"),
+      Station::initData("D"),
+  };
+
+  std::vector<std::shared_ptr<Station>> stations =
+      Station::BatchConstructor(stationsInfos, gameGraph);
+
+  std::vector<RoadInfo> roadsInfos = {
+      Road::initDataByName(stations, "A", "B", 1, RoadColor::NONE, 2),
+      Road::initDataByName(stations, "B", "C", 2, RoadColor::NONE, 2),
+      Road::initDataByName(stations, "B", "D", 3, RoadColor::NONE, 2),
+      Road::initDataByName(stations, "A", "C", 4, RoadColor::NONE, 5),
+      Road::initDataByName(stations, "C", "D", 5, RoadColor::NONE, 5),
+  };
+
+  test_map_state.fillMapWithInfos(stationsInfos, roadsInfos, {}, {}, gameGraph);
+
+  std::shared_ptr<mapState::Station> a = test_map_state.getStationByName("A");
+  std::shared_ptr<mapState::Station> d = test_map_state.getStationByName("D");
+  std::vector<std::shared_ptr<Road>> mapRoads = test_map_state.getRoads();
+
+  std::vector<Path> paths = test_map_state.getKShortestPaths(a, d, 3, {}, true);
+  REQUIRE(paths.size() == 3);
+  CHECK_EQ(paths[0].TOTALLENGTH, 4);
+  CHECK_EQ(paths[1].TOTALLENGTH, 9);
+  CHECK_EQ(paths[2].TOTALLENGTH, 9);
+  CHECK_EQ(paths[0].STATIONS.front(), a);
+  CHECK_EQ(paths[0].STATIONS.back(), d);
+  CHECK_EQ(paths[1].NUMEDGES, 3);
+
+  // only four loopless routes exist
+  paths = test_map_state.getKShortestPaths(a, d, 10, {}, true);
+  REQUIRE(paths.size() == 4);
+  CHECK_EQ(paths[3].TOTALLENGTH, 10);
+  CHECK_EQ(paths[3].NUMEDGES, 2);
+
+  paths = test_map_state.getKShortestPaths(a, d, 2, {}, false);
+  REQUIRE(paths.size() == 2);
+  CHECK_EQ(paths[0].TOTALLENGTH, 2);
+  CHECK_EQ(paths[1].TOTALLENGTH, 2);
+
+  // without the B-D road the best route goes round through C
+  paths = test_map_state.getKShortestPaths(a, d, 5, test_map_state.getRoadMask({mapRoads[0], mapRoads[1], mapRoads[3], mapRoads[4]}), true);
+  REQUIRE(paths.size() == 2);
+  CHECK_EQ(paths[0].TOTALLENGTH, 9);
+  CHECK_EQ(paths[1].TOTALLENGTH, 10);
+
+  CHECK(test_map_state.getKShortestPaths(a, d, 0, {}, true).empty());
+  CHECK(test_map_state.getKShortestPaths(a, d, 3, test_map_state.getRoadMask({mapRoads[0]}), true).empty());
+  ANN_END("getKShortestPaths")
+}
+
+// check k shortest paths on the europe map against the single path search
+TEST(getKShortestPathsEurope)
+{
+  ANN_START("getKShortestPathsEurope")
+  mapState::MapState map_state = mapState::MapState::Europe();
+  std::vector<std::shared_ptr<Road>> mapRoads = map_state.getRoads();
+  std::shared_ptr<Station> src = map_state.getStationByName("lisboa");
+  std::shared_ptr<Station> dest = map_state.getStationByName("moskva");
+  REQUIRE(src != nullptr);
+  REQUIRE(dest != nullptr);
+
+  Path best = map_state.getMostEfficientPath(src, dest, map_state.getRoadMask(mapRoads));
+  std::vector<Path> paths = map_state.getKShortestPaths(src, dest, 12, {}, true);
+  REQUIRE(paths.size() == 12);
+  CHECK_EQ(paths[0].TOTALLENGTH, best.TOTALLENGTH);
+
+  std::set<std::vector<Road *>> seen;
+  for (std::size_t i = 0; i < paths.size(); ++i)
+  {
+    const Path &path = paths[i];
+    if (i > 0)
+    {
+      CHECK(paths[i - 1].TOTALLENGTH <= path.TOTALLENGTH);
+    }
+    CHECK_EQ(path.STATIONS.front(), src);
+    CHECK_EQ(path.STATIONS.back(), dest);
+    CHECK_EQ(path.STATIONS.size(), path.ROADS.size() + 1);
+
+    int length = 0;
+    std::vector<Road *> key;
+    std::set<Station *> visited;
+    for (std::size_t r = 0; r < path.ROADS.size(); ++r)
+    {
+      length += path.ROADS[r]->getLength();
+      key.push_back(path.ROADS[r].get());
+      CHECK(visited.insert(path.STATIONS[r].get()).second);
+    }
+    CHECK_EQ(length, path.TOTALLENGTH);
+    CHECK(seen.insert(key).second);
+  }
+  ANN_END("getKShortestPathsEurope")
+}
+
+// check the hand-aware route prefers what the player's cards can pay for
+TEST(getAffordablePath)
+{
+  ANN_START("getAffordablePath")
+  std::shared_ptr<boost::adjacency_list<>> gameGraph =
+      std::make_shared<boost::adjacency_list<>>();
+  mapState::MapState test_map_state;
+
+  std::vector<StationInfo> stationsInfos = {
+      Station::initData("A"),
+      Station::initData("B"),
+      Station::initData("C"),
+      Station::initData("D"),
+  };
+
+  std::vector<std::shared_ptr<Station>> stations =
+      Station::BatchConstructor(stationsInfos, gameGraph);
+
+  std::vector<RoadInfo> roadsInfos = {
+      Road::initDataByName(stations, "A", "B", 1, RoadColor::RED, 3),
+      Road::initDataByName(stations, "A", "C", 2, RoadColor::NONE, 2),
+      Road::initDataByName(stations, "C", "B", 3, RoadColor::NONE, 2),
+  };
+  std::vector<TunnelInfo> tunnelsInfos = {
+      Tunnel::initDataByName(stations, "B", "D", 4, RoadColor::RED, 2),
+  };
+  std::vector<FerryInfo> ferrysInfos = {
+      Ferry::initDataByName(stations, "B", "D", 5, 1, 2),
+  };
+
+  test_map_state.fillMapWithInfos(stationsInfos, roadsInfos, tunnelsInfos, ferrysInfos, gameGraph);
+
+  std::shared_ptr<mapState::Station> a = test_map_state.getStationByName("A");
+  std::shared_ptr<mapState::Station> b = test_map_state.getStationByName("B");
+  std::shared_ptr<mapState::Station> d = test_map_state.getStationByName("D");
+  std::vector<std::shared_ptr<Road>> mapRoads = test_map_state.getRoads();
+  std::shared_ptr<playersState::Player> tester =
+      std::make_shared<playersState::Player>("Tester", playersState::PlayerColor::RED, 0, 45, 3, borrowedRoads, nullptr);
+  auto giveHand = [&](std::vector<cardsState::ColorCard> colors) {
+    std::vector<std::shared_ptr<cardsState::WagonCard>> cards;
+    for (cardsState::ColorCard color : colors)
+    {
+      cards.push_back(std::make_shared<cardsState::WagonCard>(color));
+    }
+    tester->setHand(std::make_shared<cardsState::PlayerCards>(std::vector<std::shared_ptr<cardsState::DestinationCard>>(), cards));
+  };
+
+  // red cards in hand: the short red road
+  giveHand({cardsState::ColorCard::RED, cardsState::ColorCard::RED, cardsState::ColorCard::RED});
+  Path path = test_map_state.getAffordablePath(tester, a, b);
+  REQUIRE(path.ROADS.size() == 1);
+  CHECK_EQ(path.ROADS[0]->getId(), 1);
+  CHECK_EQ(path.TOTALLENGTH, 3);
+
+  // blue cards only: the longer grey detour needs no draw
+  giveHand({cardsState::ColorCard::BLUE, cardsState::ColorCard::BLUE, cardsState::ColorCard::BLUE, cardsState::ColorCard::BLUE});
+  path = test_map_state.getAffordablePath(tester, a, b);
+  CHECK_EQ(path.NUMEDGES, 2);
+  CHECK_EQ(path.TOTALLENGTH, 4);
+  CHECK_EQ(test_map_state.getMostEfficientPath(a, b, test_map_state.getRoadMask(mapRoads)).NUMEDGES, 1);
+
+  // no red for the tunnel and no locomotive for the ferry: the ferry is still cheaper
+  path = test_map_state.getAffordablePath(tester, b, d);
+  REQUIRE(path.ROADS.size() == 1);
+  CHECK_EQ(path.ROADS[0]->getId(), 5);
+  CHECK_EQ(path.TOTALLENGTH, 3);
+
+  // short exactly one locomotive: the coloured card plus the locomotive priced once at a whole turn
+  giveHand({cardsState::ColorCard::GREEN});
+  path = test_map_state.getAffordablePath(tester, b, d);
+  REQUIRE(path.ROADS.size() == 1);
+  CHECK_EQ(path.ROADS[0]->getId(), 5);
+  CHECK_EQ(path.TOTALLENGTH, 3);
+  giveHand({cardsState::ColorCard::GREEN, cardsState::ColorCard::LOCOMOTIVE});
+  path = test_map_state.getAffordablePath(tester, b, d);
+  REQUIRE(path.ROADS.size() == 1);
+  CHECK_EQ(path.ROADS[0]->getId(), 5);
+  CHECK_EQ(path.TOTALLENGTH, 2);
+
+  // enough red for the tunnel and its expected surcharge
+  giveHand({cardsState::ColorCard::RED, cardsState::ColorCard::RED, cardsState::ColorCard::RED, cardsState::ColorCard::RED});
+  path = test_map_state.getAffordablePath(tester, b, d);
+  REQUIRE(path.ROADS.size() == 1);
+  CHECK_EQ(path.ROADS[0]->getId(), 4);
+  CHECK_EQ(path.TOTALLENGTH, 3);
+
+  // own roads are free, opponents' roads are cut
+  mapRoads[1]->setOwner(tester);
+  mapRoads[2]->setOwner(tester);
+  path = test_map_state.getAffordablePath(tester, a, b);
+  CHECK_EQ(path.NUMEDGES, 2);
+  CHECK_EQ(path.TOTALLENGTH, 0);
+  std::shared_ptr<playersState::Player> rival =
+      std::make_shared<playersState::Player>("Rival", playersState::PlayerColor::BLUE, 0, 45, 3, borrowedRoads, nullptr);
+  CHECK_EQ(test_map_state.getAffordablePath(rival, a, b).NUMEDGES, 1);
+  mapRoads[0]->setOwner(tester);
+  CHECK(test_map_state.getAffordablePath(rival, a, b).STATIONS.empty());
+
+  for (const std::shared_ptr<Road> &road : mapRoads)
+  {
+    road->setOwner(nullptr);
+  }
+  ANN_END("getAffordablePath")
+}
+
 // check shortest path using examples from the europe map
 TEST(getShortestPathEuropePairs)
 {
@@ -681,6 +1278,127 @@ TEST(getMostEfficientPathEuropePairs)
   ANN_END("getMostEfficientPathEuropePairs")
 }
 
+TEST(getPathsBatch)
+{
+  ANN_START("getPathsBatch")
+  mapState::MapState map_state = mapState::MapState::Europe();
+  std::vector<std::shared_ptr<Station>> mapStations = map_state.getStations();
+  std::vector<bool> roadMask(map_state.getRoads().size(), true);
+  roadMask[0] = false;
+
+  // a few shared sources, a repeated pair, a source equal to its destination and a station off the map
+  std::vector<StationPair> queries;
+  for (std::size_t i = 0; i < mapStations.size(); i += 4)
+  {
+    queries.emplace_back(mapStations[i % 5], mapStations[i]);
+  }
+  queries.emplace_back(mapStations[1], mapStations[3]);
+  queries.emplace_back(mapStations[1], mapStations[3]);
+  queries.emplace_back(mapStations[2], mapStations[2]);
+  queries.emplace_back(mapStations[0], std::make_shared<Station>());
+
+  for (bool useRoadLength : {true, false})
+  {
+    std::vector<Path> paths = map_state.getPaths(queries, roadMask, useRoadLength);
+    REQUIRE(paths.size() == queries.size());
+    for (std::size_t q = 0; q < queries.size(); ++q)
+    {
+      Path single = useRoadLength ? map_state.getMostEfficientPath(queries[q].first, queries[q].second, roadMask)
+                                  : map_state.getShortestPath(queries[q].first, queries[q].second, roadMask);
+      CHECK_EQ(paths[q].TOTALLENGTH, single.TOTALLENGTH);
+      CHECK_EQ(paths[q].NUMEDGES, single.NUMEDGES);
+      CHECK_EQ(paths[q].STATIONS.size(), single.STATIONS.size());
+      if (!paths[q].STATIONS.empty())
+      {
+        CHECK_EQ(paths[q].STATIONS.front(), queries[q].first);
+        CHECK_EQ(paths[q].STATIONS.back(), queries[q].second);
+      }
+    }
+    CHECK(paths.back().STATIONS.empty());
+    CHECK(map_state.getPaths({}, roadMask, useRoadLength).empty());
+  }
+  ANN_END("getPathsBatch")
+}
+
+TEST(getLandmarkPathEurope)
+{
+  ANN_START("getLandmarkPathEurope")
+  mapState::MapState map_state = mapState::MapState::Europe();
+  std::vector<std::shared_ptr<Station>> mapStations = map_state.getStations();
+  CHECK(!map_state.getTopology()->landmarkStations.empty());
+  std::vector<bool> roadMask(map_state.getRoads().size(), true);
+  for (std::size_t r = 0; r < roadMask.size(); r += 7)
+  {
+    roadMask[r] = false;
+  }
+  for (const std::vector<bool> &mask : {std::vector<bool>(), roadMask})
+  {
+    for (const std::shared_ptr<Station> &src : mapStations)
+    {
+      for (const std::shared_ptr<Station> &dest : mapStations)
+      {
+        Path expected = map_state.getMostEfficientPath(src, dest, mask);
+        Path path = map_state.getLandmarkPath(src, dest, mask);
+        CHECK_EQ(path.TOTALLENGTH, expected.TOTALLENGTH);
+        CHECK_EQ(path.STATIONS.empty(), expected.STATIONS.empty());
+        if (!path.STATIONS.empty())
+        {
+          CHECK_EQ(path.STATIONS.front(), src);
+          CHECK_EQ(path.STATIONS.back(), dest);
+          CHECK_EQ(path.ROADS.size(), path.STATIONS.size() - 1);
+        }
+      }
+    }
+  }
+  CHECK(map_state.getLandmarkPath(mapStations[0], std::make_shared<Station>(), {}).STATIONS.empty());
+  ANN_END("getLandmarkPathEurope")
+}
+
+TEST(getContractedPathEurope)
+{
+  ANN_START("getContractedPathEurope")
+  mapState::MapState map_state = mapState::MapState::Europe();
+  std::vector<std::shared_ptr<Station>> mapStations = map_state.getStations();
+  std::vector<std::shared_ptr<Road>> mapRoads = map_state.getRoads();
+  std::vector<bool> roadMask(map_state.getRoads().size(), true);
+  for (std::size_t r = 0; r < roadMask.size(); r += 5)
+  {
+    roadMask[r] = false;
+  }
+  for (bool useRoadLength : {true, false})
+  {
+    for (const std::vector<bool> &mask : {std::vector<bool>(), roadMask})
+    {
+      for (const std::shared_ptr<Station> &src : mapStations)
+      {
+        for (const std::shared_ptr<Station> &dest : mapStations)
+        {
+          Path expected = useRoadLength ? map_state.getMostEfficientPath(src, dest, mask) : map_state.getShortestPath(src, dest, mask);
+          Path path = map_state.getContractedPath(src, dest, mask, useRoadLength);
+          CHECK_EQ(path.TOTALLENGTH, expected.TOTALLENGTH);
+          CHECK_EQ(path.NUMEDGES, static_cast<int>(path.ROADS.size()));
+          REQUIRE(path.STATIONS.empty() == expected.STATIONS.empty());
+          if (path.STATIONS.empty())
+          {
+            continue;
+          }
+          CHECK_EQ(path.STATIONS.front(), src);
+          CHECK_EQ(path.STATIONS.back(), dest);
+          // every road joins the stations on either side of it and is allowed by the mask
+          for (std::size_t i = 0; i < path.ROADS.size(); ++i)
+          {
+            std::set<std::string> ends = {path.ROADS[i]->getStationA()->getName(), path.ROADS[i]->getStationB()->getName()};
+            CHECK(ends == std::set<std::string>({path.STATIONS[i]->getName(), path.STATIONS[i + 1]->getName()}));
+            std::size_t slot = static_cast<std::size_t>(std::find(mapRoads.begin(), mapRoads.end(), path.ROADS[i]) - mapRoads.begin());
+            CHECK(mask.empty() || mask[slot]);
+          }
+        }
+      }
+    }
+  }
+  ANN_END("getContractedPathEurope")
+}
+
 // check isDestinationReached functions
 TEST(isDestinationReachedStatic)
 {
@@ -752,6 +1470,61 @@ TEST(isDestinationReachedDestinationCard)
   ANN_END("isDestinationReachedDestinationCard")
 }
 
+// check destination checks follow claims, borrows and released roads
+TEST(isDestinationReachedIncremental)
+{
+  ANN_START("isDestinationReachedIncremental")
+  std::shared_ptr<boost::adjacency_list<>> gameGraph =
+      std::make_shared<boost::adjacency_list<>>();
+  mapState::MapState test_map_state;
+
+  std::vector<StationInfo> stationsInfos = {
+      Station::initData("A"),
+      Station::initData("B"),
+      Station::initData("C"),
+      Station::initData("D"),
+  };
+
+  std::vector<std::shared_ptr<Station>> stations =
+      Station::BatchConstructor(stationsInfos, gameGraph);
+
+  std::vector<RoadInfo> roadsInfos = {
+      Road::initDataByName(stations, "A", "B", 1, RoadColor::NONE, 2),
+      Road::initDataByName(stations, "B", "C", 2, RoadColor::NONE, 2),
+      Road::initDataByName(stations, "C", "D", 3, RoadColor::NONE, 2),
+  };
+
+  test_map_state.fillMapWithInfos(stationsInfos, roadsInfos, {}, {}, gameGraph);
+  std::vector<std::shared_ptr<Road>> mapRoads = test_map_state.getRoads();
+  std::shared_ptr<Station> a = test_map_state.getStationByName("A");
+  std::shared_ptr<Station> b = test_map_state.getStationByName("B");
+  std::shared_ptr<Station> c = test_map_state.getStationByName("C");
+  std::shared_ptr<Station> d = test_map_state.getStationByName("D");
+
+  std::shared_ptr<playersState::Player> player =
+      std::make_shared<playersState::Player>("Tester", playersState::PlayerColor::RED, 0, 0, 0, borrowedRoads, nullptr);
+  std::shared_ptr<mapState::MapState> map = std::make_shared<mapState::MapState>(test_map_state);
+
+  CHECK(map->isDestinationReached(player, a, a));
+  CHECK(!map->isDestinationReached(player, a, b));
+
+  mapRoads[0]->setOwner(player);
+  mapRoads[2]->setOwner(player);
+  CHECK(map->isDestinationReached(player, a, b));
+  CHECK(map->isDestinationReached(player, c, d));
+  CHECK(!map->isDestinationReached(player, a, d));
+
+  player->borrowedRoads.push_back(mapRoads[1]);
+  CHECK(map->isDestinationReached(player, a, d));
+  CHECK(player->isDestinationReached(map, std::make_shared<cardsState::DestinationCard>(d, a, 0, false)));
+
+  mapRoads[0]->setOwner(nullptr);
+  CHECK(!map->isDestinationReached(player, a, d));
+  CHECK(map->isDestinationReached(player, b, d));
+  mapRoads[2]->setOwner(nullptr);
+  ANN_END("isDestinationReachedIncremental")
+}
+
 TEST(getClaimableRoads)
 {
   ANN_START("getClaimableRoads")
@@ -794,9 +1567,592 @@ TEST(isRoadClaimable)
   CHECK_EQ(isClaimable, true); // roadAC should be claimable
   ANN_END("isRoadClaimable")
 }
-TEST(getRoadsOwnedByPlayer){
+// check double route groups and the claimable shortcut against the per-road rules
+TEST(getParallelRoads)
+{
+  ANN_START("getParallelRoads")
+  mapState::MapState map_state = mapState::MapState::Europe();
+  std::vector<std::shared_ptr<Road>> mapRoads = map_state.getRoads();
+  std::shared_ptr<playersState::Player> owner =
+      std::make_shared<playersState::Player>("Owner", playersState::PlayerColor::RED, 0, 45, 3, borrowedRoads, nullptr);
+  std::shared_ptr<playersState::Player> other =
+      std::make_shared<playersState::Player>("Other", playersState::PlayerColor::BLUE, 0, 45, 3, borrowedRoads, nullptr);
+
+  std::shared_ptr<Road> doubleRoad = nullptr;
+  for (const std::shared_ptr<Road> &road : mapRoads)
+  {
+    CHECK_EQ(map_state.getRoadByID(road->getId()), road);
+    std::vector<std::shared_ptr<Road>> parallelRoads = map_state.getParallelRoads(road);
+    CHECK_EQ(parallelRoads.size() + 1, Road::getRoadsBetweenStations(mapRoads, road->getStationA(), road->getStationB()).size());
+    if (!doubleRoad && !parallelRoads.empty())
+    {
+      doubleRoad = road;
+    }
+  }
+  CHECK(map_state.getRoadByID(-42) == nullptr);
+  REQUIRE(doubleRoad != nullptr);
+
+  std::shared_ptr<Road> sibling = map_state.getParallelRoads(doubleRoad).front();
+  sibling->setOwner(owner);
+  for (int nbPlayers : {2, 4})
+  {
+    for (const std::shared_ptr<playersState::Player> &player : {owner, other})
+    {
+      CHECK_EQ(map_state.getClaimableRoads(nbPlayers, player).size(), Road::getClaimableRoads(mapRoads, nbPlayers, player).size());
+      CHECK_EQ(map_state.isRoadClaimable(nbPlayers, doubleRoad, player), doubleRoad->isClaimable(mapRoads, nbPlayers, player));
+    }
+  }
+  CHECK(!map_state.isRoadClaimable(4, doubleRoad, owner));
+  CHECK(map_state.isRoadClaimable(4, doubleRoad, other));
+  CHECK(!map_state.isRoadClaimable(2, doubleRoad, other));
+  sibling->setOwner(nullptr);
+  ANN_END("getParallelRoads")
+}
+
+// check the cached claimable sets follow claims
+TEST(getClaimableRoadsView)
+{
+  ANN_START("getClaimableRoadsView")
+  mapState::MapState map_state = mapState::MapState::Europe();
+  std::vector<std::shared_ptr<Road>> mapRoads = map_state.getRoads();
+  std::shared_ptr<playersState::Player> owner =
+      std::make_shared<playersState::Player>("Owner", playersState::PlayerColor::RED, 0, 45, 3, borrowedRoads, nullptr);
+  std::shared_ptr<playersState::Player> other =
+      std::make_shared<playersState::Player>("Other", playersState::PlayerColor::BLUE, 0, 45, 3, borrowedRoads, nullptr);
+
+  std::shared_ptr<Road> doubleRoad = nullptr;
+  for (const std::shared_ptr<Road> &road : mapRoads)
+  {
+    if (map_state.getParallelRoads(road).size() == 1)
+    {
+      doubleRoad = road;
+      break;
+    }
+  }
+  REQUIRE(doubleRoad != nullptr);
+  std::shared_ptr<Road> sibling = map_state.getParallelRoads(doubleRoad).front();
+
+  const std::vector<std::shared_ptr<Road>> &twoPlayers = map_state.getClaimableRoadsView(2, other);
+  CHECK_EQ(twoPlayers.size(), mapRoads.size());
+  std::size_t fourPlayers = map_state.getClaimableRoadsView(4, other).size();
+  CHECK_EQ(fourPlayers, mapRoads.size());
+
+  doubleRoad->setOwner(owner);
+  CHECK_EQ(map_state.getClaimableRoadsView(2, other).size(), mapRoads.size() - 2);
+  CHECK_EQ(map_state.getClaimableRoadsView(4, other).size(), mapRoads.size() - 1);
+  CHECK_EQ(map_state.getClaimableRoadsView(4, owner).size(), mapRoads.size() - 2);
+  CHECK(!map_state.isRoadClaimable(2, sibling, other));
+  CHECK(map_state.isRoadClaimable(4, sibling, other));
+
+  doubleRoad->setOwner(nullptr);
+  CHECK_EQ(map_state.getClaimableRoadsView(2, other).size(), mapRoads.size());
+  CHECK_EQ(map_state.getClaimableRoads(4, owner).size(), Road::getClaimableRoads(mapRoads, 4, owner).size());
+  ANN_END("getClaimableRoadsView")
+}
+
+TEST(roadColumns)
+{
+  ANN_START("roadColumns")
+  mapState::MapState map_state = mapState::MapState::Europe();
+  std::vector<std::shared_ptr<Road>> mapRoads = map_state.getRoads();
+  const std::vector<int> &lengths = map_state.getRoadLengths();
+  const std::vector<RoadColor> &colors = map_state.getRoadColors();
+  const std::vector<RoadKind> &kinds = map_state.getRoadKinds();
+  const std::vector<int> &locomotives = map_state.getRoadLocomotives();
+  const std::vector<int> &endpointsA = map_state.getRoadEndpointsA();
+  const std::vector<int> &endpointsB = map_state.getRoadEndpointsB();
+  REQUIRE(lengths.size() == mapRoads.size());
+  REQUIRE(endpointsA.size() == mapRoads.size());
+
+  std::size_t tunnels = 0;
+  std::size_t ferries = 0;
+  for (std::size_t r = 0; r < mapRoads.size(); ++r)
+  {
+    const std::shared_ptr<Road> &road = mapRoads[r];
+    CHECK_EQ(lengths[r], road->getLength());
+    CHECK_EQ(colors[r], road->getColor());
+    CHECK_EQ(kinds[r], road->getKind());
+    CHECK_EQ(endpointsA[r], road->getStationA()->getId());
+    CHECK_EQ(endpointsB[r], road->getStationB()->getId());
+    CHECK_EQ(road->getKind() == RoadKind::TUNNEL, std::dynamic_pointer_cast<Tunnel>(road) != nullptr);
+    CHECK_EQ(road->getKind() == RoadKind::FERRY, std::dynamic_pointer_cast<Ferry>(road) != nullptr);
+    if (road->getKind() == RoadKind::FERRY)
+    {
+      CHECK_EQ(locomotives[r], std::dynamic_pointer_cast<Ferry>(road)->getLocomotives());
+      ++ferries;
+    }
+    else
+    {
+      CHECK_EQ(locomotives[r], 0);
+      tunnels += road->getKind() == RoadKind::TUNNEL ? 1 : 0;
+    }
+  }
+  CHECK(tunnels > 0);
+  CHECK(ferries > 0);
+
+  // owner slots follow claims, and copies of a player share the slot of the first one seen
+  std::shared_ptr<playersState::Player> owner =
+      std::make_shared<playersState::Player>("Owner", playersState::PlayerColor::RED, 0, 45, 3, borrowedRoads, nullptr);
+  std::shared_ptr<playersState::Player> copy = std::make_shared<playersState::Player>(*owner);
+  for (int slot : map_state.getRoadOwnerSlots())
+  {
+    CHECK_EQ(slot, -1);
+  }
+  mapRoads[0]->setOwner(owner);
+  mapRoads[1]->setOwner(copy);
+  const std::vector<int> &owners = map_state.getRoadOwnerSlots();
+  CHECK_EQ(owners[0], 0);
+  CHECK_EQ(owners[1], 0);
+  CHECK_EQ(owners[2], -1);
+  REQUIRE(map_state.getRoadOwnerTable().size() == 1);
+  CHECK(map_state.getRoadOwnerTable()[0] == owner);
+
+  mapRoads[0]->setOwner(nullptr);
+  mapRoads[1]->setOwner(nullptr);
+  CHECK_EQ(map_state.getRoadOwnerSlots()[0], -1);
+  ANN_END("roadColumns")
+}
+
+TEST(getRoadsOwnedByPlayer)
+{
+  ANN_START("getRoadsOwnedByPlayer")
+  mapState::MapState map_state = mapState::MapState::Europe();
+  std::vector<std::shared_ptr<Road>> mapRoads = map_state.getRoads();
+  std::shared_ptr<playersState::Player> owner =
+      std::make_shared<playersState::Player>("Owner", playersState::PlayerColor::RED, 0, 45, 3, borrowedRoads, nullptr);
+  std::shared_ptr<playersState::Player> other =
+      std::make_shared<playersState::Player>("Other", playersState::PlayerColor::BLUE, 0, 45, 3, borrowedRoads, nullptr);
+  CHECK(map_state.getRoadsOwnedByPlayer(owner).empty());
+
+  mapRoads[3]->setOwner(owner);
+  mapRoads[7]->setOwner(other);
+  mapRoads[9]->setOwner(owner);
+  std::vector<std::shared_ptr<Road>> owned = map_state.getRoadsOwnedByPlayer(owner);
+  REQUIRE(owned.size() == 2);
+  CHECK(owned[0] == mapRoads[3]);
+  CHECK(owned[1] == mapRoads[9]);
+  CHECK_EQ(owned.size(), Road::getRoadsOwnedByPlayer(owner, mapRoads).size());
+  CHECK_EQ(map_state.getRoadsOwnedByPlayer(other).size(), 1);
+
+  for (const std::shared_ptr<Road> &road : mapRoads)
+  {
+    road->setOwner(nullptr);
+  }
+  CHECK(map_state.getRoadsOwnedByPlayer(owner).empty());
+  ANN_END("getRoadsOwnedByPlayer")
+}
+TEST(sharedTopology)
+{
+  ANN_START("sharedTopology")
+  std::size_t before = MapTopology::getSharedCount();
+  {
+    mapState::MapState first = mapState::MapState::Europe();
+    mapState::MapState second = mapState::MapState::Europe();
+    std::shared_ptr<const MapTopology> topology = first.getTopology();
+    REQUIRE(topology != nullptr);
+    CHECK(second.getTopology() == topology);
+    CHECK(&first.getRoadLengths() == &second.getRoadLengths());
+    CHECK_EQ(MapTopology::getSharedCount(), before + 1);
+
+    // claims stay in each game's own roads
+    std::shared_ptr<playersState::Player> owner =
+        std::make_shared<playersState::Player>("Owner", playersState::PlayerColor::RED, 0, 45, 3, borrowedRoads, nullptr);
+    first.getRoads()[0]->setOwner(owner);
+    CHECK_EQ(first.getRoadsOwnedByPlayer(owner).size(), 1);
+    CHECK(second.getRoadsOwnedByPlayer(owner).empty());
+    CHECK(first.getTopology() == topology);
+
+    // a different board gets its own tables
+    mapState::MapState test = mapState::MapState::Test();
+    CHECK(test.getTopology() != topology);
+    CHECK_EQ(MapTopology::getSharedCount(), before + 2);
+  }
+  CHECK_EQ(MapTopology::getSharedCount(), before);
+  ANN_END("sharedTopology")
+}
+
+// claims made before the routing graph is rebuilt mid-game are still there after it
+TEST(rebuildKeepsClaims)
+{
+  ANN_START("rebuildKeepsClaims")
+  mapState::MapState map_state = mapState::MapState::Europe();
+  std::shared_ptr<playersState::Player> owner =
+      std::make_shared<playersState::Player>("Owner", playersState::PlayerColor::RED, 0, 45, 3, borrowedRoads, nullptr);
+  std::shared_ptr<playersState::Player> other =
+      std::make_shared<playersState::Player>("Other", playersState::PlayerColor::BLUE, 0, 45, 3, borrowedRoads, nullptr);
+  std::shared_ptr<Road> claimed = map_state.getRoads()[3];
+  claimed->setOwner(owner);
+  CHECK_EQ(map_state.isRoadClaimable(4, claimed, other), false);
+  std::shared_ptr<const MapTopology> topology = map_state.getTopology();
+
+  // a road added to the board forces a rebuild
+  map_state.roads.push_back(std::make_shared<Road>(999, nullptr, claimed->getStationA(), claimed->getStationB(), RoadColor::NONE, 2));
+  CHECK_EQ(map_state.isRoadClaimable(4, claimed, other), false);
+  CHECK(map_state.getTopology() != topology);
+  std::vector<std::shared_ptr<Road>> owned = map_state.getRoadsOwnedByPlayer(owner);
+  REQUIRE(owned.size() == 1);
+  CHECK(owned[0] == claimed);
+
+  // a fresh object swapped in for the claimed road takes the claim over by id
+  map_state.roads[3] = std::make_shared<Road>(claimed->id, nullptr, claimed->getStationA(), claimed->getStationB(), claimed->getColor(), claimed->getLength());
+  map_state.roads.pop_back();
+  CHECK_EQ(map_state.isRoadClaimable(4, map_state.getRoads()[3], other), false);
+  REQUIRE(map_state.getRoads()[3]->getOwner());
+  CHECK_EQ(map_state.getRoads()[3]->getOwner()->getName(), "Owner");
+  CHECK_EQ(map_state.getRoadsOwnedByPlayer(owner).size(), 1);
+  ANN_END("rebuildKeepsClaims")
+}
+
+TEST(forkClaims)
+{
+  ANN_START("forkClaims")
+  mapState::MapState map_state = mapState::MapState::Europe();
+  std::vector<std::shared_ptr<Road>> mapRoads = map_state.getRoads();
+  std::shared_ptr<playersState::Player> owner =
+      std::make_shared<playersState::Player>("Owner", playersState::PlayerColor::RED, 0, 45, 3, borrowedRoads, nullptr);
+  int a = mapRoads[0]->getStationA()->getId();
+  int b = mapRoads[0]->getStationB()->getId();
+
+  MapFork fork = map_state.fork();
+  CHECK(fork.getTopology() == map_state.getTopology());
+  CHECK(fork.isRoadClaimable(0, 2, owner));
+  CHECK_EQ(fork.getStationDistance(nullptr, a, b, true), map_state.getStationDistance(nullptr, mapRoads[0]->getStationA(), mapRoads[0]->getStationB(), true));
+
+  // claims on the fork never reach the live roads
+  fork.claimRoad(0, owner);
+  CHECK(fork.getOwner(0) == owner);
+  CHECK_EQ(fork.getChangeCount(), 1);
+  CHECK(!mapRoads[0]->getOwner());
+  CHECK(!fork.isRoadClaimable(0, 2, owner));
+  CHECK(map_state.isRoadClaimable(2, mapRoads[0], owner));
+  CHECK(fork.isDestinationReached(owner, a, b));
+  CHECK(!map_state.isDestinationReached(owner, mapRoads[0]->getStationA(), mapRoads[0]->getStationB()));
+  CHECK_EQ(fork.getStationDistance(owner, a, b, true), 0);
+
+  // forks of forks copy the claims so far and diverge afterwards
+  MapFork nested = fork.fork();
+  nested.claimRoad(1, owner);
+  nested.claimRoad(0, nullptr);
+  CHECK(nested.getOwner(1) == owner);
+  CHECK(!nested.getOwner(0));
+  CHECK_EQ(nested.getChangeCount(), 1);
+  CHECK(fork.getOwner(0) == owner);
+  CHECK(!fork.getOwner(1));
+
+  // live claims made after forking show up in new forks only
+  mapRoads[2]->setOwner(owner);
+  CHECK(!fork.getOwner(2));
+  MapFork later = map_state.fork();
+  CHECK(later.getOwner(2) == owner);
+  CHECK_EQ(later.getChangeCount(), 0);
+  std::vector<int> claimable = later.getClaimableRoads(2, owner);
+  std::vector<std::shared_ptr<Road>> view = map_state.getClaimableRoadsView(2, owner);
+  REQUIRE(claimable.size() == view.size());
+  for (std::size_t i = 0; i < claimable.size(); ++i)
+  {
+    CHECK(mapRoads[static_cast<std::size_t>(claimable[i])] == view[i]);
+  }
+  mapRoads[2]->setOwner(nullptr);
+  ANN_END("forkClaims")
+}
+
+TEST(blockedTickets)
+{
+  ANN_START("blockedTickets")
+  mapState::MapState map_state = mapState::MapState::Europe();
+  std::vector<std::shared_ptr<Station>> mapStations = map_state.getStations();
+  std::vector<std::shared_ptr<Road>> mapRoads = map_state.getRoads();
+  std::shared_ptr<Station> lisboa = map_state.getStationByName("lisboa");
+  std::shared_ptr<Station> moskva = map_state.getStationByName("moskva");
+  REQUIRE(lisboa != nullptr);
+  REQUIRE(moskva != nullptr);
+  std::shared_ptr<playersState::Player> rival =
+      std::make_shared<playersState::Player>("Rival", playersState::PlayerColor::BLUE, 0, 45, 3, borrowedRoads, nullptr);
+  std::shared_ptr<playersState::Player> tester =
+      std::make_shared<playersState::Player>("Tester", playersState::PlayerColor::RED, 0, 45, 0, borrowedRoads, nullptr);
+  std::vector<std::shared_ptr<cardsState::DestinationCard>> tickets = {std::make_shared<cardsState::DestinationCard>(lisboa, moskva, 20, true)};
+  for (std::size_t i = 0; i < 6; ++i)
+  {
+    tickets.push_back(std::make_shared<cardsState::DestinationCard>(mapStations[i], mapStations[(i * 7 + 13) % mapStations.size()], 5, false));
+  }
+  tester->setHand(std::make_shared<cardsState::PlayerCards>(tickets, std::vector<std::shared_ptr<cardsState::WagonCard>>()));
+  CHECK(map_state.getBlockedTickets(2, tester).empty());
+
+  // lisboa walled in by the rival: only a station gets the tester out
+  std::vector<std::shared_ptr<Road>> walls;
+  for (const std::shared_ptr<Road> &road : mapRoads)
+  {
+    if (road->getStationA()->getName() == "lisboa" || road->getStationB()->getName() == "lisboa")
+    {
+      road->setOwner(rival);
+      walls.push_back(road);
+    }
+  }
+  REQUIRE(!walls.empty());
+  std::vector<std::shared_ptr<cardsState::DestinationCard>> blocked = map_state.getBlockedTickets(2, tester);
+  REQUIRE(!blocked.empty());
+  CHECK(blocked[0] == tickets[0]);
+  for (const std::shared_ptr<cardsState::DestinationCard> &ticket : blocked)
+  {
+    CHECK(ticket->getstationA() == lisboa || ticket->getstationB() == lisboa);
+  }
+  CHECK(!map_state.isTicketFeasible(2, tester, tickets[0]));
+  std::shared_ptr<playersState::Player> withStation =
+      std::make_shared<playersState::Player>("Tester", playersState::PlayerColor::RED, 0, 45, 1, borrowedRoads, tester->getHand());
+  CHECK(map_state.getBlockedTickets(2, withStation).empty());
+  CHECK(map_state.isTicketFeasible(2, withStation, std::make_shared<cardsState::DestinationCard>(moskva, lisboa, 20, true)));
+
+  // freeing a wall opens the route again
+  walls[0]->setOwner(nullptr);
+  CHECK(map_state.getBlockedTickets(2, tester).empty());
+  walls[0]->setOwner(rival);
+
+  // incremental answers after each claim match a search from scratch on a ticket outside the hand
+  for (std::size_t r = 0; r < mapRoads.size(); r += 3)
+  {
+    if (mapRoads[r]->getOwner())
+    {
+      continue;
+    }
+    mapRoads[r]->setOwner(rival);
+    std::vector<std::shared_ptr<cardsState::DestinationCard>> incremental = map_state.getBlockedTickets(2, withStation);
+    for (const std::shared_ptr<cardsState::DestinationCard> &ticket : tickets)
+    {
+      bool feasible = std::find(incremental.begin(), incremental.end(), ticket) == incremental.end();
+      std::shared_ptr<cardsState::DestinationCard> copy =
+          std::make_shared<cardsState::DestinationCard>(ticket->getstationA(), ticket->getstationB(), ticket->getPoints(), false);
+      CHECK_EQ(feasible, map_state.isTicketFeasible(2, withStation, copy));
+    }
+  }
+  for (const std::shared_ptr<Road> &road : mapRoads)
+  {
+    road->setOwner(nullptr);
+  }
+  CHECK(map_state.getBlockedTickets(2, tester).empty());
+  ANN_END("blockedTickets")
+}
+
+TEST(chokepoints)
+{
+  ANN_START("chokepoints")
+  mapState::MapState map_state = mapState::MapState::Europe();
+  std::vector<std::shared_ptr<Station>> mapStations = map_state.getStations();
+  std::vector<std::shared_ptr<Road>> mapRoads = map_state.getRoads();
+  std::shared_ptr<playersState::Player> rival =
+      std::make_shared<playersState::Player>("Rival", playersState::PlayerColor::BLUE, 0, 45, 3, borrowedRoads, nullptr);
+  std::shared_ptr<playersState::Player> tester =
+      std::make_shared<playersState::Player>("Tester", playersState::PlayerColor::RED, 0, 45, 3, borrowedRoads, nullptr);
+  std::vector<std::shared_ptr<cardsState::DestinationCard>> tickets;
+  for (std::size_t i = 0; i < 8; ++i)
+  {
+    tickets.push_back(std::make_shared<cardsState::DestinationCard>(mapStations[i * 3], mapStations[(i * 11 + 20) % mapStations.size()], 5, false));
+  }
+  tester->setHand(std::make_shared<cardsState::PlayerCards>(tickets, std::vector<std::shared_ptr<cardsState::WagonCard>>()));
+
+  // checked against removing each road (or every road around a station) and searching again
+  auto check = [&]() {
+    std::vector<bool> network(mapRoads.size(), false);
+    for (std::size_t r = 0; r < mapRoads.size(); ++r)
+    {
+      std::shared_ptr<playersState::Player> owner = mapRoads[r]->getOwner();
+      network[r] = owner ? owner == tester : map_state.isRoadClaimable(2, mapRoads[r], tester);
+    }
+    auto separates = [&](const std::vector<bool> &without) {
+      for (const std::shared_ptr<cardsState::DestinationCard> &ticket : tickets)
+      {
+        if (!map_state.getShortestPath(ticket->getstationA(), ticket->getstationB(), network).STATIONS.empty()
+            && map_state.getShortestPath(ticket->getstationA(), ticket->getstationB(), without).STATIONS.empty())
+        {
+          return true;
+        }
+      }
+      return false;
+    };
+    std::vector<std::shared_ptr<Road>> expectedRoads;
+    for (std::size_t r = 0; r < mapRoads.size(); ++r)
+    {
+      std::vector<bool> without = network;
+      without[r] = false;
+      if (network[r] && !mapRoads[r]->getOwner() && separates(without))
+      {
+        expectedRoads.push_back(mapRoads[r]);
+      }
+    }
+    std::vector<std::shared_ptr<Station>> expectedStations;
+    for (const std::shared_ptr<Station> &station : mapStations)
+    {
+      std::vector<bool> without = network;
+      for (std::size_t r = 0; r < mapRoads.size(); ++r)
+      {
+        if (mapRoads[r]->getStationA()->getName() == station->getName() || mapRoads[r]->getStationB()->getName() == station->getName())
+        {
+          without[r] = false;
+        }
+      }
+      // a ticket ending at the station only counts for the other tickets
+      std::vector<std::shared_ptr<cardsState::DestinationCard>> saved = tickets;
+      tickets.erase(std::remove_if(tickets.begin(), tickets.end(), [&](const std::shared_ptr<cardsState::DestinationCard> &ticket) {
+                      return ticket->getstationA() == station || ticket->getstationB() == station;
+                    }),
+                    tickets.end());
+      if (separates(without))
+      {
+        expectedStations.push_back(station);
+      }
+      tickets = saved;
+    }
+    std::vector<std::shared_ptr<Road>> roads = map_state.getChokepointRoads(2, tester);
+    std::vector<std::shared_ptr<Station>> stations = map_state.getChokepointStations(2, tester);
+    CHECK(roads == expectedRoads);
+    CHECK(std::set<std::shared_ptr<Station>>(stations.begin(), stations.end()) == std::set<std::shared_ptr<Station>>(expectedStations.begin(), expectedStations.end()));
+    return roads.size();
+  };
+
+  check();
+  std::size_t found = 0;
+  for (std::size_t r = 0; r < mapRoads.size(); r += 2)
+  {
+    mapRoads[r]->setOwner(r % 10 ? rival : tester);
+    found += check();
+  }
+  DEBUG_PRINT("chokepoint roads seen: " << found);
+  CHECK(found > 0);
+  for (const std::shared_ptr<Road> &road : mapRoads)
+  {
+    road->setOwner(nullptr);
+  }
+  ANN_END("chokepoints")
+}
+
+TEST(networkDistances)
+{
+  ANN_START("networkDistances")
+  mapState::MapState map_state = mapState::MapState::Europe();
+  std::vector<std::shared_ptr<Station>> mapStations = map_state.getStations();
+  std::vector<std::shared_ptr<Road>> mapRoads = map_state.getRoads();
+  std::shared_ptr<playersState::Player> rival =
+      std::make_shared<playersState::Player>("Rival", playersState::PlayerColor::BLUE, 0, 45, 3, borrowedRoads, nullptr);
+  std::shared_ptr<playersState::Player> tester =
+      std::make_shared<playersState::Player>("Tester", playersState::PlayerColor::RED, 0, 45, 3, borrowedRoads, nullptr);
+  // no network yet, nothing is in reach
+  const NetworkDistances &empty = map_state.getNetworkDistances(tester, true);
+  CHECK(std::all_of(empty.distances.begin(), empty.distances.end(), [](int distance) { return distance == -1; }));
+
+  // checked against one search per station of the network
+  auto check = [&](bool useRoadLength) {
+    const NetworkDistances &result = map_state.getNetworkDistances(tester, useRoadLength);
+    CHECK(&map_state.getNetworkDistances(tester, useRoadLength) == &result);
+    std::set<std::string> network;
+    for (const std::shared_ptr<Road> &road : mapRoads)
+    {
+      if (road->getOwner() == tester || std::find(tester->borrowedRoads.begin(), tester->borrowedRoads.end(), road) != tester->borrowedRoads.end())
+      {
+        network.insert(road->getStationA()->getName());
+        network.insert(road->getStationB()->getName());
+      }
+    }
+    REQUIRE(result.distances.size() == mapStations.size());
+    for (std::size_t s = 0; s < mapStations.size(); ++s)
+    {
+      int expected = -1;
+      for (const std::string &start : network)
+      {
+        int distance = map_state.getStationDistance(tester, map_state.getStationByName(start), mapStations[s], useRoadLength);
+        expected = distance >= 0 && (expected < 0 || distance < expected) ? distance : expected;
+      }
+      CHECK_EQ(result.distances[s], expected);
+      // the route walks back from the station to its origin on the network, at the distance found
+      std::vector<int> route = result.routeTo(static_cast<int>(s));
+      int length = 0;
+      for (int road : route)
+      {
+        bool own = mapRoads[road]->getOwner() == tester;
+        length += own ? 0 : (useRoadLength ? mapRoads[road]->getLength() : 1);
+      }
+      CHECK_EQ(length, std::max(expected, 0));
+      if (expected > 0)
+      {
+        REQUIRE(!route.empty());
+        CHECK(network.count(mapStations[result.origins[s]]->getName()) == 1);
+        CHECK(mapRoads[route.back()]->getStationA()->getName() == mapStations[s]->getName()
+              || mapRoads[route.back()]->getStationB()->getName() == mapStations[s]->getName());
+      }
+    }
+  };
+
+  mapRoads[0]->setOwner(tester);
+  check(true);
+  check(false);
+  for (std::size_t r = 5; r < mapRoads.size(); r += 9)
+  {
+    mapRoads[r]->setOwner(r % 2 ? rival : tester);
+    check(true);
+  }
+  // a borrowed road joins the network
+  std::size_t lent = 0;
+  while (mapRoads[lent]->getOwner() != rival)
+  {
+    ++lent;
+  }
+  tester->borrowedRoads.push_back(mapRoads[lent]);
+  const NetworkDistances &borrowing = map_state.getNetworkDistances(tester, true);
+  CHECK_EQ(borrowing.distances[mapRoads[lent]->getStationA()->getId()], 0);
+  CHECK_EQ(borrowing.distances[mapRoads[lent]->getStationB()->getId()], 0);
+  check(true);
+  check(false);
+  for (const std::shared_ptr<Road> &road : mapRoads)
+  {
+    road->setOwner(nullptr);
+  }
+  ANN_END("networkDistances")
+}
 
+TEST(forkWorkerThreads)
+{
+  ANN_START("forkWorkerThreads")
+  mapState::MapState map_state = mapState::MapState::Europe();
+  std::shared_ptr<Station> lisboa = map_state.getStationByName("lisboa");
+  std::shared_ptr<Station> moskva = map_state.getStationByName("moskva");
+  REQUIRE(lisboa != nullptr);
+  REQUIRE(moskva != nullptr);
+  std::shared_ptr<playersState::Player> owner =
+      std::make_shared<playersState::Player>("Owner", playersState::PlayerColor::RED, 0, 45, 3, borrowedRoads, nullptr);
+  MapFork base = map_state.fork();
+  const int workers = 4;
+  const int roadCount = static_cast<int>(map_state.getRoads().size());
+
+  // each worker tries its own share of roads on a private fork and prices the route after every claim
+  std::vector<std::vector<int>> results(workers);
+  std::vector<std::thread> threads;
+  for (int w = 0; w < workers; ++w)
+  {
+    threads.emplace_back([&, w]() {
+      for (int road = w; road < roadCount; road += workers)
+      {
+        MapFork whatIf = base.fork();
+        whatIf.claimRoad(road, owner);
+        results[static_cast<std::size_t>(w)].push_back(whatIf.getStationDistance(owner, lisboa->getId(), moskva->getId(), true));
+      }
+    });
+  }
+  for (std::thread &thread : threads)
+  {
+    thread.join();
+  }
+  for (int w = 0; w < workers; ++w)
+  {
+    std::size_t i = 0;
+    for (int road = w; road < roadCount; road += workers, ++i)
+    {
+      MapFork whatIf = base.fork();
+      whatIf.claimRoad(road, owner);
+      CHECK_EQ(results[static_cast<std::size_t>(w)][i], whatIf.getStationDistance(owner, lisboa->getId(), moskva->getId(), true));
+    }
+  }
+  CHECK_EQ(base.getChangeCount(), 0);
+  ANN_END("forkWorkerThreads")
 }
+
 TEST(getRoadsUsableByPlayer){
   
 }
@@ -0,0 +1,297 @@
+#include <boost/test/unit_test.hpp>
+
+#include "../../src/shared/mapState/StationBorrowing.h"
+#include "../../src/shared/mapState/MapState.h"
+#include "../../src/shared/mapState/Station.h"
+#include "../../src/shared/mapState/Road.h"
+#include "../../src/shared/playersState/Player.h"
+#include "../../src/shared/cardsState/DestinationCard.h"
+#include <algorithm>
+#include <memory>
+#include <random>
+
+#define DEBUG_MODE true
+#if DEBUG_MODE == true
+#define DEBUG
+#define DEBUG_PRINT(x) std::cout << x << std::endl
+#else
+#define DEBUG_PRINT(x)
+#endif
+
+#define TEST(x) BOOST_AUTO_TEST_CASE(x)
+#define SUITE_START(x) BOOST_AUTO_TEST_SUITE(x)
+#define SUITE_END() BOOST_AUTO_TEST_SUITE_END()
+#define ANN_START(x) std::cout << "Starting " << x << " test..." << std::endl;
+#define ANN_END(x) std::cout << x << " test finished!" << std::endl;
+#define CHECK_EQ(a, b) BOOST_CHECK_EQUAL(a, b)
+#define CHECK_NE(a, b) BOOST_CHECK_NE(a, b)
+#define CHECK_NTHROW(...) BOOST_CHECK_NO_THROW(__VA_ARGS__)
+#define CHECK_THROW(...) BOOST_CHECK_THROW(__VA_ARGS__)
+#define REQUIRE(...) BOOST_REQUIRE(__VA_ARGS__)
+#define CHECK(x) BOOST_CHECK(x)
+
+using namespace ::mapState;
+
+
+using StationInfo = std::tuple<std::shared_ptr<playersState::Player>, std::string>;
+using StationPair = std::pair<std::shared_ptr<Station>, std::shared_ptr<Station>>;
+using RoadDetail = std::tuple<int, std::shared_ptr<playersState::Player>, RoadColor, int>;
+using RoadInfo = std::pair<StationPair, RoadDetail>;
+
+namespace
+{
+
+// every way of giving each station one of its roads or nothing, capped at maxBorrows roads
+int bruteForce(const StationBorrowing &problem, std::size_t index, std::vector<int> &choice, int used)
+{
+  if (index == problem.candidateRoads.size())
+  {
+    return problem.evaluate(choice);
+  }
+  int best = bruteForce(problem, index + 1, choice, used);
+  if (used < problem.maxBorrows)
+  {
+    for (int road : problem.candidateRoads[index])
+    {
+      choice[index] = road;
+      best = std::max(best, bruteForce(problem, index + 1, choice, used + 1));
+      choice[index] = -1;
+    }
+  }
+  return best;
+}
+
+} // namespace
+
+TEST(TestStaticAssert)
+{
+  BOOST_CHECK(1);
+}
+
+SUITE_START(Solver)
+
+TEST(SingleStation)
+{
+  ANN_START("SingleStation")
+  // chain 0-1-2-3 where the player owns 0-1 and 2-3, the station sits on 1 or 2
+  StationBorrowing problem;
+  problem.baseParents = {-2, 0, -2, 2};
+  problem.roadEndpointsA = {0, 1, 2, 1};
+  problem.roadEndpointsB = {1, 2, 3, 3};
+  problem.candidateRoads = {{1, 3}};
+  problem.ticketA = {0, 0};
+  problem.ticketB = {3, 2};
+  problem.ticketPoints = {10, 4};
+  problem.maxBorrows = 1;
+
+  std::vector<int> choice = problem.solve();
+  REQUIRE(choice.size() == 1);
+  CHECK_EQ(choice[0], 1);
+  CHECK_EQ(problem.evaluate(choice), 14);
+
+  problem.maxBorrows = 0;
+  CHECK_EQ(problem.solve()[0], -1);
+  ANN_END("SingleStation")
+}
+
+TEST(UselessBorrowLeftOut)
+{
+  ANN_START("UselessBorrowLeftOut")
+  // the player already joins 0 and 1; the first station only reaches that same pair again,
+  // the second one reaches 2
+  StationBorrowing problem;
+  problem.baseParents = {-2, 0, -1};
+  problem.roadEndpointsA = {0, 1};
+  problem.roadEndpointsB = {1, 2};
+  problem.candidateRoads = {{0}, {1}};
+  problem.ticketA = {0};
+  problem.ticketB = {2};
+  problem.ticketPoints = {6};
+  problem.maxBorrows = 2;
+
+  std::vector<int> choice = problem.solve();
+  REQUIRE(choice.size() == 2);
+  CHECK_EQ(choice[0], -1);
+  CHECK_EQ(choice[1], 1);
+  CHECK_EQ(problem.evaluate(choice), 6);
+
+  // nothing to gain at all: no station is spent
+  problem.ticketB = {1};
+  choice = problem.solve();
+  CHECK_EQ(choice[0], -1);
+  CHECK_EQ(choice[1], -1);
+  ANN_END("UselessBorrowLeftOut")
+}
+
+TEST(RandomAgainstBruteForce)
+{
+  ANN_START("RandomAgainstBruteForce")
+  std::mt19937 random(7);
+  for (int round = 0; round < 100; ++round)
+  {
+    int stations = 6 + static_cast<int>(random() % 6);
+    int roads = 4 + static_cast<int>(random() % 10);
+    StationBorrowing problem;
+    problem.baseParents.assign(static_cast<std::size_t>(stations), -1);
+    for (int r = 0; r < roads; ++r)
+    {
+      problem.roadEndpointsA.push_back(static_cast<int>(random() % stations));
+      problem.roadEndpointsB.push_back(static_cast<int>(random() % stations));
+    }
+    int placed = 1 + static_cast<int>(random() % 3);
+    for (int s = 0; s < placed; ++s)
+    {
+      std::vector<int> candidates;
+      for (int r = 0; r < roads; ++r)
+      {
+        if (random() % 3 == 0)
+        {
+          candidates.push_back(r);
+        }
+      }
+      problem.candidateRoads.push_back(candidates);
+    }
+    for (int t = 0; t < 4; ++t)
+    {
+      problem.ticketA.push_back(static_cast<int>(random() % stations));
+      problem.ticketB.push_back(static_cast<int>(random() % stations));
+      problem.ticketPoints.push_back(1 + static_cast<int>(random() % 12));
+    }
+    problem.maxBorrows = placed - static_cast<int>(random() % 2);
+
+    std::vector<int> choice = problem.solve();
+    int borrowed = 0;
+    for (int road : choice)
+    {
+      borrowed += road >= 0 ? 1 : 0;
+    }
+    CHECK(borrowed <= problem.maxBorrows);
+    std::vector<int> empty(problem.candidateRoads.size(), -1);
+    CHECK_EQ(problem.evaluate(choice), bruteForce(problem, 0, empty, 0));
+    // giving back any single pick loses points
+    for (std::size_t s = 0; s < choice.size(); ++s)
+    {
+      if (choice[s] >= 0)
+      {
+        std::vector<int> fewer = choice;
+        fewer[s] = -1;
+        CHECK(problem.evaluate(fewer) < problem.evaluate(choice));
+      }
+    }
+  }
+  ANN_END("RandomAgainstBruteForce")
+}
+
+SUITE_END() // Solver
+
+SUITE_START(MapQueries)
+
+TEST(getBestStationBorrows)
+{
+  ANN_START("getBestStationBorrows")
+  std::shared_ptr<boost::adjacency_list<>> gameGraph =
+      std::make_shared<boost::adjacency_list<>>();
+  mapState::MapState test_map_state;
+
+  std::vector<StationInfo> stationsInfos = {
+      Station::initData("A"),
+      Station::initData("B"),
+      Station::initData("C"),
+      Station::initData("D"),
+  };
+  std::vector<std::shared_ptr<Station>> stations =
+      Station::BatchConstructor(stationsInfos, gameGraph);
+  std::vector<RoadInfo> roadsInfos = {
+      Road::initDataByName(stations, "A", "B", 1, RoadColor::NONE, 2),
+      Road::initDataByName(stations, "B", "C", 2, RoadColor::NONE, 2),
+      Road::initDataByName(stations, "B", "D", 3, RoadColor::NONE, 2),
+  };
+  test_map_state.fillMapWithInfos(stationsInfos, roadsInfos, {}, {}, gameGraph);
+  std::vector<std::shared_ptr<Road>> mapRoads = test_map_state.getRoads();
+
+  std::vector<std::shared_ptr<mapState::Road>> noRoads;
+  std::shared_ptr<playersState::Player> player =
+      std::make_shared<playersState::Player>("Tester", playersState::PlayerColor::RED, 0, 0, 2, noRoads, nullptr);
+  std::shared_ptr<playersState::Player> rival =
+      std::make_shared<playersState::Player>("Rival", playersState::PlayerColor::BLUE, 0, 0, 3, noRoads, nullptr);
+
+  mapRoads[0]->setOwner(player);
+  mapRoads[1]->setOwner(rival);
+  mapRoads[2]->setOwner(rival);
+  test_map_state.getStationByName("B")->setOwner(player);
+  player->completedDestinations.push_back(std::make_shared<cardsState::DestinationCard>(
+      test_map_state.getStationByName("A"), test_map_state.getStationByName("D"), 8, false));
+  player->completedDestinations.push_back(std::make_shared<cardsState::DestinationCard>(
+      test_map_state.getStationByName("A"), test_map_state.getStationByName("C"), 5, false));
+
+  std::vector<std::vector<std::shared_ptr<Road>>> borrows = test_map_state.getBestStationBorrows({player, rival});
+  REQUIRE(borrows.size() == 2);
+  REQUIRE(borrows[0].size() == 1);
+  CHECK_EQ(borrows[0][0], mapRoads[2]);
+  CHECK(borrows[1].empty());
+
+  // a borrow already made during the game uses up the only placed station
+  player->borrowedRoads.push_back(mapRoads[1]);
+  CHECK(test_map_state.getBestStationBorrows({player})[0].empty());
+
+  for (const std::shared_ptr<Road> &road : mapRoads)
+  {
+    road->setOwner(nullptr);
+  }
+  ANN_END("getBestStationBorrows")
+}
+
+// a rival's double of the player's own road joins nothing new and is never borrowed
+TEST(getBestStationBorrowsSkipsJoinedRoads)
+{
+  ANN_START("getBestStationBorrowsSkipsJoinedRoads")
+  std::shared_ptr<boost::adjacency_list<>> gameGraph =
+      std::make_shared<boost::adjacency_list<>>();
+  mapState::MapState test_map_state;
+
+  std::vector<StationInfo> stationsInfos = {
+      Station::initData("A"),
+      Station::initData("B"),
+      Station::initData("C"),
+  };
+  std::vector<std::shared_ptr<Station>> stations =
+      Station::BatchConstructor(stationsInfos, gameGraph);
+  std::vector<RoadInfo> roadsInfos = {
+      Road::initDataByName(stations, "A", "B", 1, RoadColor::RED, 2),
+      Road::initDataByName(stations, "A", "B", 2, RoadColor::BLUE, 2),
+      Road::initDataByName(stations, "B", "C", 3, RoadColor::NONE, 2),
+  };
+  test_map_state.fillMapWithInfos(stationsInfos, roadsInfos, {}, {}, gameGraph);
+  std::vector<std::shared_ptr<Road>> mapRoads = test_map_state.getRoads();
+
+  std::vector<std::shared_ptr<mapState::Road>> noRoads;
+  std::shared_ptr<playersState::Player> player =
+      std::make_shared<playersState::Player>("Tester", playersState::PlayerColor::RED, 0, 0, 1, noRoads, nullptr);
+  std::shared_ptr<playersState::Player> rival =
+      std::make_shared<playersState::Player>("Rival", playersState::PlayerColor::BLUE, 0, 0, 3, noRoads, nullptr);
+
+  mapRoads[0]->setOwner(player);
+  mapRoads[1]->setOwner(rival);
+  mapRoads[2]->setOwner(rival);
+  test_map_state.getStationByName("A")->setOwner(player);
+  test_map_state.getStationByName("B")->setOwner(player);
+  player->completedDestinations.push_back(std::make_shared<cardsState::DestinationCard>(
+      test_map_state.getStationByName("A"), test_map_state.getStationByName("C"), 5, false));
+
+  std::vector<std::vector<std::shared_ptr<Road>>> borrows = test_map_state.getBestStationBorrows({player});
+  REQUIRE(borrows.size() == 1);
+  REQUIRE(borrows[0].size() == 1);
+  CHECK_EQ(borrows[0][0], mapRoads[2]);
+
+  // once B-C is borrowed, the second station has nothing left worth taking
+  player->borrowedRoads.push_back(mapRoads[2]);
+  CHECK(test_map_state.getBestStationBorrows({player})[0].empty());
+
+  for (const std::shared_ptr<Road> &road : mapRoads)
+  {
+    road->setOwner(nullptr);
+  }
+  ANN_END("getBestStationBorrowsSkipsJoinedRoads")
+}
+
+SUITE_END() // MapQueries
@@ -0,0 +1,168 @@
+#include <boost/test/unit_test.hpp>
+
+#include "../../src/shared/mapState/TicketTable.h"
+#include "../../src/shared/mapState/MapState.h"
+#include "../../src/shared/mapState/Station.h"
+#include "../../src/shared/mapState/Road.h"
+#include "../../src/shared/mapState/Path.h"
+#include "../../src/shared/playersState/Player.h"
+#include "../../src/shared/cardsState/DestinationCard.h"
+#include "../../src/shared/cardsState/PlayerCards.h"
+#include "../../src/shared/cardsState/WagonCard.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <numeric>
+
+#include <unistd.h>
+
+#define DEBUG_MODE true
+#if DEBUG_MODE == true
+#define DEBUG
+#define DEBUG_PRINT(x) std::cout << x << std::endl
+#else
+#define DEBUG_PRINT(x)
+#endif
+
+#define TEST(x) BOOST_AUTO_TEST_CASE(x)
+#define SUITE_START(x) BOOST_AUTO_TEST_SUITE(x)
+#define SUITE_END() BOOST_AUTO_TEST_SUITE_END()
+#define ANN_START(x) std::cout << "Starting " << x << " test..." << std::endl;
+#define ANN_END(x) std::cout << x << " test finished!" << std::endl;
+#define CHECK_EQ(a, b) BOOST_CHECK_EQUAL(a, b)
+#define CHECK_NE(a, b) BOOST_CHECK_NE(a, b)
+#define CHECK_NTHROW(...) BOOST_CHECK_NO_THROW(__VA_ARGS__)
+#define CHECK_THROW(...) BOOST_CHECK_THROW(__VA_ARGS__)
+#define REQUIRE(...) BOOST_REQUIRE(__VA_ARGS__)
+#define CHECK(x) BOOST_CHECK(x)
+
+using namespace ::mapState;
+
+namespace
+{
+
+// a fresh cache directory per run, so earlier runs never answer for this one
+std::string cacheDirectory()
+{
+  std::filesystem::path directory = std::filesystem::temp_directory_path() / ("ticket_table_test_" + std::to_string(::getpid()));
+  std::filesystem::remove_all(directory);
+  std::filesystem::create_directories(directory);
+  return directory.string();
+}
+
+std::vector<std::filesystem::path> cacheFiles(const std::string &directory)
+{
+  std::vector<std::filesystem::path> files;
+  for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator(directory))
+  {
+    files.push_back(entry.path());
+  }
+  return files;
+}
+
+} // namespace
+
+TEST(TestStaticAssert)
+{
+  BOOST_CHECK(1);
+}
+
+SUITE_START(Europe)
+
+TEST(MatchesSearches)
+{
+  ANN_START("MatchesSearches")
+  mapState::MapState map_state = mapState::MapState::Europe();
+  std::vector<std::shared_ptr<Road>> mapRoads = map_state.getRoads();
+  std::vector<std::shared_ptr<cardsState::DestinationCard>> catalog = cardsState::DestinationCard::Europe(map_state.getStations());
+  std::shared_ptr<const TicketTable> table = map_state.getTicketTable(catalog, "");
+  REQUIRE(table != nullptr);
+  REQUIRE(!table->ticketA.empty());
+  CHECK(table->ticketA.size() <= catalog.size());
+  CHECK_EQ(table->roadContention.size(), mapRoads.size());
+  CHECK_EQ(std::accumulate(table->roadContention.begin(), table->roadContention.end(), 0), static_cast<int>(table->shortestRoads.size()));
+  CHECK(map_state.getTicketTable(catalog, "") == table);
+
+  std::vector<std::shared_ptr<Road>> noRoads;
+  for (const std::shared_ptr<cardsState::DestinationCard> &card : catalog)
+  {
+    std::shared_ptr<Station> a = card->getstationA();
+    std::shared_ptr<Station> b = card->getstationB();
+    // a few catalog names have no station on the map, the table leaves those cards out
+    if (!a || !b)
+    {
+      continue;
+    }
+    int row = table->findTicket(a->getId(), b->getId());
+    REQUIRE(row >= 0);
+    CHECK_EQ(row, table->findTicket(b->getId(), a->getId()));
+    Path best = map_state.getMostEfficientPath(a, b, std::vector<bool>());
+    CHECK_EQ(table->minLengths[row], best.TOTALLENGTH);
+    CHECK_EQ(table->minHops[row], map_state.getShortestPath(a, b, std::vector<bool>()).TOTALLENGTH);
+    // every road of one shortest route is listed for the ticket
+    std::vector<int> listed(table->shortestRoads.begin() + table->shortestRoadOffsets[row], table->shortestRoads.begin() + table->shortestRoadOffsets[row + 1]);
+    for (const std::shared_ptr<Road> &road : best.ROADS)
+    {
+      int slot = static_cast<int>(std::find(mapRoads.begin(), mapRoads.end(), road) - mapRoads.begin());
+      CHECK(std::find(listed.begin(), listed.end(), slot) != listed.end());
+    }
+
+    // a single route left means a bridge, which the chokepoint analysis of a player holding the ticket sees
+    CHECK(table->disjointRoutes[row] >= 1);
+    std::shared_ptr<playersState::Player> holder =
+        std::make_shared<playersState::Player>("Holder", playersState::PlayerColor::RED, 0, 45, 3, noRoads, nullptr);
+    holder->setHand(std::make_shared<cardsState::PlayerCards>(std::vector<std::shared_ptr<cardsState::DestinationCard>>({card}), std::vector<std::shared_ptr<cardsState::WagonCard>>()));
+    CHECK_EQ(table->disjointRoutes[row] == 1, !map_state.getChokepointRoads(5, holder).empty());
+  }
+  CHECK_EQ(table->findTicket(0, 0), -1);
+  ANN_END("MatchesSearches")
+}
+
+TEST(DiskCache)
+{
+  ANN_START("DiskCache")
+  std::string directory = cacheDirectory();
+  mapState::MapState first = mapState::MapState::Europe();
+  std::shared_ptr<const TicketTable> computed = first.getTicketTable(cardsState::DestinationCard::Europe(first.getStations()), directory);
+  std::vector<std::filesystem::path> files = cacheFiles(directory);
+  REQUIRE(files.size() == 1u);
+
+  // another game, another shuffle of the catalog: same key, read back from the file
+  mapState::MapState second = mapState::MapState::Europe();
+  std::shared_ptr<const TicketTable> loaded = second.getTicketTable(cardsState::DestinationCard::Europe(second.getStations()), directory);
+  CHECK_EQ(loaded->key, computed->key);
+  CHECK(loaded->ticketA == computed->ticketA);
+  CHECK(loaded->minLengths == computed->minLengths);
+  CHECK(loaded->minHops == computed->minHops);
+  CHECK(loaded->disjointRoutes == computed->disjointRoutes);
+  CHECK(loaded->shortestRoads == computed->shortestRoads);
+  CHECK(loaded->roadContention == computed->roadContention);
+
+  // a damaged file is ignored and rewritten
+  {
+    std::fstream file(files[0].string().c_str(), std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(-1, std::ios::end);
+    file.put('\x7f');
+  }
+  TicketTable damaged;
+  CHECK(!damaged.load(files[0].string(), computed->key));
+  mapState::MapState third = mapState::MapState::Europe();
+  std::shared_ptr<const TicketTable> recomputed = third.getTicketTable(cardsState::DestinationCard::Europe(third.getStations()), directory);
+  CHECK(recomputed->roadContention == computed->roadContention);
+  TicketTable reread;
+  CHECK(reread.load(files[0].string(), computed->key));
+  CHECK(!reread.load(files[0].string(), computed->key + 1));
+
+  // a smaller catalog is a different table
+  std::vector<std::shared_ptr<cardsState::DestinationCard>> few = cardsState::DestinationCard::Europe(third.getStations());
+  few.resize(5);
+  std::shared_ptr<const TicketTable> partial = third.getTicketTable(few, directory);
+  CHECK_NE(partial->key, computed->key);
+  CHECK(partial->ticketA.size() <= 5u);
+  CHECK_EQ(cacheFiles(directory).size(), 2u);
+  std::filesystem::remove_all(directory);
+  ANN_END("DiskCache")
+}
+
+SUITE_END() // Europe
@@ -34,8 +34,8 @@ std::string test_init_stationA_name = "paris";
 std::string test_init_stationB_name = "rome";
 int test_init_destination_points = 12;
 cardsState::ColorCard test_init_wagon_color = cardsState::ColorCard::RED;
-std::shared_ptr<mapState::Station> test_init_stationA = std::make_shared<mapState::Station>(test_init_stationA_name, nullptr, nullptr);
-std::shared_ptr<mapState::Station> test_init_stationB = std::make_shared<mapState::Station>(test_init_stationB_name, nullptr, nullptr);
+std::shared_ptr<mapState::Station> test_init_stationA = std::make_shared<mapState::Station>(test_init_stationA_name, nullptr);
+std::shared_ptr<mapState::Station> test_init_stationB = std::make_shared<mapState::Station>(test_init_stationB_name, nullptr);
 
 std::string test_init_player_name = "yosra";
 PlayerColor test_init_player_color = PlayerColor::RED;
@@ -308,8 +308,8 @@ TEST(setHand)
     ANN_START("setHand")
     std::string test_new_stationA_name = "berlin";
     std::string test_new_stationB_name = "rome";
-    std::shared_ptr<mapState::Station> test_new_stationA = std::make_shared<mapState::Station>(test_new_stationA_name, nullptr, nullptr);
-    std::shared_ptr<mapState::Station> test_new_stationB = std::make_shared<mapState::Station>(test_new_stationB_name, nullptr, nullptr);
+    std::shared_ptr<mapState::Station> test_new_stationA = std::make_shared<mapState::Station>(test_new_stationA_name, nullptr);
+    std::shared_ptr<mapState::Station> test_new_stationB = std::make_shared<mapState::Station>(test_new_stationB_name, nullptr);
 
     int test_new_destination_points = 15;
     cardsState::ColorCard test_new_wagon_color = cardsState::ColorCard::BLUE;
@@ -422,10 +422,10 @@ TEST(calculateDestinationPoints)
         ANN_START("completed destinations not empty case")
         int d1_points = 10;
         int d2_points = 8;
-        std::shared_ptr<mapState::Station> d1_stationA = std::make_shared<mapState::Station>("A", nullptr, nullptr);
-        std::shared_ptr<mapState::Station> d1_stationB = std::make_shared<mapState::Station>("B", nullptr, nullptr);
-        std::shared_ptr<mapState::Station> d2_stationA = std::make_shared<mapState::Station>("C", nullptr, nullptr);
-        std::shared_ptr<mapState::Station> d2_stationB = std::make_shared<mapState::Station>("D", nullptr, nullptr);
+        std::shared_ptr<mapState::Station> d1_stationA = std::make_shared<mapState::Station>("A", nullptr);
+        std::shared_ptr<mapState::Station> d1_stationB = std::make_shared<mapState::Station>("B", nullptr);
+        std::shared_ptr<mapState::Station> d2_stationA = std::make_shared<mapState::Station>("C", nullptr);
+        std::shared_ptr<mapState::Station> d2_stationB = std::make_shared<mapState::Station>("D", nullptr);
         std::shared_ptr<cardsState::DestinationCard> d1 = std::make_shared<cardsState::DestinationCard>(d1_stationA, d1_stationB, d1_points, false);
         std::shared_ptr<cardsState::DestinationCard> d2 = std::make_shared<cardsState::DestinationCard>(d2_stationA, d2_stationB, d2_points, false);
         std::vector<std::shared_ptr<cardsState::DestinationCard>> dest_cards = {d1, d2};
@@ -462,15 +462,15 @@ TEST(calculateWagonPoints)
 {
     ANN_START("calculateWagonPoints")
 
-    auto stationA = std::make_shared<mapState::Station>("A", nullptr, nullptr);
-    auto stationB = std::make_shared<mapState::Station>("B", nullptr, nullptr);
-    auto stationC = std::make_shared<mapState::Station>("C", nullptr, nullptr);
-    auto stationD = std::make_shared<mapState::Station>("D", nullptr, nullptr);
+    auto stationA = std::make_shared<mapState::Station>("A", nullptr);
+    auto stationB = std::make_shared<mapState::Station>("B", nullptr);
+    auto stationC = std::make_shared<mapState::Station>("C", nullptr);
+    auto stationD = std::make_shared<mapState::Station>("D", nullptr);
 
     ANN_START("Case 1: Single length 1 route → 1 point")
     {
         auto road1 = std::make_shared<mapState::Road>(
-            1, nullptr, stationA, stationB, mapState::RoadColor::RED, 1, nullptr
+            1, nullptr, stationA, stationB, mapState::RoadColor::RED, 1
         );
 
         std::vector<std::shared_ptr<mapState::Road>> borrowed = {road1};
@@ -491,9 +491,9 @@ TEST(calculateWagonPoints)
 
     ANN_START("Case 2: Routes of different lengths (classic case)")
     {
-        auto road1 = std::make_shared<mapState::Road>(1,nullptr, stationA, stationB, mapState::RoadColor::RED, 1, nullptr);
-        auto road2 = std::make_shared<mapState::Road>(2,nullptr, stationB, stationC, mapState::RoadColor::BLUE, 3, nullptr);
-        auto road3 = std::make_shared<mapState::Road>(3,nullptr, stationC, stationD, mapState::RoadColor::GREEN, 6, nullptr);
+        auto road1 = std::make_shared<mapState::Road>(1,nullptr, stationA, stationB, mapState::RoadColor::RED, 1);
+        auto road2 = std::make_shared<mapState::Road>(2,nullptr, stationB, stationC, mapState::RoadColor::BLUE, 3);
+        auto road3 = std::make_shared<mapState::Road>(3,nullptr, stationC, stationD, mapState::RoadColor::GREEN, 6);
 
         std::vector<std::shared_ptr<mapState::Road>> borrowed = {road1, road2, road3};
 
@@ -529,9 +529,9 @@ TEST(calculateWagonPoints)
 
     ANN_START("Case 4: Double route (same length) + long route")
     {
-        auto road1 = std::make_shared<mapState::Road>(1,nullptr, stationA, stationB, mapState::RoadColor::RED, 4, nullptr);
-        auto road2 = std::make_shared<mapState::Road>(2,nullptr, stationA, stationB, mapState::RoadColor::BLUE, 4, nullptr);
-        auto road3 = std::make_shared<mapState::Road>(3,nullptr, stationB, stationC, mapState::RoadColor::PINK, 2, nullptr);
+        auto road1 = std::make_shared<mapState::Road>(1,nullptr, stationA, stationB, mapState::RoadColor::RED, 4);
+        auto road2 = std::make_shared<mapState::Road>(2,nullptr, stationA, stationB, mapState::RoadColor::BLUE, 4);
+        auto road3 = std::make_shared<mapState::Road>(3,nullptr, stationB, stationC, mapState::RoadColor::PINK, 2);
 
         std::vector<std::shared_ptr<mapState::Road>> borrowed = {road1, road2, road3};
 
@@ -558,9 +558,9 @@ TEST(calculatePoints)
 {
     ANN_START("calculatePoints")
 
-    auto stationA = std::make_shared<mapState::Station>("A", nullptr, nullptr);
-    auto stationB = std::make_shared<mapState::Station>("B", nullptr, nullptr);
-    auto stationC = std::make_shared<mapState::Station>("C", nullptr, nullptr);
+    auto stationA = std::make_shared<mapState::Station>("A", nullptr);
+    auto stationB = std::make_shared<mapState::Station>("B", nullptr);
+    auto stationC = std::make_shared<mapState::Station>("C", nullptr);
 
     ANN_START("Empty player - no roads, no completed destinations → 0 points")
     {
@@ -581,8 +581,8 @@ TEST(calculatePoints)
 
     ANN_START("Classic case - some roads + completed destinations")
     {
-        auto road1 = std::make_shared<mapState::Road>(1,nullptr, stationA, stationB, mapState::RoadColor::RED, 2, nullptr);
-        auto road2 = std::make_shared<mapState::Road>(2,nullptr, stationB, stationC, mapState::RoadColor::BLUE, 4, nullptr);
+        auto road1 = std::make_shared<mapState::Road>(1,nullptr, stationA, stationB, mapState::RoadColor::RED, 2);
+        auto road2 = std::make_shared<mapState::Road>(2,nullptr, stationB, stationC, mapState::RoadColor::BLUE, 4);
 
         std::vector<std::shared_ptr<mapState::Road>> borrowed = {road1, road2};
 
@@ -608,8 +608,8 @@ TEST(calculatePoints)
 
     ANN_START("Only long roads - no destinations")
     {
-        auto road1 = std::make_shared<mapState::Road>(1,nullptr, stationA, stationB, mapState::RoadColor::GREEN, 6, nullptr);
-        auto road2 = std::make_shared<mapState::Road>(2,nullptr, stationB, stationC, mapState::RoadColor::PINK, 5, nullptr);
+        auto road1 = std::make_shared<mapState::Road>(1,nullptr, stationA, stationB, mapState::RoadColor::GREEN, 6);
+        auto road2 = std::make_shared<mapState::Road>(2,nullptr, stationB, stationC, mapState::RoadColor::PINK, 5);
 
         std::vector<std::shared_ptr<mapState::Road>> borrowed = {road1, road2};
 
@@ -994,8 +994,8 @@ TEST(isDestinationReached)
 
         Player player("Bob", PlayerColor::GREEN, 0, 35, 4, {}, nullptr);
         auto dest = std::make_shared<cardsState::DestinationCard>(
-        std::make_shared<mapState::Station>("Madrid", nullptr, nullptr),
-        std::make_shared<mapState::Station>("Berlin", nullptr, nullptr),
+        std::make_shared<mapState::Station>("Madrid", nullptr),
+        std::make_shared<mapState::Station>("Berlin", nullptr),
             12, 20
         );
 
@@ -1093,7 +1093,7 @@ TEST(display_player) {
 
             std::shared_ptr<mapState::Station> stationA = test_interact_map->getStationByName(test_interract_stationA_name);
             std::shared_ptr<mapState::Station> stationB = test_interact_map->getStationByName(test_interract_stationB_name);
-            auto road = std::make_shared<mapState::Road>(2,nullptr, stationA, stationB, mapState::RoadColor::GREEN, 4, nullptr);
+            auto road = std::make_shared<mapState::Road>(2,nullptr, stationA, stationB, mapState::RoadColor::GREEN, 4);
 
             std::stringstream buffer;
             std::streambuf* old = std::cout.rdbuf(buffer.rdbuf());
@@ -1128,7 +1128,7 @@ TEST(display_player) {
 
             std::shared_ptr<mapState::Station> stationA = test_interact_map->getStationByName(test_interract_stationA_name);
             std::shared_ptr<mapState::Station> stationB = test_interact_map->getStationByName(test_interract_stationB_name);
-            auto road = std::make_shared<mapState::Road>(2,nullptr, stationA, stationB, mapState::RoadColor::GREEN, 4, nullptr);
+            auto road = std::make_shared<mapState::Road>(2,nullptr, stationA, stationB, mapState::RoadColor::GREEN, 4);
             road->setOwner(p);
             std::vector<std::shared_ptr<mapState::Road>> borrowedRoads={road};
             p->borrowedRoads=borrowedRoads;
@@ -53,11 +53,9 @@ std::shared_ptr<playersState::Player> test_owner =
 std::shared_ptr<boost::adjacency_list<>> graph =
     std::make_shared<boost::adjacency_list<>>();
 
-std::shared_ptr<boost::adjacency_list<>::vertex_descriptor> vertexA = std::make_shared<boost::adjacency_list<>::vertex_descriptor>(
-    boost::add_vertex(*graph));
+boost::adjacency_list<>::vertex_descriptor vertexA = boost::add_vertex(*graph);
 
-std::shared_ptr<boost::adjacency_list<>::vertex_descriptor> vertexB = std::make_shared<boost::adjacency_list<>::vertex_descriptor>(
-    boost::add_vertex(*graph));
+boost::adjacency_list<>::vertex_descriptor vertexB = boost::add_vertex(*graph);
 
 std::shared_ptr<Station> stationA =
     std::make_shared<Station>(test_stationA_name, test_owner, vertexA);
@@ -323,7 +321,7 @@ TEST(isRoadClaimable)
                                            test_init_player2_score, test_init_player2_nbWagons,
                                            test_init_player2_nbStations, test_borrowed_roads, hand2);
 
-      auto road = std::make_shared<Road>(1,nullptr, stationA,stationB, mapState::RoadColor::RED,4,nullptr);
+      auto road = std::make_shared<Road>(1,nullptr, stationA,stationB, mapState::RoadColor::RED,4);
       road->setOwner(player2);
       PlayersState ps({player1, player2});
       bool canClaim = ps.isRoadClaimable(map, road, player1);
@@ -344,7 +342,7 @@ TEST(isRoadClaimable)
                                          test_init_player1_score, 21,
                                          test_init_player1_nbStations, test_borrowed_roads, hand1);
 
-      auto road = std::make_shared<Road>(1,nullptr, stationA,stationB, mapState::RoadColor::BLACK,4,nullptr);
+      auto road = std::make_shared<Road>(1,nullptr, stationA,stationB, mapState::RoadColor::BLACK,4);
         PlayersState ps({player});
 
       bool canClaim = ps.isRoadClaimable(map, road, player);
@@ -365,7 +363,7 @@ TEST(isRoadClaimable)
                                          test_init_player1_score, 21,
                                          test_init_player1_nbStations, test_borrowed_roads, hand1);
 
-      auto road = std::make_shared<Road>(1,nullptr, stationA,stationB, mapState::RoadColor::BLACK,4,nullptr);
+      auto road = std::make_shared<Road>(1,nullptr, stationA,stationB, mapState::RoadColor::BLACK,4);
       road->setOwner(player);
       PlayersState ps({player});
       bool canClaim = ps.isRoadClaimable(map, road, player);
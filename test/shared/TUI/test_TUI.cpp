@@ -332,10 +332,10 @@ BOOST_AUTO_TEST_CASE(RendersStationsAndRoutes)
   std::shared_ptr<boost::adjacency_list<>> graph =
       std::make_shared<boost::adjacency_list<>>();
 
-  std::shared_ptr<boost::adjacency_list<>::vertex_descriptor> vertexA =
-      std::make_shared<boost::adjacency_list<>::vertex_descriptor>(boost::add_vertex(*graph));
-  std::shared_ptr<boost::adjacency_list<>::vertex_descriptor> vertexB =
-      std::make_shared<boost::adjacency_list<>::vertex_descriptor>(boost::add_vertex(*graph));
+  boost::adjacency_list<>::vertex_descriptor vertexA =
+      boost::add_vertex(*graph);
+  boost::adjacency_list<>::vertex_descriptor vertexB =
+      boost::add_vertex(*graph);
 
   std::shared_ptr<mapState::Station> stationA =
       std::make_shared<mapState::Station>("Alpha", nullptr, vertexA);
@@ -403,10 +403,10 @@ BOOST_AUTO_TEST_CASE(HighlightsAndFlags)
 
   std::shared_ptr<boost::adjacency_list<>> graph =
       std::make_shared<boost::adjacency_list<>>();
-  std::shared_ptr<boost::adjacency_list<>::vertex_descriptor> vertexA =
-      std::make_shared<boost::adjacency_list<>::vertex_descriptor>(boost::add_vertex(*graph));
-  std::shared_ptr<boost::adjacency_list<>::vertex_descriptor> vertexB =
-      std::make_shared<boost::adjacency_list<>::vertex_descriptor>(boost::add_vertex(*graph));
+  boost::adjacency_list<>::vertex_descriptor vertexA =
+      boost::add_vertex(*graph);
+  boost::adjacency_list<>::vertex_descriptor vertexB =
+      boost::add_vertex(*graph);
 
   std::shared_ptr<mapState::Station> stationA =
       std::make_shared<mapState::Station>("Alpha", owner, vertexA);